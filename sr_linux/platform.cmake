@@ -3,7 +3,7 @@
 # Copyright (c) 2013-2020 Fidelity National Information		#
 # Services, Inc. and/or its subsidiaries. All rights reserved.	#
 #								#
-# Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	#
+# Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	#
 # All rights reserved.						#
 #								#
 # Copyright (c) 2017-2018 Stephen L Johnson.			#
@@ -231,6 +231,12 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_ci_tab_open")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_ci_tab_open_t")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_ci_tab_switch")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_ci_tab_switch_t")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_close_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_close_st")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_next_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_next_st")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_open_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_cursor_open_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_data_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_data_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_delete_excl_s")
@@ -247,6 +253,8 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_file_name_to_id")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_file_name_to_id_t")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_fork_n_core")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_free")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_many_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_many_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_hiber_start")
@@ -267,6 +275,8 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_st")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_many_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_many_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_sig_dispatch")
@@ -3,7 +3,7 @@
  * Copyright (c) 2016-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -21,6 +21,7 @@
 #define AIO_SHIM_WRITE(UNUSED, AIOCBP, RET)   /* no-op, N/A */
 #define AIO_SHIM_RETURN(AIOCBP, RET)          /* no-op, N/A */
 #define AIO_SHIM_ERROR(AIOCBP, RET)           /* no-op, N/A */
+#define AIO_SHIM_SUBMIT(REG)                  /* no-op, N/A */
 #define SIGNAL_ERROR_IN_WORKER_THREAD(gdi, err_str, errno)    /* no-op, N/A */
 #define CHECK_ERROR_IN_WORKER_THREAD(reg, udi)                        /* no-op, N/A */
 #elif !defined(USE_LIBAIO)    /* USE_NOAIO */
@@ -35,6 +36,7 @@ MBSTART {										\
 	RET = aio_error(AIOCBP); 							\
 	ENABLE_INTERRUPTS(INTRPT_IN_AIO_ERROR, prev_intrpt_state);			\
 } MBEND
+#define AIO_SHIM_SUBMIT(REG)				/* no-op, N/A */
 #define SIGNAL_ERROR_IN_WORKER_THREAD(gdi, err_str, errno)	/* no-op, N/A */
 #define CHECK_ERROR_IN_WORKER_THREAD(reg, udi)			/* no-op, N/A */
 
@@ -47,8 +49,11 @@ error_def(ERR_SYSCALL);
 
 void 	aio_shim_destroy(gd_addr *gd);
 int 	aio_shim_write(gd_region *reg, struct aiocb *aiocbp);
+void	aio_shim_submit(gd_region *reg);
 
 #define AIO_SHIM_WRITE(REG, AIOCBP, RET) 	MBSTART { RET = aio_shim_write(REG, AIOCBP); } MBEND
+/* Writes to a region with "asyncio_uring" set are only queued by AIO_SHIM_WRITE. This submits all queued writes in one go. */
+#define AIO_SHIM_SUBMIT(REG)			MBSTART { aio_shim_submit(REG); } MBEND
 #define AIO_SHIM_ERROR(AIOCBP, RET) 		MBSTART { RET = (AIOCBP)->status; } MBEND
 #define AIO_SHIM_RETURN(AIOCBP, RET) 		MBSTART { SHM_READ_MEMORY_BARRIER; RET = (AIOCBP)->res; } MBEND
 							/* Need a memory barrier here so that we can
@@ -107,6 +112,8 @@ struct gd_info
 	int		laio_efd;	/* eventfd notifies on libaio completion */
 	aio_context_t 	ctx;		/* kernel context associated with AIO    */
 	volatile int	num_ios;	/* Number of IOs in flight 		 */
+	struct aio_uring *uring;	/* io_uring instance (set up on first write to an "asyncio_uring" region) */
+	boolean_t	uring_unavail;	/* TRUE if io_uring could not be set up; Linux AIO is used instead */
 
 	/* Note that errno must be set before what */
 	volatile char 	*err_syscall;	/* If an error occurred, what was it? 	 */
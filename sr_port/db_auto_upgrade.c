@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -261,8 +261,19 @@ void db_auto_upgrade(gd_region *reg)
 				/* else: Upgrading from a GT.M release. All auto upgrade activity would have already
 				 * happened as appropriate in the previous "case" blocks.
 				 */
-				break;
 			case GDSMR136:
+				/* YottaDB r138 introduced "asyncio_uring" to select the io_uring engine for asyncio writes */
+				csd->asyncio_uring = FALSE;
+				/* YottaDB r138 introduced "crit_queue" to select the NUMA crit queue */
+				csd->crit_queue = FALSE;
+				/* YottaDB r138 introduced "blk_compress" and "blk_compress_used" for compressed block storage */
+				csd->blk_compress = 0;
+				csd->blk_compress_used = FALSE;
+				/* YottaDB r138 introduced "cbt_tn", "cbt_shift" and "cbt_map" for changed block tracking */
+				csd->cbt_tn[0] = csd->cbt_tn[1] = 0;
+				csd->cbt_shift = 0;
+				memset(csd->cbt_map, 0, SIZEOF(csd->cbt_map));
+			case GDSMR138:
 		/* When adding a new minor version, the following template should be maintained
 		 * a) If there are any file header fields added in the new minor version, initialize the fields to default values
 		 *    in the last case (i.e. above this comment block). Do not add a "break" for the above "case" block.
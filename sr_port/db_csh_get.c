@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -20,6 +23,7 @@
 #include "cache.h"
 #include "longset.h"		/* needed for cws_insert.h */
 #include "cws_insert.h"
+#include "memcoherency.h"
 
 GBLREF sgmnt_addrs	*cs_addrs;
 GBLREF unsigned int	t_tries;
@@ -35,6 +39,7 @@ cache_rec_ptr_t	db_csh_get(block_id block) /* block number to look up */
 	sgmnt_data_ptr_t		csd;
 	cache_rec_ptr_t			cr, cr_hash_base;
 	int				blk_hash, lcnt, ocnt, hmax;
+	int4				version;
 	node_local_ptr_t		cnl;
 #	ifdef DEBUG
 	cache_rec_ptr_t			cr_low, cr_high;
@@ -54,25 +59,35 @@ cache_rec_ptr_t	db_csh_get(block_id block) /* block number to look up */
 	{
 		cr = cr_hash_base;
 		assert((0 == cr->blk) || (BT_QUEHEAD == cr->blk));
+		version = BLKQUE_VERSION(cr_hash_base);
+		SHM_READ_MEMORY_BARRIER;
 		lcnt = hmax;
 		do
 		{
 			cr = (cache_rec_ptr_t)((sm_uc_ptr_t)cr + cr->blkque.fl);
 			assert(!CR_NOT_ALIGNED(cr, cr_low) && !CR_NOT_IN_RANGE(cr, cr_low, cr_high));
 			if (BT_QUEHEAD == cr->blk)
-			{	/* We have reached the end of the queue, validate we have run the queue
-				 * back around to the same queue header or we'll need to retry because the
-				 * queue changed on us.
+			{	/* We have reached the end of the queue. A miss can be trusted only if we ran the queue back around
+				 * to the same queue header and (unless we hold crit) "db_csh_getn" did not relink this chain while
+				 * we were walking it. Otherwise we'll need to retry because the queue changed on us. Note that a
+				 * cache record moved to a different chain while we were on it leads us to a different queue
+				 * header so out of crit there is no need to check every record's hash on the way.
 				 */
 				if (cr == cr_hash_base)
-					return (cache_rec_ptr_t)NULL;
+				{
+					if (csa->now_crit)
+						return (cache_rec_ptr_t)NULL;
+					SHM_READ_MEMORY_BARRIER;
+					if (BLKQUE_VERSION_IS_STABLE(version) && (version == BLKQUE_VERSION(cr_hash_base)))
+						return (cache_rec_ptr_t)NULL;
+				}
 				break;			/* Retry - something changed */
 			}
-			if ((CR_BLKEMPTY != cr->blk) && ((cr->blk % hmax) != blk_hash))
-				break;			/* Retry - something changed */
 			assert(!csa->now_crit || (0 != cr->blkque.fl) && (0 != cr->blkque.bl));
+			if (csa->now_crit && (CR_BLKEMPTY != cr->blk) && ((cr->blk % hmax) != blk_hash))
+				break;			/* Hash table is corrupt - caller will see CR_NOTVALID */
 			if (cr->blk == block)
-			{
+			{	/* A hit is valid even if the chain is being relinked concurrently (version not stable) */
 				if (CDB_STAGNATE <= t_tries || mu_reorg_process)
 					CWS_INSERT(block);
 				/* setting refer outside of crit may not prevent its replacement, but that's an
@@ -89,6 +104,14 @@ cache_rec_ptr_t	db_csh_get(block_id block) /* block number to look up */
 		/* We rarely expect to come here, hence it is considered better to recompute the maximum value of ocnt (for the
 		 * termination check) instead of storing it in a local variable at the beginning of the do loop */
 	} while (ocnt < (csa->now_crit ? 1 : ENOUGH_TRIES_TO_FALL_BACK));
-	INCR_GVSTATS_COUNTER(csa, cnl, n_buffer_scarce, 1);
-	return (TRUE == csa->now_crit ? (cache_rec_ptr_t)CR_NOTVALID : (cache_rec_ptr_t) NULL);
+	if (csa->now_crit)
+	{
+		INCR_GVSTATS_COUNTER(csa, cnl, n_buffer_scarce, 1);
+		return (cache_rec_ptr_t)CR_NOTVALID;
+	}
+	/* The chain kept changing under us. That is contention, not a shortage of buffers or a corrupt hash table: report
+	 * a miss, on which out-of-crit callers ("t_qread") repeat the lookup holding crit before getting a new buffer.
+	 */
+	INCR_GVSTATS_COUNTER(csa, cnl, n_hash_chain_retry, 1);
+	return (cache_rec_ptr_t)NULL;
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -456,7 +456,13 @@ cache_rec_ptr_t	db_csh_getn(block_id block)
 			cr->bt_index = 0;
 		}
 		q0 = (cache_rec_ptr_t)((sm_uc_ptr_t)cr + cr->blkque.fl);
+		/* Only the destination chain needs a version change. An out-of-crit "db_csh_get" positioned on "cr" in its
+		 * old chain follows the new links into the destination chain and detects the move by ending at a foreign
+		 * queue head.
+		 */
+		BEGIN_BLKQUE_CHANGE(hdr);
 		shuffqth((que_ent_ptr_t)q0, (que_ent_ptr_t)hdr);
+		END_BLKQUE_CHANGE(hdr);
 		assert(0 == cr->dirty);
 		if (!pass0cnt)
 			csa->nl->cur_lru_cache_rec_off = GDS_ABS2REL(cr);
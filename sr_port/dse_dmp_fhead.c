@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -79,6 +79,18 @@ LITREF	char		*gtm_dbversion_table[];
 		util_out_print("  " TEXT1 " : " TEXT2"  0x!16@XQ", TRUE, (&cnl->gvstats_rec.COUNTER));	\
 }
 
+#define SHOW_GVSTATS_HIST(cnl, HIST, TEXT1, TEXT2)								\
+{														\
+	int	bucket;												\
+														\
+	for (bucket = 0; bucket < GVSTATS_HIST_BUCKETS; bucket++)						\
+	{													\
+		if (cnl->gvstats_hist.HIST[bucket])								\
+			util_out_print("  " TEXT1 " : " TEXT2 " bucket !2UL  0x!16@XQ", TRUE, bucket,		\
+					(&cnl->gvstats_hist.HIST[bucket]));					\
+	}													\
+}
+
 /* NEED_TO_DUMP is only for the qualifiers other than "BASIC" and "ALL".
 	file_header is not dumped only if "NOBASIC" is explicitly specified */
 
@@ -252,6 +264,12 @@ void dse_dmp_fhead (void)
 		util_out_print("  Max conc proc time !22UL", FALSE, csd->max_procs.time);
 		util_out_print("  Max Concurrent processes !9UL", TRUE, csd->max_procs.cnt);
 		util_out_print("  Reorg Sleep Nanoseconds !17UL", TRUE, csd->reorg_sleep_nsec);
+		util_out_print("  Async IO engine                  !AD", TRUE, 8, csd->asyncio_uring ? "io_uring" : "  libaio");
+		util_out_print("  NUMA crit queue                  !AD", TRUE, 8, csd->crit_queue ? "      ON" : "     OFF");
+		util_out_print("  Block compression level          !8UL", TRUE, csd->blk_compress);
+		util_out_print("  Changed block map group size     !8UL", TRUE, BLKS_PER_LMAP << csd->cbt_shift);
+		for (index = 0; index < CBT_GENS; index++)
+			util_out_print("  Changed block map !UL TN 0x!16@XQ", TRUE, index + 1, &csd->cbt_tn[index]);
 	}
 	if (CLI_PRESENT == cli_present("ALL"))
 	{	/* Only dump if -/ALL as if part of above display */
@@ -357,6 +375,9 @@ void dse_dmp_fhead (void)
 #		define TAB_GVSTATS_REC(COUNTER,TEXT1,TEXT2)	SHOW_GVSTATS_STAT(cnl, COUNTER, TEXT1, TEXT2)
 #		include "tab_gvstats_rec.h"
 #		undef TAB_GVSTATS_REC
+#		define TAB_GVSTATS_HIST(HIST,TEXT1,TEXT2)	SHOW_GVSTATS_HIST(cnl, HIST, TEXT1, TEXT2)
+#		include "tab_gvstats_hist.h"
+#		undef TAB_GVSTATS_HIST
 	}
 	if (NEED_TO_DUMP("TPBLKMOD"))
 	{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -249,6 +249,7 @@ GBLDEF	sgm_info	*first_tp_si_by_ftok;	/* List of participating regions in the TP
 GBLDEF	spdesc		indr_stringpool,
 			rts_stringpool,
 			stringpool;
+GBLDEF	stp_gcol_stats_t	stp_gcol_stats;		/* stringpool garbage collection statistics ($VIEW("SPGCSTATS")) */
 GBLDEF	stack_frame	*frame_pointer;
 GBLDEF	stack_frame	*zyerr_frame;
 GBLDEF	symval		*curr_symval;
@@ -919,6 +920,11 @@ GBLDEF	int4		repl_zlib_cmp_level;		/* zlib compression level currently in use in
 							 * This is a source-server specific variable and is non-zero only
 							 * if compression is enabled and works in the receiver server as well.
 							 */
+GBLDEF	boolean_t	ydb_repl_cmp_stream;		/* TRUE unless $ydb_repl_cmp_stream is false or zlib lacks the stream API */
+GBLDEF	boolean_t	repl_zlib_cmp_stream;		/* TRUE if the replication pipe currently compresses messages using one
+							 * zlib stream (see gtm_zlib_cmp_stream) instead of one compress2() call
+							 * per message. Negotiated along with repl_zlib_cmp_level.
+							 */
 GBLDEF	zlib_cmp_func_t		zlib_compress_fnptr;
 GBLDEF	zlib_uncmp_func_t	zlib_uncompress_fnptr;
 GBLDEF	mlk_stats_t	mlk_stats;			/* Process-private M-lock statistics */
@@ -0,0 +1,108 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "gds_cbt.h"
+
+/* Returns the "cbt_shift" that lets a changed block map cover a database of "total_blks" blocks */
+static uint4 gds_cbt_shift(block_id total_blks)
+{
+	block_id	groups;
+	uint4		shift;
+
+	groups = DIVIDE_ROUND_UP(total_blks, BLKS_PER_LMAP);
+	for (shift = 0; ((groups - 1) >> shift) >= CBT_MAP_BITS; shift++)
+		;
+	return shift;
+}
+
+/* Doubles the number of local bitmaps a bit of the changed block maps covers, OR-ing each pair of bits into one */
+static void gds_cbt_fold(sgmnt_data_ptr_t csd)
+{
+	unsigned char	*map, folded[CBT_MAP_BYTES];
+	uint4		bit;
+	int		i;
+
+	for (i = 0; i < CBT_GENS; i++)
+	{
+		map = csd->cbt_map[i];
+		memset(folded, 0, SIZEOF(folded));
+		for (bit = 0; bit < CBT_MAP_BITS; bit++)
+		{
+			if (map[bit / BITS_PER_UCHAR] & (1 << (bit % BITS_PER_UCHAR)))
+				folded[bit / 2 / BITS_PER_UCHAR] |= (1 << ((bit / 2) % BITS_PER_UCHAR));
+		}
+		memcpy(map, folded, SIZEOF(folded));
+	}
+	csd->cbt_shift++;
+}
+
+/* Called in crit by MUPIP BACKUP once it has its copy of the file header. Restarts the changed block map with the older
+ * "cbt_tn" (or one not in use) at transaction "tn", so the next backup can read just the blocks updated from "tn" on.
+ */
+void gds_cbt_start(sgmnt_data_ptr_t csd, trans_num tn)
+{
+	int	gen;
+
+	if (!csd->cbt_tn[0] && !csd->cbt_tn[1])
+	{	/* Neither map in use; size them for the current file */
+		memset(csd->cbt_map, 0, SIZEOF(csd->cbt_map));
+		csd->cbt_shift = gds_cbt_shift(csd->trans_hist.total_blks);
+	}
+	gen = (csd->cbt_tn[0] <= csd->cbt_tn[1]) ? 0 : 1;
+	memset(csd->cbt_map[gen], 0, SIZEOF(csd->cbt_map[gen]));
+	csd->cbt_tn[gen] = tn;
+}
+
+/* Called in crit by "gdsfilext" before the database grows from "old_total" to "new_total" blocks. Coarsens the changed block
+ * maps if they would not cover the new size and marks the new blocks (and their local bitmaps) as changed.
+ */
+void gds_cbt_extend(sgmnt_data_ptr_t csd, block_id old_total, block_id new_total)
+{
+	block_id	blk;
+
+	if (!csd->cbt_tn[0] && !csd->cbt_tn[1])
+		return;
+	while (gds_cbt_shift(new_total) > csd->cbt_shift)
+		gds_cbt_fold(csd);
+	for (blk = old_total; blk < new_total; blk = CBT_NEXT_GROUP(csd, blk))
+		CBT_MARK(csd, blk);
+}
+
+/* Returns the changed block map an incremental backup of the transactions from "tn" on can use, NULL if there is none. Among
+ * the maps in use that started at or before "tn", the one that started last lists the fewest groups.
+ */
+unsigned char *gds_cbt_map(sgmnt_data_ptr_t csd, trans_num tn)
+{
+	unsigned char	*map;
+	trans_num	map_tn;
+	int		i;
+
+	for (map = NULL, map_tn = 0, i = 0; i < CBT_GENS; i++)
+	{
+		if (csd->cbt_tn[i] && (csd->cbt_tn[i] <= tn) && (csd->cbt_tn[i] > map_tn))
+		{
+			map = csd->cbt_map[i];
+			map_tn = csd->cbt_tn[i];
+		}
+	}
+	return map;
+}
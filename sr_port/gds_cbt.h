@@ -0,0 +1,67 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef GDS_CBT_H_INCLUDED
+#define GDS_CBT_H_INCLUDED
+
+/* Changed block tracking for incremental backup.
+ *
+ * The file header holds CBT_GENS maps ("cbt_map") of CBT_MAP_BITS bits each. A bit stands for a group of 2**cbt_shift local
+ * bitmaps (BLKS_PER_LMAP blocks each) and is set, in crit, by every commit that updates a block of the group. "cbt_tn[i]" is
+ * the transaction number map i was cleared at, so map i lists every group with a block updated by a transaction numbered
+ * "cbt_tn[i]" or higher. An incremental backup of the transactions from "tn" on then only needs to read the groups set in a
+ * map whose "cbt_tn" is not greater than "tn" (see "gds_cbt_map"), instead of the whole file.
+ *
+ * Every MUPIP BACKUP clears the map with the older "cbt_tn" and restarts it at the current transaction number
+ * ("gds_cbt_start"), so the maps cover the changes since each of the last two backups. Anything that writes blocks without
+ * going through the commit logic (journal recovery applying before images, MUPIP RESTORE, a crash that leaves the maps in
+ * the file header behind the blocks on disk) stops using the maps with CBT_INVALIDATE and incremental backups read the whole
+ * file again until the next backup restarts them.
+ */
+
+#define	CBT_MAP_BITS	(CBT_MAP_BYTES * BITS_PER_UCHAR)
+
+#define	CBT_BIT(CSD, BLK)	((uint4)((BLK) / BLKS_PER_LMAP) >> (CSD)->cbt_shift)
+
+/* Called, in crit, by the commit logic for each block it updates */
+#define	CBT_MARK(CSD, BLK)									\
+MBSTART {											\
+	uint4	lcl_bit;									\
+												\
+	lcl_bit = CBT_BIT(CSD, BLK);								\
+	if (CBT_MAP_BITS > lcl_bit)								\
+	{											\
+		(CSD)->cbt_map[0][lcl_bit / BITS_PER_UCHAR] |= (1 << (lcl_bit % BITS_PER_UCHAR));	\
+		(CSD)->cbt_map[1][lcl_bit / BITS_PER_UCHAR] |= (1 << (lcl_bit % BITS_PER_UCHAR));	\
+	} else											\
+	{	/* "gds_cbt_extend" should have made room; do not trust the maps */		\
+		assert(FALSE);									\
+		CBT_INVALIDATE(CSD);								\
+	}											\
+} MBEND
+
+/* TRUE if a block of the group of block BLK may have been updated since the "cbt_tn" of changed block map MAP */
+#define	CBT_CHANGED(CSD, MAP, BLK)	((MAP)[CBT_BIT(CSD, BLK) / BITS_PER_UCHAR] & (1 << (CBT_BIT(CSD, BLK) % BITS_PER_UCHAR)))
+
+/* First block of the group after the one of block BLK */
+#define	CBT_NEXT_GROUP(CSD, BLK)	((((block_id)CBT_BIT(CSD, BLK) + 1) * BLKS_PER_LMAP) << (CSD)->cbt_shift)
+
+#define	CBT_INVALIDATE(CSD)					\
+MBSTART {							\
+	(CSD)->cbt_tn[0] = (CSD)->cbt_tn[1] = 0;		\
+} MBEND
+
+void		gds_cbt_start(sgmnt_data_ptr_t csd, trans_num tn);
+void		gds_cbt_extend(sgmnt_data_ptr_t csd, block_id old_total, block_id new_total);
+unsigned char	*gds_cbt_map(sgmnt_data_ptr_t csd, trans_num tn);
+
+#endif
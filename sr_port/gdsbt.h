@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -190,11 +190,40 @@ typedef struct
 	CACHELINE_PAD(SIZEOF(mutex_que_head), 9);
 } mutex_struct;
 
+/* With the NUMA crit queue (csd->crit_queue) a process waiting for crit claims one of these slots and spins on it instead of on
+ * the crit mutex. The process releasing crit picks a waiter and, after unlocking the mutex, hands crit to it by setting
+ * "handoff" to the ticket of that waiter. Each slot has a cache line to itself so a waiter's spinning does not disturb other
+ * waiters or the crit holder.
+ */
+typedef struct
+{
+	global_latch_t	owner;			/* pid of the process that owns this slot or LOCK_AVAILABLE */
+	volatile uint4	ticket;			/* arrival order of the waiter; 0 if the slot holds no waiter */
+	volatile uint4	handoff;		/* set to "ticket" by the process that hands crit to this waiter */
+	int4		numa_node;		/* NUMA node the waiter was running on when it claimed the slot */
+	int4		filler;
+	CACHELINE_PAD(SIZEOF(global_latch_t) + 4 * SIZEOF(int4), 1);
+} mutex_spin_slot;
+
+#define MUTEX_NUM_SPIN_SLOTS		32	/* Maximum number of processes spinning for crit with the NUMA crit queue */
+#define MUTEX_NUMA_FAIRNESS_WINDOW	8	/* Maximum number of successive handoffs to a waiter on the NUMA node of the
+						 * releasing process when a waiter on another node has waited longer.
+						 */
+
 typedef struct
 {
 	FILL8DCL(uint4, crit_cycle, 1);
 	FILL8DCL(uint4, stuck_cycle, 2);
 	pthread_mutex_t		mutex;
+	volatile int4		spin_waiters;	/* number of processes waiting in "spinslots" */
+	uint4			spin_ticket;	/* source of mutex_spin_slot.ticket */
+	int4			handoff_streak;	/* successive handoffs that preferred a younger waiter on the releasing
+						 * node. Only updated by the crit holder.
+						 */
+	int4			filler;
+	/* 16 for the FILL8DCLs. Pads to the next cache line boundary so each spin slot has a cache line to itself. */
+	CACHELINE_PAD((16 + SIZEOF(pthread_mutex_t) + 4 * SIZEOF(int4)) % CACHELINE_SIZE, 3);
+	mutex_spin_slot		spinslots[MUTEX_NUM_SPIN_SLOTS];
 } pth_mutex_struct;
 
 typedef struct {
@@ -660,6 +689,7 @@ typedef struct node_local_struct
 							 * Is name of the statsdb corresponding to this basedb otherwise.
 							 */
 	gvstats_rec_t	gvstats_rec;
+	gvstats_hist_t	gvstats_hist;			/* database-wide latency histograms */
 	trans_num	last_wcsflu_tn;			/* curr_tn when last wcs_flu was done on this database */
 	trans_num	last_wcs_recover_tn;		/* csa->ti->curr_tn of most recent "wcs_recover" */
 	sm_off_t	encrypt_glo_buff_off;	/* offset from unencrypted global buffer to its encrypted counterpart */
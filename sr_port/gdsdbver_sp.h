@@ -3,7 +3,7 @@
  * Copyright (c) 2015-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -70,4 +70,9 @@ ENUM_ENTRY(GDSMR136),		/* Includes GDSMV63012 and GDSMV63014.
 				 *  a) max_procs
 				 *  b) reorg_sleep_nsec
 				 */
+ENUM_ENTRY(GDSMR138),		/* New field "asyncio_uring" selects the io_uring engine for ASYNCIO database writes.
+				 * New field "crit_queue" selects the NUMA crit queue.
+				 * New fields "blk_compress" and "blk_compress_used" for compressed block storage.
+				 * New fields "cbt_tn", "cbt_shift" and "cbt_map" for changed block tracking.
+				 */
 ENUM_ENTRY(GDSMVLAST)
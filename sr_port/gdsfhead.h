@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -255,6 +255,28 @@ typedef struct
 #define		BACKUP_NOT_IN_PROGRESS	0x7FFFFFFF
 #define		DB_CSH_RDPOOL_SZ	0x20	/* These many non-dirty buffers exist at all points in time in shared memory */
 
+/* The first "bt_buckets" cache records are the heads of the block number hash chains (blk == BT_QUEHEAD). Their "cycle" field
+ * is otherwise unused and serves as a seqlock-style version of the chain. "db_csh_getn" (the only routine that relinks a chain
+ * while the cache is not blocked) makes the version odd before and even (and different) after moving a cache record into a
+ * chain. "db_csh_get" snapshots the version before walking the chain out of crit and only trusts a "block not found" answer if
+ * the version is unchanged at the end of the walk. This avoids a false miss (and the crit grab it causes in "t_qread") when a
+ * concurrent process inserts the block into the chain after the reader passed the insertion point. The begin macro sets the
+ * low bit rather than incrementing so a version left odd by a process killed in the middle of the relink is healed by the
+ * next relink of that chain.
+ */
+#define	BLKQUE_VERSION(HDR)		(*(volatile int4 *)&(HDR)->cycle)
+#define	BLKQUE_VERSION_IS_STABLE(VER)	(0 == ((VER) & 1))
+#define	BEGIN_BLKQUE_CHANGE(HDR)	\
+MBSTART {				\
+	(HDR)->cycle |= 1;		\
+	SHM_WRITE_MEMORY_BARRIER;	\
+} MBEND
+#define	END_BLKQUE_CHANGE(HDR)		\
+MBSTART {				\
+	SHM_WRITE_MEMORY_BARRIER;	\
+	(HDR)->cycle++;			\
+} MBEND
+
 typedef struct
 {
 	cache_que_head	cacheq_wip,	/* write-in-progress queue */
@@ -1666,6 +1688,38 @@ MBSTART {												\
 	}												\
 } MBEND
 
+/* Latency histograms (see tab_gvstats_hist.h). Callers take the start time of an operation with GVSTATS_HIST_START and,
+ * when it is done, add it to histogram HIST with GVSTATS_HIST_ADD. Like the counters, the histograms are not updated when
+ * stats are turned off and then neither the start nor the end time is taken (a start time of 0 means no time was taken).
+ * GVSTATS_HIST_ADD_NSEC adds an operation whose elapsed time (NSEC nanoseconds) the caller already has.
+ */
+#define	GVSTATS_HIST_START(CSA)	((0 == (RDBF_NOSTATS & (CSA)->reservedDBFlags)) ? gvstats_hist_now() : 0)
+
+#define	GVSTATS_HIST_ADD(CSA, CNL, HIST, START)								\
+MBSTART {												\
+	if (START)											\
+		GVSTATS_HIST_ADD_NSEC(CSA, CNL, HIST, gvstats_hist_now() - (START));			\
+} MBEND
+
+#define	GVSTATS_HIST_ADD_NSEC(CSA, CNL, HIST, NSEC)							\
+MBSTART {												\
+	int	lcl_bucket;										\
+													\
+	if (0 == (RDBF_NOSTATS & (CSA)->reservedDBFlags))						\
+	{												\
+		lcl_bucket = gvstats_hist_bucket(NSEC);							\
+		(CSA)->gvstats_hist.HIST[lcl_bucket]++;		/* process-private histogram */		\
+		(CNL)->gvstats_hist.HIST[lcl_bucket]++;		/* database histogram */		\
+	}												\
+} MBEND
+
+/* A sequential scan that has to go to disk hints the OS to read ahead the next $ydb_readahead right siblings (at most
+ * DB_READAHEAD_MAX) of the block it moved to (see db_readahead.c). Each sgmnt_addrs remembers the last DB_READAHEAD_MAX
+ * blocks it read ahead so dsk_read can count the ones that are later used (RAH) and db_readahead the ones that are not (RAM).
+ */
+#define	DB_READAHEAD_DEFAULT	8
+#define	DB_READAHEAD_MAX	64
+
 #define	SYNC_RESERVEDDBFLAGS_REG_CSA_CSD(REG, CSA, CSD, CNL)								\
 MBSTART {														\
 	uint4			reservedDBFlags;									\
@@ -1708,6 +1762,7 @@ MBSTART {											\
 	memset(CHPTR, 0, CLRLEN);								\
 	memset((char *)&CSD->tp_cdb_sc_blkmod, 0, SIZEOF(CSD->tp_cdb_sc_blkmod));		\
 	memset((char *)&CSD->gvstats_rec, 0, SIZEOF(CSD->gvstats_rec));				\
+	memset((char *)&CSD->gvstats_hist, 0, SIZEOF(CSD->gvstats_hist));			\
 	gvstats_rec_csd2cnl(CSA);	/* we update gvstats in cnl */				\
 } MBEND
 
@@ -1863,6 +1918,10 @@ MBSTART {														\
 #define	SGMNT_DATA_OFFSET_R134_reorg_sleep_nsec	7168	/* offset of "reorg_sleep_nsec" prior to YottaDB r1.36 */
 #define	SGMNT_DATA_OFFSET_R134_max_procs	7176	/* offset of "max_procs" prior to YottaDB r1.36 */
 
+/* Changed block maps in the file header (see gds_cbt.h) */
+#define	CBT_GENS	2	/* number of changed block maps */
+#define	CBT_MAP_BYTES	256	/* size of each changed block map */
+
 /* This is the structure describing a segment. It is used as a database file header (for MM or BG access methods).
  * The overloaded fields for MM and BG are n_bts, bt_buckets. */
 
@@ -2138,12 +2197,32 @@ typedef struct sgmnt_data_struct
 	int4		filler_5k;
 	/************* SECSHR_DB_CLNUP RELATED FIELDS (now moved to node_local) ***********/
 	int4		secshr_ops_index_filler;
-	int4		secshr_ops_array_filler[249];
+	int4		secshr_ops_array_filler[111];
 	/************** YottaDB specific fields *********************
 	 * We keep these fields at the end of what used to be a filler section (SECSHR_DB_CLNUP fields).
 	 * The hope is that even if GT.M starts using this filler section, they will use the first half so
 	 * YottaDB new fields will be added from the end of this section.
 	 */
+	boolean_t	asyncio_uring;		/* If TRUE (and "asyncio" is TRUE), database writes are issued through io_uring
+						 * instead of Linux AIO. Added in YottaDB r1.38.
+						 */
+	boolean_t	crit_queue;		/* If TRUE, processes waiting for crit spin on slots of their own and crit is
+						 * preferably handed to a waiter on the NUMA node of the releasing process.
+						 * Added in YottaDB r1.38.
+						 */
+	int4		blk_compress;		/* zlib level (1-9) blocks are written compressed with, 0 if not compressed
+						 * (MUPIP SET -COMPRESSION). Added in YottaDB r1.38.
+						 */
+	boolean_t	blk_compress_used;	/* TRUE once "blk_compress" has been set, i.e. the file may hold compressed blocks.
+						 * Added in YottaDB r1.38.
+						 */
+	trans_num	cbt_tn[CBT_GENS];	/* Transaction number from which "cbt_map" of the same index records the block groups
+						 * updated, 0 if that map is not in use (see gds_cbt.h). Needs 8-byte alignment.
+						 * Added in YottaDB r1.38.
+						 */
+	uint4		cbt_shift;		/* A bit of "cbt_map" covers 2**cbt_shift local bitmaps. Added in YottaDB r1.38. */
+	uint4		cbt_filler;
+	unsigned char	cbt_map[CBT_GENS][CBT_MAP_BYTES];	/* Changed block maps. Added in YottaDB r1.38. */
 	max_procs_t	max_procs;		/* count of the largest number of processes accessing the database
 						 * along with a timestamp. Needs 8-byte alignment.
 						 * This used to be at offset "SGMNT_DATA_OFFSET_R134_max_procs" in YottaDB r1.34.
@@ -2186,7 +2265,8 @@ typedef struct sgmnt_data_struct
 	 * because the former GVSTATS area (above) will be available for reuse.
 	 */
 	gvstats_rec_csd_t	gvstats_rec;	/* As of GTM-8863 1304 bytes == 163 counters */
-	char			filler_8k[1464 - SIZEOF(gvstats_rec_csd_t)];
+	gvstats_hist_t		gvstats_hist;	/* latency histograms; saved and restored along with gvstats_rec */
+	char			filler_8k[1464 - SIZEOF(gvstats_rec_csd_t) - SIZEOF(gvstats_hist_t)];
 	/********************************************************/
 	/* Master bitmap immediately follows. Tells whether the local bitmaps have any free blocks or not. */
 } sgmnt_data;
@@ -2639,6 +2719,13 @@ typedef struct	sgmnt_addrs_struct
 						 * global gvstats_rec_t. All access to process stats should be through this ptr.
 						 */
 	gvstats_rec_t		gvstats_rec;
+	gvstats_hist_t		gvstats_hist;	/* process-private latency histograms */
+	trans_num		ra_parent_tn;	/* tn of ra_parent when db_readahead last read ahead its children */
+	block_id		ra_parent;	/* index block whose children were last read ahead by db_readahead */
+	uint4			ra_upto;	/* offset in ra_parent of the first child record not yet read ahead */
+	uint4			ra_next;	/* # of blocks read ahead so far; next ra_blks slot is ra_next % DB_READAHEAD_MAX */
+	uint4			ra_dsk_read;	/* # of BG disk reads; see DB_READAHEAD_DSK_READ */
+	block_id		ra_blks[DB_READAHEAD_MAX];	/* blocks recently read ahead and not yet read; 0 if unused */
 	trans_num		dbsync_timer_tn;/* copy of csa->ti->curr_tn when csa->dbsync_timer became TRUE.
 						 * used to check if any updates happened in between when we flushed all
 						 * dirty buffers to disk and when the idle flush timer (5 seconds) popped.
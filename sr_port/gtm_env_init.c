@@ -3,7 +3,7 @@
  * Copyright (c) 2004-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -53,6 +53,8 @@
 #include "repl_filter.h"
 #include "gds_blk_upgrade.h"
 #include "mlkdef.h"
+#include "gvcst_blk_rstrt.h"
+#include "stp_parms.h"
 
 #ifdef DEBUG
 #  define INITIAL_DEBUG_LEVEL GDL_Simple
@@ -96,7 +98,7 @@ void	gtm_env_init(void)
 	int4			status;
 	mstr			trans;
 	uint4			tdbglvl, tmsock, reservesize, memsize, cachent, trctblsize, trctblbytes;
-	uint4			max_threads, max_procs;
+	uint4			fsync_delay, lock_stripes, max_threads, max_procs, readahead, rstrt_entries, wbuffer;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -248,6 +250,24 @@ void	gtm_env_init(void)
 		/* If ydb_blkupgrade_flag is outside of valid range of choices, set it back to default value */
 		if ((UPGRADE_NEVER != ydb_blkupgrade_flag) && (UPGRADE_ALWAYS != ydb_blkupgrade_flag))
 			ydb_blkupgrade_flag = UPGRADE_IF_NEEDED;
+		/* Initialize the number of blocks whose restart point index "gvcst_search_blk" can keep (0 disables it) */
+		rstrt_entries = ydb_trans_numeric(YDBENVINDX_BLK_RSTRT_INDEX_SIZE, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		TREF(blk_rstrt_entries) = !is_defined ? BLK_RSTRT_DEFAULT_ENTRIES : MIN(rstrt_entries, BLK_RSTRT_MAX_ENTRIES);
+		/* Initialize how long (in microseconds) a "jnl_fsync" leader waits for concurrent committers (0 by default) */
+		fsync_delay = ydb_trans_numeric(YDBENVINDX_JNL_FSYNC_DELAY, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		TREF(jnl_fsync_delay) = is_defined ? MIN(fsync_delay, JNL_FSYNC_MAX_DELAY) : 0;
+		/* Initialize the number of stripes the lock space is split into when this process creates the shared memory */
+		lock_stripes = ydb_trans_numeric(YDBENVINDX_LOCK_STRIPES, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		TREF(lock_stripes) = is_defined ? MIN(lock_stripes, MLK_MAX_STRIPES) : 1;
+		/* Initialize whether a lock release wakes only the longest waiting blocked process in a new lock space */
+		TREF(lock_fifo) = ydb_logical_truth_value(YDBENVINDX_LOCK_FIFO, FALSE, NULL);
+		/* Initialize how many nursery-only stringpool collections can run between two full collections */
+		TREF(stp_gcol_minor_max) = ydb_trans_numeric(YDBENVINDX_STP_GCOL_MINOR_MAX, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		if (!is_defined)
+			TREF(stp_gcol_minor_max) = STP_GCOL_MINOR_MAX;
+		/* Initialize how many right siblings a sequential scan that goes to disk reads ahead (0 disables readahead) */
+		readahead = ydb_trans_numeric(YDBENVINDX_READAHEAD, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		TREF(readahead_blks) = is_defined ? MIN(readahead, DB_READAHEAD_MAX) : DB_READAHEAD_DEFAULT;
 		/* Initialize whether database file extensions need to be logged in the operator log */
 		ret = ydb_logical_truth_value(YDBENVINDX_DBFILEXT_SYSLOG_DISABLE, FALSE, &is_defined);
 		if (is_defined)
@@ -262,6 +282,9 @@ void	gtm_env_init(void)
 											IGNORE_ERRORS_TRUE, NULL);
 		if (0 > TREF(ydb_socket_keepalive_idle))
 			TREF(ydb_socket_keepalive_idle) = 0;
+		/* Initialize the size of the output buffer WRITEs to plain (non-TLS) sockets collect in (0 writes unbuffered) */
+		wbuffer = ydb_trans_numeric(YDBENVINDX_SOCKET_WBUFFER, &is_defined, IGNORE_ERRORS_TRUE, NULL);
+		TREF(socket_wbuffer_size) = is_defined ? MIN(wbuffer, MAX_SOCKET_BUFFER_SIZE) : 0;
 		/* Initialize storage to allocate and keep in our back pocket in case run out of memory */
 		outOfMemoryMitigateSize = GTM_MEMORY_RESERVE_DEFAULT;
 		reservesize = ydb_trans_numeric(YDBENVINDX_MEMORY_RESERVE, &is_defined, IGNORE_ERRORS_TRUE, NULL);
@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -94,6 +94,13 @@ THREADGBLDEF(xecute_literal_parse,		boolean_t)			/* flag TRUE when trying what i
 
 /* Database */
 THREADGBLDEF(dbinit_max_delta_secs,		uint4)				/* max time before we bail out in db_init */
+THREADGBLDEF(blk_rstrt_entries,		uint4)				/* # of blocks whose restart points are kept */
+THREADGBLDEF(blk_rstrt_table,			struct blk_rstrt_entry_struct *)	/* restart point index (gvcst_blk_rstrt.c) */
+THREADGBLDEF(jnl_fsync_delay,			uint4)				/* usecs a jnl fsync waits for more data */
+THREADGBLDEF(lock_stripes,			uint4)				/* # of stripes a new lock space is split into */
+THREADGBLDEF(lock_fifo,			boolean_t)			/* a new lock space wakes one waiter at a time */
+THREADGBLDEF(stp_gcol_minor_max,		uint4)				/* max minor stringpool collections in a row */
+THREADGBLDEF(readahead_blks,			uint4)				/* # of right siblings a scan reads ahead */
 THREADGBLDEF(dollar_zmaxtptime, 		int4)				/* tp timeout in seconds */
 THREADGBLDEF(ztimeout_deferred,			boolean_t)			/* ztimeout occured but was deferred */
 THREADGBLDEF(in_ztimeout,			boolean_t)
@@ -282,6 +289,7 @@ THREADGBLDEF(gvcst_statsDB_open_ch_active,	boolean_t)			/* Condition handler is
 THREADGBLDEF(in_zwrite,				boolean_t)			/* ZWrite is active */
 THREADGBLDEF(is_socketpool,			boolean_t)			/* True when device-to-be-opened is socketpool */
 THREADGBLDEF(ydb_socket_keepalive_idle,		int)				/* Initialized from $ydb_socket_keepalive_idle */
+THREADGBLDEF(socket_wbuffer_size,		uint4)				/* Initialized from $ydb_socket_wbuffer */
 THREADGBLDEF(in_mupip_integ,			boolean_t)			/* To let DO_DB_HDR_CHECK skip DBFLCORRP */
 THREADGBLDEF(instance_frozen_crit_skipped,	boolean_t)			/* To indicate Instance Freeze is on, CRIT skipped*/
 THREADGBLDEF(integ_cannotskip_crit,		boolean_t)			/* indicates whether a SKIP CRIT is allowed */
@@ -331,6 +339,8 @@ THREADGBLDEF(rts_error_depth,			unsigned int)			/* Recursion level of rts_error_
 THREADGBLDEF(sapi_query_node_subs,		mstr *)				/* -> Array of YDB_MAX_SUBS mstrs holding subs
 										 * .. to return to ydb_node_*_s(). */
 THREADGBLDEF(sapi_query_node_subs_cnt,		int)				/* Count of subs filled in */
+THREADGBLDEF(sapi_cursor_list,			struct sapi_cursor_struct *)	/* Cursors opened by ydb_cursor_open_s() */
+THREADGBLDEF(sapi_cursor_last_id,		gtm_uint64_t)			/* Handle of the last cursor opened */
 THREADGBLAR1DEF(zpeek_regname,			char,		NAME_ENTRY_SZ)	/* Last $ZPEEK() region specified */
 THREADGBLDEF(zpeek_regname_len,			int)				/* Length of zpeekop_regname */
 THREADGBLDEF(zpeek_reg_ptr,			gd_region *)			/* Resolved pointer for zpeekop_regname */
@@ -0,0 +1,213 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "gdsblk.h"
+#include "copy.h"
+#include "min_max.h"
+#include "memcoherency.h"
+#include "gvcst_blk_rstrt.h"
+
+GBLREF	sgmnt_addrs	*cs_addrs;
+
+#define	BLK_RSTRT_HASH(CSA, BLK, NENTRIES)	\
+	((uint4)((((UINTPTR_T)(CSA) >> 4) ^ ((gtm_uint64_t)(BLK) * 2654435761U)) % (NENTRIES)))
+
+STATICFNDCL boolean_t gvcst_blk_rstrt_build(sgmnt_addrs *csa, blk_rstrt_entry *entry, blk_hdr_ptr_t bp, cache_rec_ptr_t cr);
+
+/* Returns the offset of the record from which "gvcst_search_blk" can resume its scan for "pKey" or 0 if the scan has to start
+ * at the beginning of the block. On a non-zero return, "*rec_len" holds the size of that record and "*match" the number of
+ * leading bytes its key has in common with "pKey". The key of the returned record is guaranteed to be less than "pKey".
+ */
+int	gvcst_blk_rstrt_lookup(gv_key *pKey, srch_blk_status *pStat, unsigned short *rec_len, int *match)
+{
+	blk_rstrt_entry		*entry, *table;
+	blk_rstrt_point		*point;
+	blk_hdr_ptr_t		bp;
+	cache_rec_ptr_t		cr;
+	sgmnt_addrs		*csa;
+	unsigned char		*key, *targ;
+	int			best, best_match, cmplen, hi, i, lo, mid, targlen;
+	uint4			nentries;
+	unsigned short		rsiz;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	csa = cs_addrs;
+	cr = pStat->cr;
+	bp = (blk_hdr_ptr_t)pStat->buffaddr;
+	/* Only shared BG global buffers qualify. A buffer private to this process (e.g. the update array copy of a block
+	 * in TP) can hold different contents under the same block number and block transaction number.
+	 */
+	if ((NULL == cr) || (NULL == csa) || ((sm_uc_ptr_t)bp != (sm_uc_ptr_t)GDS_ANY_REL2ABS(csa, cr->buffaddr)))
+		return 0;
+	nentries = TREF(blk_rstrt_entries);
+	assert(nentries);
+	if (NULL == (table = TREF(blk_rstrt_table)))
+	{
+		table = (blk_rstrt_entry *)malloc(SIZEOF(blk_rstrt_entry) * nentries);
+		memset(table, 0, SIZEOF(blk_rstrt_entry) * nentries);
+		TREF(blk_rstrt_table) = table;
+	}
+	entry = &table[BLK_RSTRT_HASH(csa, pStat->blk_num, nentries)];
+	if ((entry->csa != csa) || (entry->blk_num != pStat->blk_num) || (entry->buffaddr != (sm_uc_ptr_t)bp)
+			|| (entry->tn != bp->tn) || (entry->bsiz != bp->bsiz) || (entry->levl != bp->levl))
+	{	/* First search of this block state (or a collision). Remember the block and build its index only if it is
+		 * searched again. This way a one-time scan (e.g. MUPIP EXTRACT) does not pay for building indices.
+		 */
+		entry->csa = csa;
+		entry->buffaddr = (sm_uc_ptr_t)bp;
+		entry->blk_num = pStat->blk_num;
+		entry->tn = bp->tn;
+		entry->bsiz = bp->bsiz;
+		entry->levl = bp->levl;
+		entry->built = FALSE;
+		entry->npoints = 0;
+		return 0;
+	}
+	if (!entry->built)
+	{
+		if (!gvcst_blk_rstrt_build(csa, entry, bp, cr))
+		{
+			entry->csa = NULL;	/* block changed (or is changing) under us; start afresh on the next search */
+			return 0;
+		}
+		entry->built = TRUE;
+	}
+	/* Binary search for the last restart point whose key is less than the target key */
+	targ = pKey->base;
+	targlen = pKey->end + 1;	/* + 1 for the second KEY_DELIMITER byte */
+	best = -1;
+	best_match = 0;
+	for (lo = 0, hi = entry->npoints - 1; lo <= hi; )
+	{
+		mid = (lo + hi) / 2;
+		point = &entry->points[mid];
+		key = entry->keys + point->keyoff;
+		cmplen = MIN(point->keylen, targlen);
+		for (i = 0; (i < cmplen) && (key[i] == targ[i]); i++)
+			;
+		if ((i < cmplen) && (key[i] < targ[i]))
+		{
+			best = mid;
+			best_match = i;
+			lo = mid + 1;
+		} else
+			hi = mid - 1;
+	}
+	if (0 > best)
+		return 0;
+	point = &entry->points[best];
+	GET_USHORT(rsiz, &((rec_hdr_ptr_t)((sm_uc_ptr_t)bp + point->offset))->rsiz);
+	if (rsiz != point->rsiz)
+		return 0;
+	*rec_len = rsiz;
+	*match = best_match;
+	return point->offset;
+}
+
+/* Walks the block expanding every key and records every Nth one as a restart point. The block is read out of crit so the
+ * index is kept only if the cache record was not being updated (cr->in_tend), still holds the same block and the block
+ * transaction number did not change during the walk. "gvcst_blk_build" changes the block transaction number before it
+ * changes the block contents and "cr->in_tend" is set before either, so this rules out a half-updated block.
+ */
+STATICFNDEF boolean_t gvcst_blk_rstrt_build(sgmnt_addrs *csa, blk_rstrt_entry *entry, blk_hdr_ptr_t bp, cache_rec_ptr_t cr)
+{
+	blk_rstrt_point		*point;
+	sm_uc_ptr_t		pRec, pTop, src, srctop;
+	unsigned char		*newkeys;
+	unsigned char		keybuf[MAX_KEY_SZ + 1];
+	int4			cycle;
+	int			cmpc, dst, interval, keylen, nrecs, npoints, recno;
+	uint4			keys_used, needed;
+	unsigned short		rsiz;
+
+	if (cr->in_tend || (cr->blk != entry->blk_num))
+		return FALSE;
+	cycle = cr->cycle;
+	SHM_READ_MEMORY_BARRIER;
+	if ((bp->tn != entry->tn) || (SIZEOF(blk_hdr) > entry->bsiz) || (csa->hdr->blk_size < entry->bsiz))
+		return FALSE;
+	pTop = (sm_uc_ptr_t)bp + entry->bsiz;
+	/* First pass : count the records so restart points can be spread evenly across the block */
+	for (nrecs = 0, pRec = (sm_uc_ptr_t)bp + SIZEOF(blk_hdr); pRec < pTop; pRec += rsiz, nrecs++)
+	{
+		GET_USHORT(rsiz, &((rec_hdr_ptr_t)pRec)->rsiz);
+		if (SIZEOF(rec_hdr) > rsiz)
+			return FALSE;
+	}
+	if (pRec != pTop)
+		return FALSE;
+	interval = MAX(BLK_RSTRT_MIN_INTERVAL, DIVIDE_ROUND_UP(nrecs, BLK_RSTRT_MAX_POINTS + 1));
+	if (NULL == entry->points)
+		entry->points = (blk_rstrt_point *)malloc(SIZEOF(blk_rstrt_point) * BLK_RSTRT_MAX_POINTS);
+	/* Second pass : expand keys */
+	keylen = 0;
+	keys_used = 0;
+	npoints = 0;
+	for (recno = 0, pRec = (sm_uc_ptr_t)bp + SIZEOF(blk_hdr); pRec < pTop; pRec += rsiz, recno++)
+	{
+		GET_USHORT(rsiz, &((rec_hdr_ptr_t)pRec)->rsiz);
+		if (bp->levl && (BSTAR_REC_SIZE == rsiz))
+			break;		/* star key record (last record of an index block) has no key */
+		EVAL_CMPC2((rec_hdr_ptr_t)pRec, cmpc);
+		if (cmpc > keylen)
+			return FALSE;
+		src = pRec + SIZEOF(rec_hdr);
+		srctop = pRec + rsiz;
+		if (srctop > pTop)
+			return FALSE;
+		for (dst = cmpc; ; )
+		{
+			if ((src >= srctop) || (SIZEOF(keybuf) <= dst))
+				return FALSE;
+			keybuf[dst++] = *src++;
+			if ((2 <= dst) && (KEY_DELIMITER == keybuf[dst - 1]) && (KEY_DELIMITER == keybuf[dst - 2]))
+				break;
+		}
+		keylen = dst;
+		if (!recno || (recno % interval) || (BLK_RSTRT_MAX_POINTS <= npoints))
+			continue;
+		needed = keys_used + keylen;
+		if (needed > entry->keys_alloc)
+		{
+			needed = MAX(needed, 2 * entry->keys_alloc);
+			newkeys = (unsigned char *)malloc(needed);
+			if (keys_used)
+				memcpy(newkeys, entry->keys, keys_used);
+			if (NULL != entry->keys)
+				free(entry->keys);
+			entry->keys = newkeys;
+			entry->keys_alloc = needed;
+		}
+		point = &entry->points[npoints++];
+		point->offset = (unsigned short)(pRec - (sm_uc_ptr_t)bp);
+		point->rsiz = rsiz;
+		point->keylen = (unsigned short)keylen;
+		point->keyoff = keys_used;
+		memcpy(entry->keys + keys_used, keybuf, keylen);
+		keys_used += keylen;
+	}
+	SHM_READ_MEMORY_BARRIER;
+	if (cr->in_tend || (cr->blk != entry->blk_num) || (cr->cycle != cycle) || (bp->tn != entry->tn))
+		return FALSE;
+	entry->npoints = npoints;
+	return TRUE;
+}
@@ -0,0 +1,59 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef GVCST_BLK_RSTRT_H_INCLUDED
+#define GVCST_BLK_RSTRT_H_INCLUDED
+
+/* Keys in GDS blocks are prefix-compressed so "gvcst_search_blk" has to scan a block from its first record. For large blocks
+ * that are searched repeatedly (index blocks and hot leaf blocks), a process-private "restart point" index remembers the fully
+ * expanded key of every Nth record of the block. "gvcst_search_blk" binary searches those keys for the last one that is less
+ * than the target key and resumes its linear scan from that record instead of from the start of the block.
+ *
+ * The index is kept in a small direct-mapped table (one entry per block) whose size is controlled by the
+ * "ydb_blk_rstrt_index_size" environment variable (0 disables the index). An entry is only trusted if the block number,
+ * global buffer address, block transaction number, block size and level all match what was seen when the entry was built,
+ * and entries are only built from a shared (BG) global buffer that no process was updating while the entry was built.
+ * Like the linear scan, the result is still subject to the usual transaction validation.
+ */
+
+#define	BLK_RSTRT_DEFAULT_ENTRIES	128		/* default number of blocks whose restart points are remembered */
+#define	BLK_RSTRT_MAX_ENTRIES		(1 << 16)	/* upper bound for "ydb_blk_rstrt_index_size" */
+#define	BLK_RSTRT_MIN_BSIZ		4096		/* blocks with fewer used bytes than this are always scanned linearly */
+#define	BLK_RSTRT_MIN_INTERVAL		16		/* minimum number of records between two restart points */
+#define	BLK_RSTRT_MAX_POINTS		128		/* maximum number of restart points per block */
+
+typedef struct
+{
+	unsigned short	offset;		/* offset of the restart record from the start of the block */
+	unsigned short	rsiz;		/* size of the restart record */
+	unsigned short	keylen;		/* length of the expanded key (including both terminating KEY_DELIMITERs) */
+	uint4		keyoff;		/* offset of the expanded key in "keys" of the owning blk_rstrt_entry */
+} blk_rstrt_point;
+
+typedef struct blk_rstrt_entry_struct
+{
+	sgmnt_addrs	*csa;		/* region the block belongs to. NULL if the entry is unused */
+	sm_uc_ptr_t	buffaddr;	/* global buffer the block was in */
+	block_id	blk_num;
+	trans_num	tn;		/* block transaction number */
+	uint4		bsiz;		/* block size (from the block header) */
+	int4		levl;		/* block level */
+	boolean_t	built;		/* FALSE if the block was seen only once so far (index is built on the second search) */
+	int4		npoints;	/* number of valid entries in "points" */
+	blk_rstrt_point	*points;	/* allocated to hold BLK_RSTRT_MAX_POINTS entries */
+	unsigned char	*keys;		/* expanded keys of the restart points */
+	uint4		keys_alloc;	/* allocated size of "keys" */
+} blk_rstrt_entry;
+
+int	gvcst_blk_rstrt_lookup(gv_key *pKey, srch_blk_status *pStat, unsigned short *rec_len, int *match);
+
+#endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -29,6 +29,7 @@
 #include "gvcst_protos.h"	/* for gvcst_search_tail,gvcst_search_blk prototype */
 #include "min_max.h"
 #include "gvcst_expand_key.h"
+#include "gvcst_blk_rstrt.h"
 #include "send_msg.h"
 #include "cert_blk.h"
 
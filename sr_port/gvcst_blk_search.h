@@ -3,7 +3,7 @@
  * Copyright (c) 2015-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -73,6 +73,9 @@ GBLREF	uint4			dollar_tlevel;
 	unsigned short		nRecLen;
 #	ifdef GVCST_SEARCH_BLK
 	boolean_t		level0;
+#		ifndef GVCST_SEARCH_EXPAND_PREVKEY
+		int		rstrt_offset, rstrt_match;
+#		endif
 #	endif
 #	ifdef GVCST_SEARCH_EXPAND_PREVKEY
 	int			prevKeyCmpLen;	/* length of compressed portion of prevKey stored in gv_altkey->base */
@@ -143,6 +146,21 @@ GBLREF	uint4			dollar_tlevel;
 	nMatchCnt = 0;
 	nTargLen = (int)pKey->end;
 	nTargLen++;	/* for the terminating NUL on the key */
+#		ifndef GVCST_SEARCH_EXPAND_PREVKEY
+		/* For large blocks, skip past records known to sort before the target key using the restart points
+		 * (if any) remembered for this block (see gvcst_blk_rstrt.h). Not done in the final retry as the block
+		 * cannot change then and the restart point index is not maintained in crit.
+		 */
+		if (TREF(blk_rstrt_entries) && (BLK_RSTRT_MIN_BSIZ <= (pTop - pBlkBase)) && (CDB_STAGNATE > t_tries)
+			&& (0 != (rstrt_offset = gvcst_blk_rstrt_lookup(pKey, pStat, &nRecLen, &rstrt_match))))
+		{
+			pRecBase = pBlkBase + rstrt_offset;
+			pPrevRec = pRecBase;
+			nMatchCnt = rstrt_match;
+			pCurrTarg += rstrt_match;
+			nTargLen -= rstrt_match;
+		}
+#		endif
 #	endif
 #	ifdef GVCST_SEARCH_TAIL
 	pRecBase = pBlkBase + pStat->curr_rec.offset;
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -75,12 +75,15 @@ boolean_t gvcst_get(mval *v)
 	sm_uc_ptr_t	sn_ptr;
 	int		debug_len;
 	int		save_dollar_tlevel;
+	gtm_uint64_t	get_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
+	get_start = GVSTATS_HIST_START(cs_addrs);
 	gotit = gvcst_get2(v, NULL);
 	INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_get, (gtm_uint64_t) 1);
+	GVSTATS_HIST_ADD(cs_addrs, cs_addrs->nl, h_get, get_start);
 	WBTEST_ONLY(WBTEST_QUERY_HANG,
 		LONG_SLEEP(2);
 	);
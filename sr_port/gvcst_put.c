@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -283,6 +283,8 @@ void	gvcst_put(mval *val)
 	boolean_t			save_in_gvcst_incr; /* gvcst_put2 sets this FALSE, so save it in case we need to back out */
 	span_parms			parms;
 	unsigned char			fp_flags;
+	sgmnt_addrs			*csa;
+	gtm_uint64_t			set_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -299,9 +301,12 @@ void	gvcst_put(mval *val)
 	save_in_gvcst_incr = in_gvcst_incr;
 	if (fits)
 	{
+		csa = cs_addrs;	/* note down in case triggers invoked by the update leave cs_addrs pointing elsewhere */
+		set_start = GVSTATS_HIST_START(csa);
 		gvcst_put2(val, &parms);
 		if (!parms.span_status)
 		{
+			GVSTATS_HIST_ADD(csa, csa->nl, h_set, set_start);
 			assert(save_dollar_tlevel == dollar_tlevel);
 			return; /* We've successfully set a normal non-spanning global. */
 		}
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -19,10 +22,12 @@
 #include "gdsbt.h"
 #include "gdsfhead.h"
 #include "copy.h"
+#include "filestruct.h"
 
 /* Include prototypes */
 #include "t_qread.h"
 #include "gvcst_protos.h"	/* for gvcst_search_blk,gvcst_rtsib prototype */
+#include "db_readahead.h"
 
 /* construct a new array which is the path to the
    right sibling of the leaf of the old array
@@ -47,6 +52,7 @@ enum cdb_sc	gvcst_rtsib(srch_hist *full_hist, int level)
 	unsigned short	rec_size, temp_short;
 	sm_uc_ptr_t	buffer_address;
 	int4		cycle;
+	uint4		dsk_reads;
 
 	new_base = &full_hist->h[level];
 	old = old_base = &gv_target->hist.h[level];
@@ -100,6 +106,7 @@ enum cdb_sc	gvcst_rtsib(srch_hist *full_hist, int level)
 		return cdb_sc_rmisalign;
 	}
 	rp = (rec_hdr_ptr_t)(old->buffaddr + temp_short);
+	dsk_reads = cs_addrs->ra_dsk_read;
 	while (--new >= new_base)
 	{
 		--old;
@@ -125,5 +132,8 @@ enum cdb_sc	gvcst_rtsib(srch_hist *full_hist, int level)
 		new->curr_rec.offset = SIZEOF(blk_hdr);
 		rp = (rec_hdr_ptr_t)(buffer_address + SIZEOF(blk_hdr));
 	}
+	/* A scan that had to go to disk to get here will likely need the following siblings from disk too */
+	if (dsk_reads != cs_addrs->ra_dsk_read)
+		db_readahead(&full_hist->h[level + 1]);
 	return cdb_sc_normal;
 }
@@ -3,6 +3,9 @@
  * Copyright (c) 2008-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -25,18 +28,21 @@
 void	gvstats_rec_csd2cnl(sgmnt_addrs *csa)
 {
 	memcpy(&csa->nl->gvstats_rec, &csa->hdr->gvstats_rec, SIZEOF(gvstats_rec_csd_t));
+	memcpy(&csa->nl->gvstats_hist, &csa->hdr->gvstats_hist, SIZEOF(gvstats_hist_t));
 }
 
 /* Copy shared or private back to header stats.  Note that we do not copy ("save") the WS stats */
 void	gvstats_rec_cnl2csd(sgmnt_addrs *csa)
 {
-	size_t ws_stats_size;
-
-	ws_stats_size = ((char *) &(csa->nl->gvstats_rec.WS_STATS_END) - (char *) &(csa->nl->gvstats_rec.WS_STATS_BEGIN))
-		+ SIZEOF(gtm_uint64_t);
+	size_t ws_stats_begin, ws_stats_end;
 
-	/* This assumes no savable stats after the WS_* stats.  Address that here if this changes */
-	memcpy(&csa->hdr->gvstats_rec, &csa->nl->gvstats_rec, SIZEOF(gvstats_rec_csd_t) - ws_stats_size);
+	ws_stats_begin = OFFSETOF(gvstats_rec_csd_t, WS_STATS_BEGIN);
+	ws_stats_end = OFFSETOF(gvstats_rec_csd_t, WS_STATS_END) + SIZEOF(gtm_uint64_t);
+	/* Save the stats before and after the WS_* stats */
+	memcpy(&csa->hdr->gvstats_rec, &csa->nl->gvstats_rec, ws_stats_begin);
+	memcpy((char *)&csa->hdr->gvstats_rec + ws_stats_end, (char *)&csa->nl->gvstats_rec + ws_stats_end,
+		SIZEOF(gvstats_rec_csd_t) - ws_stats_end);
+	memcpy(&csa->hdr->gvstats_hist, &csa->nl->gvstats_hist, SIZEOF(gvstats_hist_t));
 }
 
 void	gvstats_rec_upgrade(sgmnt_addrs *csa)
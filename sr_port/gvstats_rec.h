@@ -3,6 +3,9 @@
  * Copyright (c) 2008-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -13,6 +16,8 @@
 #ifndef GVSTATS_REC_H_INCLUDED
 #define GVSTATS_REC_H_INCLUDED
 
+#include "gtm_time.h"
+
 /* Note gvstats_rec exists in both sgmnt_data (file header) and in node_local. The reason
  * for this is so that gvstats can be updated by read-only processes which would not be
  * able to update the read-only file header. The gvstats in node_local are the ones that
@@ -46,4 +51,46 @@ typedef struct gvstats_rec_csd_struct
 #undef IS_CSD_STATS
 #undef TAB_GVSTATS_REC
 
+/* Latency histograms. Like gvstats_rec, these exist in the file header, in node_local (database-wide) and in sgmnt_addrs
+ * (process-private). Bucket 0 counts operations that took less than 2**GVSTATS_HIST_MIN_SHIFT nanoseconds, bucket N counts
+ * those that took [2**(GVSTATS_HIST_MIN_SHIFT+N-1), 2**(GVSTATS_HIST_MIN_SHIFT+N)) nanoseconds and the last bucket is open
+ * ended. With the values below that is < ~1 usec in bucket 0 through >= ~268 msec in bucket 19.
+ */
+#define	GVSTATS_HIST_BUCKETS	20
+#define	GVSTATS_HIST_MIN_SHIFT	10
+
+#define	TAB_GVSTATS_HIST(A,B,C)	A##_hist,
+enum gvstats_hist_type
+{
+#include "tab_gvstats_hist.h"
+n_gvstats_hist_types
+};
+#undef TAB_GVSTATS_HIST
+
+typedef struct gvstats_hist_struct
+{
+#define	TAB_GVSTATS_HIST(A,B,C)	gtm_uint64_t	A[GVSTATS_HIST_BUCKETS];
+#include "tab_gvstats_hist.h"
+} gvstats_hist_t;
+#undef TAB_GVSTATS_HIST
+
+/* Returns a monotonic timestamp in nanoseconds for use as the start or end time of a histogram sample */
+static inline gtm_uint64_t gvstats_hist_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((gtm_uint64_t)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec;
+}
+
+/* Returns the histogram bucket for an elapsed time of "nsec" nanoseconds */
+static inline int gvstats_hist_bucket(gtm_uint64_t nsec)
+{
+	int	bucket;
+
+	for (bucket = 0, nsec >>= GVSTATS_HIST_MIN_SHIFT; nsec && ((GVSTATS_HIST_BUCKETS - 1) > bucket); nsec >>= 1)
+		bucket++;
+	return bucket;
+}
+
 #endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -70,6 +70,7 @@ void iosocket_close(io_desc *iod, mval *pp)
 	d_socket_struct	*dsocketptr;
 	char		sock_handle[MAX_HANDLE_LEN], *errp;
 	int4		start, end, index;
+	int		rc;
 	int		p_offset = 0;
 	boolean_t	socket_destroy = FALSE;
 	boolean_t	ch_set;
@@ -151,6 +152,8 @@ void iosocket_close(io_desc *iod, mval *pp)
 	}
 	if (!socket_specified)
 	{
+		if (FD_INVALID != dsocketptr->epoll_fd)
+			CLOSEFILE_RESET(dsocketptr->epoll_fd, rc);	/* resets "dsocketptr->epoll_fd" to FD_INVALID */
 		iod->state = dev_closed;
 		if (socket_destroy)
 		{
@@ -209,6 +212,8 @@ void iosocket_close_range(d_socket_struct *dsocketptr, int start, int end, boole
 			}
 			if ((0 < socketptr->obuffer_size) && ((0 >= status) || (0 != socketptr->obuffer_errno)))
 				iosocket_buffer_error(socketptr);	/* pre-existing error or error flushing buffer */
+			/* The epoll set is shared with the parent of a pipe child so only the owner removes sockets from it */
+			iosocket_epoll_remove(dsocketptr, socketptr);
 #			ifdef	GTM_TLS
 			if (socketptr->tlsenabled)
 			{
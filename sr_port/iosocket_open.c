@@ -3,7 +3,7 @@
  * Copyright (c) 2012-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -151,6 +151,7 @@ short	iosocket_open(io_log_name *dev, mval *pp, int file_des, mval *mspace, uint
 		ioptr->length	= TCPDEF_LENGTH;
 		ioptr->wrap	= TRUE;
 		dsocketptr->current_socket = -1;	/* 1st socket is 0 */
+		dsocketptr->epoll_fd = FD_INVALID;	/* created by the first WRITE /WAIT */
 		if ((2 > file_des) && (0 <= file_des) && (!io_std_device.in || !io_std_device.out))
 			/* called from io_init */
 			is_principal = TRUE;
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -116,10 +116,10 @@ ssize_t iosocket_snr(socket_struct *socketptr, void *buffer, size_t maxlength, i
 		return bytesread;
 	}
 	/* Decide on which buffer to use and the size of the recv */
-	if (socketptr->buffer_size > maxlength)
+	if (socketptr->buffer_alloc > maxlength)
 	{
 		recvbuff = socketptr->buffer;
-		recvsize = socketptr->buffer_size;
+		recvsize = socketptr->buffer_alloc;
 	} else
 	{
 		recvbuff = buffer;
@@ -137,6 +137,7 @@ ssize_t iosocket_snr(socket_struct *socketptr, void *buffer, size_t maxlength, i
 	{	/* Got something this time */
 		if (recvbuff == socketptr->buffer)
 		{
+			SOCKET_BUFFER_GROW(socketptr, bytesread);
 			if (bytesread <= maxlength)
 				memcpy(buffer, socketptr->buffer, bytesread);
 			else
@@ -290,7 +291,7 @@ ssize_t iosocket_snr_utf_prebuffer(io_desc *iod, socket_struct *socketptr, int f
 	{	/* Buffer is empty, read at least one char into it so we can check how many we need */
 		do
 		{
-			bytesread = (int)iosocket_snr_io(socketptr, socketptr->buffer, socketptr->buffer_size, flags,
+			bytesread = (int)iosocket_snr_io(socketptr, socketptr->buffer, socketptr->buffer_alloc, flags,
 							 time_for_read);
 			DBGSOCK_ONLY2(real_errno = errno);
 			DBGSOCK2((stdout, "socsnrupb: Buffer empty - bytes read: %d  errno: %d\n", bytesread, real_errno));
@@ -330,6 +331,7 @@ ssize_t iosocket_snr_utf_prebuffer(io_desc *iod, socket_struct *socketptr, int f
 		}
 		socketptr->buffered_length = bytesread;
 		socketptr->buffered_offset = 0;
+		SOCKET_BUFFER_GROW(socketptr, bytesread);
 	}
 	/* Compute number of bytes we need for the first char in the buffer */
 	readptr = socketptr->buffer + socketptr->buffered_offset;
@@ -373,7 +375,7 @@ ssize_t iosocket_snr_utf_prebuffer(io_desc *iod, socket_struct *socketptr, int f
 	DBGSOCK2((stdout, "socsnrupb: Length of char: %d\n", mblen));
 	if (socketptr->buffered_length < mblen)
 	{	/* Still insufficient chars in the buffer for our utf character. Read some more in. */
-		if ((socketptr->buffered_offset + mblen) > socketptr->buffer_size)
+		if ((socketptr->buffered_offset + mblen) > socketptr->buffer_alloc)
 		{	/* Our char won't fit in the buffer. This can only occur if the read point is
 			 * right at the end of the buffer since the minimum buffer size is 32K. Solution
 			 * is to slide the part of the char that we have down to the beginning of the
@@ -391,7 +393,7 @@ ssize_t iosocket_snr_utf_prebuffer(io_desc *iod, socket_struct *socketptr, int f
 			DBGSOCK2((stdout, "socsnrupb: Top of read loop for char - buffered_length: %d\n",
 				  socketptr->buffered_length));
 			readptr = socketptr->buffer + socketptr->buffered_offset + socketptr->buffered_length;
-			readlen = socketptr->buffer_size - socketptr->buffered_offset - socketptr->buffered_length;
+			readlen = socketptr->buffer_alloc - socketptr->buffered_offset - socketptr->buffered_length;
 			assert(0 < readlen);
 			bytesread = (int)iosocket_snr_io(socketptr, readptr, readlen, flags, time_for_read);
 			DBGSOCK2((stdout, "socsnrupb: Read %d chars\n", bytesread));
@@ -429,20 +431,20 @@ void iosocket_unsnr(socket_struct *socketptr, unsigned char *buffer, size_t len)
 	char	*new_buff;
 
 	DBGSOCK((stdout, "iosunsnr: ** Requeueing %d bytes\n", len));
-	if ((socketptr->buffered_length + len) <= socketptr->buffer_size)
+	if ((socketptr->buffered_length + len) <= socketptr->buffer_alloc)
 	{
 		if (0 < socketptr->buffered_length)
 		{
 			if (socketptr->buffered_offset < len)
 			{
-				assert((len + socketptr->buffered_length) < socketptr->buffer_size);
+				assert((len + socketptr->buffered_length) < socketptr->buffer_alloc);
 				memmove(socketptr->buffer + len, socketptr->buffer + socketptr->buffered_offset,
 						socketptr->buffered_length);
 				memmove(socketptr->buffer, buffer, len);
 			} else
 			{
 				memmove(socketptr->buffer, buffer, len);
-				assert((len + socketptr->buffered_length) < socketptr->buffer_size);
+				assert((len + socketptr->buffered_length) < socketptr->buffer_alloc);
 				memmove(socketptr->buffer + len, socketptr->buffer + socketptr->buffered_offset,
 						socketptr->buffered_length);
 			}
@@ -456,6 +458,7 @@ void iosocket_unsnr(socket_struct *socketptr, unsigned char *buffer, size_t len)
 			memcpy(new_buff + len, socketptr->buffer + socketptr->buffered_offset, socketptr->buffered_length);
 		free(socketptr->buffer);
 		socketptr->buffer = new_buff;
+		socketptr->buffer_alloc = socketptr->buffered_length + len;
 	}
 	socketptr->buffered_offset = 0;
 	socketptr->buffered_length += len;
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -57,6 +57,7 @@ boolean_t iosocket_switch(char *handle, int handle_len, d_socket_struct *from, d
                         return FALSE;
                 }
 		socketptr = from->socket[index];
+		iosocket_epoll_remove(from, socketptr);	/* "to" adds it to its own set on its next WRITE /WAIT */
 		socketptr->dev = to;
 		to->socket[to->n_socket++] = socketptr;
 		to->current_socket = to->n_socket - 1;
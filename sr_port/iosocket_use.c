@@ -3,7 +3,7 @@
  * Copyright (c) 2013-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -664,6 +664,7 @@ void	iosocket_use(io_desc *iod, mval *pp)
 			if (socketptr->buffered_length > bfsize)
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SOCKBFNOTEMPTY, 2, bfsize, socketptr->buffered_length);
 			newsocket.buffer = (char *)malloc(bfsize);
+			newsocket.buffer_alloc = bfsize;
 			if (0 < socketptr->buffered_length)
 			{
 				memcpy(newsocket.buffer, socketptr->buffer + socketptr->buffered_offset,
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -31,6 +31,7 @@
 #include "gtm_string.h"
 #include "gtm_unistd.h"
 #include "gtm_poll.h"
+#include <sys/epoll.h>
 
 #include "io_params.h"
 #include "gt_timer.h"
@@ -49,6 +50,13 @@
 #define	CONNECTED	"CONNECT"
 #define READ	"READ"
 
+/* The epoll data of a socket holds its descriptor and its index in the device, the latter only as a hint since sockets
+ * may be closed or moved after being registered.
+ */
+#define EPOLL_DATA(SD, INDEX)	(((uint8)(uint4)(SD) << 32) | (uint4)(INDEX))
+#define EPOLL_DATA_SD(DATA)	((int)((DATA) >> 32))
+#define EPOLL_DATA_INDEX(DATA)	((int4)((DATA) & 0xFFFFFFFF))
+
 GBLREF volatile int4		outofband;
 GBLREF uint4			ydb_max_sockets;
 GBLREF int			socketus_interruptus;
@@ -58,12 +66,43 @@ GBLREF unsigned char            *stackbase, *stacktop, *msp, *stackwarn;
 GBLREF mv_stent			*mv_chain;
 GBLREF int			dollar_truth;
 
+/* Adds (or, if already there, updates) socket "socketptr" at index "index" of "dsocketptr" to the epoll set of the device.
+ * Sockets stay in the set until they are closed or moved to another device (iosocket_epoll_remove) so a WRITE /WAIT need
+ * not pass every socket to the kernel again, and only has to look at the sockets epoll_wait() reports.
+ */
+static void iosocket_epoll_add(d_socket_struct *dsocketptr, socket_struct *socketptr, int4 index)
+{
+	struct epoll_event	event;
+	char			*errptr;
+	int4			errlen;
+
+	event.events = EPOLLIN;
+	event.data.u64 = EPOLL_DATA(socketptr->sd, index);
+	if ((0 > epoll_ctl(dsocketptr->epoll_fd, EPOLL_CTL_ADD, socketptr->sd, &event))
+		&& ((EEXIST != errno) || (0 > epoll_ctl(dsocketptr->epoll_fd, EPOLL_CTL_MOD, socketptr->sd, &event))))
+	{
+		errptr = (char *)STRERROR(errno);
+		errlen = STRLEN(errptr);
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_SOCKWAIT, 0, ERR_TEXT, 2, errlen, errptr);
+	}
+	socketptr->epoll_registered = TRUE;
+}
+
+/* Called before socket "socketptr" of "dsocketptr" is closed or moved to another device */
+void iosocket_epoll_remove(d_socket_struct *dsocketptr, socket_struct *socketptr)
+{
+	if (!socketptr->epoll_registered)
+		return;
+	assert(FD_INVALID != dsocketptr->epoll_fd);
+	/* A failure only leaves a stale entry, which iosocket_wait() removes when it reports an event for it */
+	epoll_ctl(dsocketptr->epoll_fd, EPOLL_CTL_DEL, socketptr->sd, NULL);
+	socketptr->epoll_registered = FALSE;
+}
+
 boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 {
 	ABS_TIME		utimeout, *utimeoutptr, cur_time, end_time;
-	nfds_t			poll_nfds;
-	struct pollfd		*poll_fds;
-	socket_struct		**poll_socketptr;	/* matching poll_fds */
+	struct epoll_event	*epoll_events;
 	size_t			poll_fds_size;
 	int			poll_timeout, poll_fd;
 	d_socket_struct 	*dsocketptr;
@@ -130,7 +169,18 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 		sockintr->who_saved = sockwhich_invalid;
 	}
 	/* check for events */
-	poll_fds_size = dsocketptr->n_socket * (SIZEOF(struct pollfd) + SIZEOF(socket_struct *));
+	if (FD_INVALID == dsocketptr->epoll_fd)
+	{
+		dsocketptr->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		if (FD_INVALID == dsocketptr->epoll_fd)
+		{
+			errptr = (char *)STRERROR(errno);
+			errlen = STRLEN(errptr);
+			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_SOCKWAIT, 0, ERR_TEXT, 2, errlen, errptr);
+			return FALSE;
+		}
+	}
+	poll_fds_size = dsocketptr->n_socket * SIZEOF(struct epoll_event);
 	if (NULL == TREF(poll_fds_buffer))
 	{
 		TREF(poll_fds_buffer) = malloc(poll_fds_size);
@@ -141,11 +191,9 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 		TREF(poll_fds_buffer) = malloc(poll_fds_size);
 		TREF(poll_fds_buffer_size) = poll_fds_size;
 	}
-	poll_fds = (struct pollfd *) TREF(poll_fds_buffer);
-	poll_socketptr = (socket_struct **)((char *)poll_fds + (dsocketptr->n_socket * SIZEOF(struct pollfd)));
+	epoll_events = (struct epoll_event *)TREF(poll_fds_buffer);
 	while (TRUE)
 	{
-		poll_nfds = 0;
 		nselect = rlisten = rconnected = 0;
 		rv = 0;
 		for (ii = 0; ii < dsocketptr->n_socket; ii++)
@@ -174,10 +222,8 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 						continue;	/* ready for ACCEPT now */
 					}
 				}
-				poll_fds[poll_nfds].fd = socketptr->sd;
-				poll_fds[poll_nfds].events = POLLIN;
-				poll_socketptr[poll_nfds] = socketptr;
-				poll_nfds++;
+				if (!socketptr->epoll_registered)
+					iosocket_epoll_add(dsocketptr, socketptr, ii);
 				nselect++;
 			}
 		}
@@ -223,8 +269,7 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 				else
 					poll_timeout = (utimeout.tv_sec * MILLISECS_IN_SEC) +
 						DIVIDE_ROUND_UP(utimeout.tv_nsec, NANOSECS_IN_MSEC);
-				poll_fd = -1;
-				rv = poll(poll_fds, poll_nfds, poll_timeout);
+				rv = epoll_wait(dsocketptr->epoll_fd, epoll_events, dsocketptr->n_socket, poll_timeout);
 				if (0 > rv && EINTR == errno)
 				{
 					eintr_handling_check();
@@ -304,6 +349,44 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 			REVERT_GTMIO_CH(&iod->pair, ch_set);
 			return FALSE;
 		}
+		/* mark the sockets epoll_wait() reported; rv is 0 if it was not called or timed out */
+		for (jj = 0; jj < rv; jj++)
+		{
+			poll_fd = EPOLL_DATA_SD(epoll_events[jj].data.u64);
+			ii = EPOLL_DATA_INDEX(epoll_events[jj].data.u64);
+			if ((ii >= dsocketptr->n_socket) || (poll_fd != dsocketptr->socket[ii]->sd))
+			{	/* sockets were closed or moved since this one was registered */
+				for (ii = 0; ii < dsocketptr->n_socket; ii++)
+				{
+					if (poll_fd == dsocketptr->socket[ii]->sd)
+						break;
+				}
+				if (ii == dsocketptr->n_socket)
+				{	/* stale entry, no longer one of our sockets */
+					epoll_ctl(dsocketptr->epoll_fd, EPOLL_CTL_DEL, poll_fd, NULL);
+					continue;
+				}
+				iosocket_epoll_add(dsocketptr, dsocketptr->socket[ii], ii);	/* refresh the index hint */
+			}
+			socketptr = dsocketptr->socket[ii];
+			if (socket_listening == socketptr->state)
+			{
+				if (socketptr->pendingevent)
+					continue;	/* already counted above */
+			} else if ((socket_connected != socketptr->state) || (0 < socketptr->buffered_length))
+				continue;		/* not a candidate or already counted above */
+			socketptr->pendingevent = TRUE;
+			socketptr->readycycle = dsocketptr->waitcycle;
+			if (socket_listening == socketptr->state)
+				rlisten++;
+			else
+				rconnected++;
+		}
+		if ((0 < rv) && (0 == rlisten) && (0 == rconnected))
+		{	/* only stale entries were reported so wait again for the rest of the timeout */
+			retry_accept = TRUE;
+			continue;
+		}
 		/* find out which sockets are ready */
 		oldestlistencycle = oldestconnectedcycle = oldesteventcycle = 0;
 		oldestlistenindex = oldestconnectedindex = oldesteventindex = -1;
@@ -312,21 +395,6 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout)
 			socketptr = dsocketptr->socket[ii];
 			if ((socket_listening != socketptr->state) && (socket_connected != socketptr->state))
 				continue;	/* not a candidate for /WAIT */
-			for (jj = 0; jj < poll_nfds; jj++)
-			{
-				if (socketptr == poll_socketptr[jj])
-					break;
-			}
-			assertpro((0 == jj) || (jj <= poll_nfds));	/* equal poll_nfds if not polled */
-			if (nselect && (jj != poll_nfds) && (socketptr->sd == poll_fds[jj].fd) && poll_fds[jj].revents)
-			{	/* set flag in socketptr and keep going */
-				socketptr->pendingevent = TRUE;
-				socketptr->readycycle = dsocketptr->waitcycle;
-				if (socket_listening == socketptr->state)
-					rlisten++;
-				else
-					rconnected++;
-			}
 			if (socketptr->pendingevent)	/* may be from prior /WAIT */
 			{
 				if (socket_listening == socketptr->state)
@@ -483,7 +551,7 @@ int iosocket_accept(d_socket_struct *dsocketptr, socket_struct *socketptr, boole
 	newsocketptr->remote.ai.ai_socktype = socketptr->local.ai.ai_socktype;
 	newsocketptr->remote.ai.ai_protocol = socketptr->local.ai.ai_protocol;
 	newsocketptr->lastaction = newsocketptr->readycycle = 0;
-	newsocketptr->pendingevent = FALSE;
+	newsocketptr->pendingevent = newsocketptr->epoll_registered = FALSE;
 	newsocketptr->sd = rv;
 	if (socket_local != newsocketptr->protocol)
 	{	/* translate internal address to numeric ip address */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -65,6 +65,12 @@ error_def(ERR_TLSIOERROR);
 error_def(ERR_ZFF2MANY);
 error_def(ERR_ZINTRECURSEIO);
 
+#ifdef MSG_NOSIGNAL
+#define	SOCKET_SEND_FLAGS	MSG_NOSIGNAL	/* return EPIPE instead of SIGPIPE */
+#else
+#define	SOCKET_SEND_FLAGS	0
+#endif
+
 #define DOTCPSEND_REAL(SOCKETPTR, SBUFF, SBUFF_LEN, SFLAGS, RC)								\
 {															\
 	ssize_t		gtmioStatus;											\
@@ -212,6 +218,8 @@ ssize_t iosocket_output(socket_struct *socketptr, char *buffer, size_t length, b
 			continue;
 		}
 		HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
+		if (timed && (0 == istatus) && (llen == length))
+			break;		/* not writable now; leave the buffer for the rescheduled timer rather than block */
 #		ifdef GTM_TLS
 		if (socketptr->tlsenabled)
 		{
@@ -248,7 +256,7 @@ ssize_t iosocket_output(socket_struct *socketptr, char *buffer, size_t length, b
 		} else
 #		endif
 		{
-			DOTCPSEND_REAL(socketptr, buffer, length, 0, status);
+			DOTCPSEND_REAL(socketptr, buffer, length, SOCKET_SEND_FLAGS, status);
 			if (0 != status)
 			{	/* current callers do this check and return */
 				/* if timed, just return - maybe set flag in struct */
@@ -268,6 +276,52 @@ ssize_t iosocket_output(socket_struct *socketptr, char *buffer, size_t length, b
 	return status;
 }
 
+/* Outputs the buffered output followed by "length" bytes at "buffer", which do not fit in the buffer, with one sendmsg
+ * (barring partial sends) rather than one send for each. Only for blocking plain sockets; returns "length" on success.
+ */
+static ssize_t iosocket_output_vector(socket_struct *socketptr, char *buffer, size_t length)
+{
+	struct iovec	iov[2];
+	struct msghdr	msg;
+	ssize_t		sent;
+	size_t		left;
+
+	assert(!socketptr->nonblocking && socketptr->obuffer_output_active);
+	iov[0].iov_base = socketptr->obuffer;
+	iov[0].iov_len = socketptr->obuffer_length;
+	iov[1].iov_base = buffer;
+	iov[1].iov_len = length;
+	memset(&msg, 0, SIZEOF(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 2;
+	for (left = socketptr->obuffer_length + length; 0 < left; )
+	{
+		sent = sendmsg(socketptr->sd, &msg, SOCKET_SEND_FLAGS);
+		if (-1 == sent)
+		{
+			if (EINTR != errno)
+			{
+				socketptr->obuffer_errno = errno;
+				return -1;
+			}
+			eintr_handling_check();
+			continue;
+		}
+		HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
+		left -= sent;
+		for ( ; (0 < msg.msg_iovlen) && ((size_t)sent >= msg.msg_iov->iov_len); msg.msg_iov++, msg.msg_iovlen--)
+			sent -= msg.msg_iov->iov_len;
+		if (0 < msg.msg_iovlen)
+		{	/* partial send, skip what went out */
+			msg.msg_iov->iov_base = (char *)msg.msg_iov->iov_base + sent;
+			msg.msg_iov->iov_len -= sent;
+		}
+	}
+	socketptr->obuffer_errno = 0;
+	socketptr->obuffer_length = socketptr->obuffer_offset = 0;
+	return length;
+}
+
 /*	prototype in iosocketdef.h since called by iosocket_flush and iosocket_close */
 ssize_t iosocket_output_buffer(socket_struct *socketptr)
 {
@@ -304,6 +358,7 @@ ssize_t	iosocket_write_buffered(socket_struct *socketptr, char *buffer, size_t l
 ssize_t	iosocket_write_buffered(socket_struct *socketptr, char *buffer, size_t length)
 {
 	ssize_t		status, obuffered_len;
+	boolean_t	vectored;
 	int		errlen, devlen;
 	io_desc		*iod;
 	d_socket_struct	*dsocketptr;
@@ -311,6 +366,21 @@ ssize_t	iosocket_write_buffered(socket_struct *socketptr, char *buffer, size_t l
 
 	socketptr->obuffer_output_active = TRUE;	/* lock out timed writes */
 	status = (0 != socketptr->obuffer_errno) ? -1 : 0;
+	vectored = !socketptr->nonblocking;
+#	ifdef GTM_TLS
+	if (socketptr->tlsenabled)
+		vectored = FALSE;		/* gtm_tls_send() takes one buffer */
+#	endif
+	if ((0 == status) && vectored && (0 < socketptr->obuffer_length) && (length > socketptr->obuffer_size))
+	{	/* more output than the buffer holds, so output both together */
+		status = iosocket_output_vector(socketptr, buffer, length);
+		if (status != length)
+			status = -1;			/* failure */
+		socketptr->obuffer_output_active = FALSE;
+		if (0 > status)
+			iosocket_buffer_error(socketptr);
+		return status;
+	}
 	if ((0 == status ) && (0 < socketptr->obuffer_length) && ((socketptr->obuffer_size - socketptr->obuffer_length) <= length))
 	{	/* more output than space left in buffer */
 		obuffered_len = socketptr->obuffer_length;
@@ -381,11 +451,9 @@ void	iosocket_write_real(mstr *v, boolean_t convert_output)
 		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_ZINTRECURSEIO);
 	socketptr = dsocketptr->socket[dsocketptr->current_socket];
 	ENSURE_DATA_SOCKET(socketptr);
-#ifdef MSG_NOSIGNAL
-	flags = MSG_NOSIGNAL;		/* return EPIPE instead of SIGPIPE */
-#else
-	flags = 0;
-#endif
+	if ((0 == socketptr->obuffer_size) && (0 != TREF(socket_wbuffer_size)) && !socketptr->urgent)
+		SOCKET_OBUFFER_INIT(socketptr, TREF(socket_wbuffer_size));
+	flags = SOCKET_SEND_FLAGS;
 	tempv = *v;
 	socketptr->lastop = TCP_WRITE;
 	/* In case the CHSET changes from non-UTF-16 to UTF-16 and a read has already been done,
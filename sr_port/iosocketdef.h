@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -141,10 +141,47 @@ MBSTART { 													\
 #define SOCKET_BUFFER_INIT(SOCKPTR, SIZE)					\
 {										\
 	SOCKPTR->buffer = (char *)malloc(SIZE);					\
-	SOCKPTR->buffer_size = SIZE;						\
+	SOCKPTR->buffer_size = SOCKPTR->buffer_alloc = SIZE;			\
 	SOCKPTR->buffered_length = SOCKPTR->buffered_offset = 0;		\
 }
 
+/* Called after a recv of BYTESREAD bytes into the start of the input buffer. If that filled the buffer, more input is likely
+ * waiting, so the buffer doubles (up to MAX_SOCKET_BUFFER_SIZE) to need fewer recvs on bulk transfers. Only the allocation
+ * grows; buffer_size stays the ZBFSIZE the user asked for.
+ */
+#define SOCKET_BUFFER_GROW(SOCKPTR, BYTESREAD)								\
+{													\
+	char	*newbuff;										\
+	size_t	newsize;										\
+													\
+	if (((BYTESREAD) == (SOCKPTR)->buffer_alloc)							\
+		&& (MAX_SOCKET_BUFFER_SIZE > (SOCKPTR)->buffer_alloc))					\
+	{												\
+		newsize = MIN(2 * (SOCKPTR)->buffer_alloc, MAX_SOCKET_BUFFER_SIZE);			\
+		newbuff = (char *)malloc(newsize);							\
+		memcpy(newbuff, (SOCKPTR)->buffer, (BYTESREAD));					\
+		free((SOCKPTR)->buffer);								\
+		(SOCKPTR)->buffer = newbuff;								\
+		(SOCKPTR)->buffer_alloc = newsize;							\
+	}												\
+}
+
+/* Turns on output buffering: WRITEs collect in the output buffer until it is full, a WRITE ! or /FLUSH, a READ, or the
+ * flush timer. Always on with TLS; on plain sockets when $ydb_socket_wbuffer is set.
+ */
+#define SOCKET_OBUFFER_INIT(SOCKPTR, SIZE)							\
+{												\
+	if (NULL == (SOCKPTR)->obuffer)								\
+	{											\
+		if (0 == (SOCKPTR)->obuffer_size)						\
+			(SOCKPTR)->obuffer_size = (SIZE);					\
+		(SOCKPTR)->obuffer = malloc((SOCKPTR)->obuffer_size);				\
+	}											\
+	(SOCKPTR)->obuffer_length = (SOCKPTR)->obuffer_offset = 0;				\
+	(SOCKPTR)->obuffer_wait_time = DEFAULT_WRITE_WAIT;					\
+	(SOCKPTR)->obuffer_flush_time = DEFAULT_WRITE_WAIT * 2;	/* until add device parameter */	\
+}
+
 #define SOCKET_FREE(SOCKPTR)							\
 {										\
 	if (NULL != SOCKPTR->buffer) 						\
@@ -165,6 +202,8 @@ MBSTART { 													\
 		free(SOCKPTR->remote.saddr_ip);					\
 	if (NULL != SOCKPTR->parenthandle)					\
 		free(SOCKPTR->parenthandle);					\
+	if (NULL != SOCKPTR->obuffer)						\
+		free(SOCKPTR->obuffer);						\
 	iosocket_delimiter((unsigned char *)NULL, 0, SOCKPTR, TRUE);		\
 	free(SOCKPTR);								\
 }
@@ -177,6 +216,7 @@ MBSTART { 													\
 	{													\
 		NEWSOCKPTR->buffered_length = NEWSOCKPTR->buffered_offset = 0;					\
 		NEWSOCKPTR->buffer = (char *)malloc(SOCKPTR->buffer_size);					\
+		NEWSOCKPTR->buffer_alloc = SOCKPTR->buffer_size;						\
 	}													\
 	if ((0 != SOCKPTR->zff.len) && (NULL != SOCKPTR->zff.addr))						\
 	{													\
@@ -212,6 +252,8 @@ MBSTART { 													\
 		STRNDUP(SOCKPTR->remote.saddr_ip, SA_MAXLEN, NEWSOCKPTR->remote.saddr_ip);			\
 	if (NULL != SOCKPTR->parenthandle)									\
 		NEWSOCKPTR->parenthandle = NULL;									\
+	NEWSOCKPTR->obuffer = NULL;										\
+	NEWSOCKPTR->obuffer_size = NEWSOCKPTR->obuffer_length = NEWSOCKPTR->obuffer_offset = 0;			\
 	iosocket_delimiter_copy(SOCKPTR, NEWSOCKPTR);								\
 }
 
@@ -318,6 +360,7 @@ typedef struct socket_struct_type
         mstr                            idelimiter[MAX_N_DELIMITER];
 	mstr				odelimiter0;
 	size_t				buffer_size;			/* size of the buffer for this socket */
+	size_t				buffer_alloc;			/* allocated size of the buffer, >= buffer_size */
 	size_t				buffered_length;		/* length of stuff buffered for this socket */
 	size_t				buffered_offset;		/* offset of the buffered stuff to buffer head */
 	char				*buffer;			/* pointer to the buffer of this socket */
@@ -334,6 +377,7 @@ typedef struct socket_struct_type
 	uint4				lastaction;		/* waitcycle  count */
 	uint4				readycycle;		/* when was ready */
 	boolean_t			pendingevent;		/* if listening, needs accept */
+	boolean_t			epoll_registered;	/* sd is in the epoll set of its device (dev->epoll_fd) */
 	enum socket_creator		howcreated;
 	char				*parenthandle;		/* listening socket this created from */
 	size_t				obuffer_size;		/* size of the output buffer for this socket */
@@ -374,6 +418,7 @@ typedef struct d_socket_struct_type
 	int4				current_socket;			/* current socket index */
 	int4				n_socket;			/* number of sockets	*/
 	uint4				waitcycle;			/* count waits */
+	int				epoll_fd;			/* epoll set for WRITE /WAIT or FD_INVALID */
 	boolean_t			ichset_specified;
 	boolean_t			ochset_specified;
 	gtm_chset_t			ichset_utf16_variant;		/* Save the UTF-16 variant (BE/LE) for reuse */
@@ -399,6 +444,7 @@ void iosocket_write_real(mstr *v, boolean_t convert_output);
 void iosocket_readfl_badchar(mval *vmvalptr, int datalen, int delimlen, unsigned char *delimptr, unsigned char *strend);
 boolean_t iosocket_listen_sock(socket_struct *socketptr, unsigned short len);
 void iosocket_close_one(d_socket_struct *dsocketptr, int index);
+void iosocket_epoll_remove(d_socket_struct *dsocketptr, socket_struct *socketptr);
 int iosocket_accept(d_socket_struct *dsocketptr, socket_struct *socketptr, boolean_t selectfirst);
 ssize_t iosocket_output_buffer(socket_struct *socketptr);
 void iosocket_buffer_error(socket_struct *socketptr);
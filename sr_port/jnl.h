@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -520,7 +520,8 @@ typedef struct
 	global_latch_t		io_in_prog_latch;	/* UNIX only: write in progress indicator */
 	CACHELINE_PAD(SIZEOF(global_latch_t), 1);	/* start next latch at a different cacheline than previous fields */
 	global_latch_t		fsync_in_prog_latch;	/* fsync in progress indicator */
-        CACHELINE_PAD(SIZEOF(global_latch_t), 2);	/* start next latch at a different cacheline than previous fields */
+	volatile int4		fsync_waiters;		/* # of processes waiting (in "jnl_fsync") for "fsync_dskaddr" to change */
+        CACHELINE_PAD(SIZEOF(global_latch_t) + SIZEOF(int4), 2);	/* start next latch at a different cacheline */
 	global_latch_t		phase2_commit_latch;	/* Used by "jnl_phase2_cleanup" to update "phase2_commit_index1" */
 	CACHELINE_PAD(SIZEOF(global_latch_t), 3);	/* pad enough space so next non-filler byte falls in different cacheline */
 	/**********************************************************************************************/
@@ -1875,6 +1876,7 @@ MBSTART {								\
 
 #define CURRENT_JNL_IO_WRITER(JB)	JB->io_in_prog_latch.u.parts.latch_pid
 #define CURRENT_JNL_FSYNC_WRITER(JB)	JB->fsync_in_prog_latch.u.parts.latch_pid
+#define JNL_FSYNC_MAX_DELAY		10000	/* upper bound (in microseconds) for "ydb_jnl_fsync_delay" */
 
 /* This macro is invoked by callers just before grabbing crit to check if a db fsync is needed and if so do it.
  * Note that we can do the db fsync only if we already have the journal file open. If we do not, we will end
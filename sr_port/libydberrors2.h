@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -37,9 +37,9 @@
 #define YDB_ERR_SETENVFAIL -151027890
 #define YDB_ERR_UNSETENVFAIL -151027898
 #define YDB_ERR_UNKNOWNSYSERR -151027906
-#define YDB_ERR_UNUSED56R132 -151027914
+#define YDB_ERR_CURSORINVALID -151027914
 #define YDB_ERR_NODEEND -151027922
-#define YDB_ERR_UNUSED58R132 -151027930
+#define YDB_ERR_CURSORSNAPSHOT -151027930
 #define YDB_ERR_INVTPTRANS -151027938
 #define YDB_ERR_THREADEDAPINOTALLOWED -151027946
 #define YDB_ERR_SIMPLEAPINOTALLOWED -151027954
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -70,6 +70,7 @@ void	lke_clear(void)
 	mstr		regname, node, one_lock;
 	gd_region	*reg;
 	mlk_pvtctl	pctl;
+	uint4		num_stripes, stripe;
 
 	/* Get all command parameters */
 	regname.addr = regbuf;
@@ -105,13 +106,20 @@ void	lke_clear(void)
 			} else if (IS_REG_BG_OR_MM(reg))
 			{	/* Local region */
 				MLK_PVTCTL_INIT(pctl, reg);
-				/* Prevent any modifications of locks while we are clearing */
-				GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-				locks = (0 == pctl.ctl->blkroot) ? FALSE
-							  : lke_cleartree(&pctl, NULL,
-									  (mlk_shrblk_ptr_t)R2A(pctl.ctl->blkroot),
-									  all, interactive, pid, one_lock, exact);
-				REL_LOCK_CRIT(pctl, was_crit);
+				locks = FALSE;
+				for (stripe = 0, num_stripes = pctl.ctl->num_stripes; stripe < num_stripes; stripe++)
+				{
+					MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE(pctl.csa->mlkctl, stripe));
+					/* Prevent any modifications of locks while we are clearing */
+					GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
+					if (0 != pctl.ctl->blkroot)
+						locks |= lke_cleartree(&pctl, NULL, (mlk_shrblk_ptr_t)R2A(pctl.ctl->blkroot),
+									all, interactive, pid, one_lock, exact);
+					REL_LOCK_CRIT(pctl, was_crit);
+					/* if a specific lock was requested (-EXACT and -LOCK=), then we are done */
+					if (locks && exact && (0 != one_lock.len))
+						break;
+				}
 			} else
 			{
 				gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(2) ERR_BADREGION, 0);
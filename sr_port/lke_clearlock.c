@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -32,6 +32,7 @@
 #include "gdsfhead.h"
 #include "filestruct.h"
 #include "mlkdef.h"
+#include "mlk_ops.h"
 #include "cmidef.h"
 #include "hashtab_mname.h"	/* needed for cmmdef.h */
 #include "cmmdef.h"
@@ -90,7 +91,8 @@ bool	lke_clearlock(
 		{
 			csa = pctl->csa;
 			node->owner = 0;
-			node->sequence = csa->hdr->trans_hist.lock_sequence++;
+			node->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
+			mlk_wake_blocked(pctl, node);
 			len = name->len - 1;
 			if (name->addr[len] != '(')
 				++len;
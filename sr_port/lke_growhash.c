@@ -3,7 +3,7 @@
  * Copyright (c) 2018 Fidelity National Information		*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -78,6 +78,12 @@ void lke_growhash(void)
 			match = TRUE;
 			/* Construct a dummy pctl to pass in */
 			MLK_PVTCTL_INIT(pctl, reg);
+			if (MLK_CTL_IS_STRIPED(pctl.ctl))
+			{	/* Stripes keep their hash tables inside the stripe so they cannot be resized */
+				util_out_print("Resize of lock hash memory not supported for striped lock space of region !AD",
+						TRUE, REG_LEN_STR(reg));
+				continue;
+			}
 			GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
 			resize_status = mlk_shrhash_resize(&pctl);
 			REL_LOCK_CRIT(pctl, was_crit);
@@ -3,7 +3,7 @@
  * Copyright (c) 2019 Fidelity National Information		*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -53,6 +53,7 @@ void lke_rehash(void)
 	int			regidx;
 	boolean_t		was_crit;
 	mlk_pvtctl		pctl;
+	uint4			num_stripes, stripe;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -78,11 +79,19 @@ void lke_rehash(void)
 			match = TRUE;
 			/* Construct a dummy pctl to pass in */
 			MLK_PVTCTL_INIT(pctl, reg);
-			GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-			mlk_rehash(&pctl);
-			REL_LOCK_CRIT(pctl, was_crit);
-			util_out_print("Rehash of lock completed for region !AD (seed = !UJ)", TRUE,
-						REG_LEN_STR(reg), pctl.ctl->hash_seed);
+			for (stripe = 0, num_stripes = pctl.ctl->num_stripes; stripe < num_stripes; stripe++)
+			{
+				MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE(pctl.csa->mlkctl, stripe));
+				GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
+				mlk_rehash(&pctl);
+				REL_LOCK_CRIT(pctl, was_crit);
+				if (1 == num_stripes)
+					util_out_print("Rehash of lock completed for region !AD (seed = !UJ)", TRUE,
+								REG_LEN_STR(reg), pctl.ctl->hash_seed);
+				else
+					util_out_print("Rehash of lock completed for region !AD stripe !UL (seed = !UJ)", TRUE,
+								REG_LEN_STR(reg), stripe, pctl.ctl->hash_seed);
+			}
 		}
 	}
 	if (!match && (0 != regname.len))
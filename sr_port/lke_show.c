@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -71,14 +71,17 @@ void	lke_show(void)
 	bool			locks, all = TRUE, wait = TRUE, interactive = FALSE, match = FALSE, memory = TRUE, nocrit = TRUE;
 	boolean_t		exact = FALSE, was_crit;
 	int4			pid;
-	size_t			ls_len;
+	size_t			hash_len, ls_len;
 	int			n;
 	char 			regbuf[MAX_RN_LEN], nodebuf[32], one_lockbuf[MAX_LKNAME_LEN + 1];
 	mlk_ctldata_ptr_t	ctl;
 	mstr			regname, node, one_lock;
 	gd_region		*reg;
 	sgmnt_addrs		*csa;
-	int			shr_sub_len = 0;
+	int			shr_sub_len = 0, stripe_sub_len, sub_size;
+	int4			prc_free, prc_max, blk_free, blk_max, crit_owner;
+	uint4			num_stripes, stripe;
+	mlk_ctldata_ptr_t	stripe_ctl;
 	float			ls_free = 0;	/* Free space in bottleneck subspace */
 	mlk_pvtctl		pctl, pctl2;
 
@@ -120,54 +123,80 @@ void	lke_show(void)
 				ls_len = (size_t)csa->mlkctl_len;
 				ctl = (mlk_ctldata_ptr_t)malloc(ls_len);
 				MLK_PVTCTL_INIT(pctl, reg);
-				if (nocrit)
-				{	/* Set shrhash and shrhash_size here when nocrit, as they normally get set up
-					 * when grabbing lock crit.
-					 * If we have an external lock hash table, attach the shared memory.
-					 */
-					pctl.shrhash_size = pctl.ctl->num_blkhash;
-					if (MLK_CTL_BLKHASH_EXT != pctl.ctl->blkhash)
-						pctl.shrhash = (mlk_shrhash_ptr_t)R2A(pctl.ctl->blkhash);
-					else
-						pctl.shrhash = do_shmat(pctl.ctl->hash_shmid, NULL, 0);
-				}
-				/* Prevent any modification of the lock space while we make a local copy of it */
-				if (!nocrit)
-					GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-				memcpy((uchar_ptr_t)ctl, (uchar_ptr_t)csa->mlkctl, ls_len);
-				assert((ctl->max_blkcnt > 0) && (ctl->max_prccnt > 0) && ((ctl->subtop - ctl->subbase) > 0));
-				pctl2 = pctl;
-				if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
+				/* Each stripe of a striped lock space is shown in turn. The space usage reported is the sum over
+				 * all stripes but the free percentage is that of the most used stripe as that is the one which
+				 * runs out first.
+				 */
+				locks = FALSE;
+				ls_free = 1;
+				shr_sub_len = sub_size = 0;
+				prc_free = prc_max = blk_free = blk_max = 0;
+				crit_owner = 0;
+				for (stripe = 0, num_stripes = pctl.ctl->num_stripes; stripe < num_stripes; stripe++)
 				{
-					pctl2.shrhash = (mlk_shrhash_ptr_t)malloc(SIZEOF(mlk_shrhash) * pctl.shrhash_size);
-					memcpy(pctl2.shrhash, pctl.shrhash, SIZEOF(mlk_shrhash) * pctl.shrhash_size);
+					MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE(csa->mlkctl, stripe));
+					/* The copy of this stripe goes at the same offset in "ctl" as the stripe does in shm */
+					stripe_ctl = (mlk_ctldata_ptr_t)((sm_uc_ptr_t)ctl
+								+ ((sm_uc_ptr_t)pctl.ctl - (sm_uc_ptr_t)csa->mlkctl));
+					if (nocrit)
+					{	/* Set shrhash and shrhash_size here when nocrit, as they normally get set up
+						 * when grabbing lock crit.
+						 * If we have an external lock hash table, attach the shared memory.
+						 */
+						pctl.shrhash_size = pctl.ctl->num_blkhash;
+						if (MLK_CTL_BLKHASH_EXT != pctl.ctl->blkhash)
+							pctl.shrhash = (mlk_shrhash_ptr_t)R2A(pctl.ctl->blkhash);
+						else
+							pctl.shrhash = do_shmat(pctl.ctl->hash_shmid, NULL, 0);
+					}
+					/* Prevent any modification of the lock space while we make a local copy of it */
+					if (!nocrit)
+						GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
+					memcpy((uchar_ptr_t)stripe_ctl, (uchar_ptr_t)pctl.ctl, pctl.ctl->stripe_size);
+					assert((stripe_ctl->max_blkcnt > 0) && (stripe_ctl->max_prccnt > 0)
+						&& ((stripe_ctl->subtop - stripe_ctl->subbase) > 0));
+					pctl2 = pctl;
+					if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
+					{
+						hash_len = SIZEOF(mlk_shrhash) * pctl.shrhash_size;
+						pctl2.shrhash = (mlk_shrhash_ptr_t)malloc(hash_len);
+						memcpy(pctl2.shrhash, pctl.shrhash, hash_len);
+					}
+					if (!nocrit)
+						REL_LOCK_CRIT(pctl, was_crit);
+					else if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
+						SHMDT(pctl.shrhash);
+					if (!crit_owner)
+						crit_owner = LOCK_CRIT_OWNER(&pctl);
+					stripe_sub_len = 0;
+					MLK_PVTCTL_SET_CTL(pctl2, stripe_ctl);
+					if (MLK_CTL_BLKHASH_EXT != pctl.ctl->blkhash)
+						pctl2.shrhash = (mlk_shrhash_ptr_t)R2A(pctl2.ctl->blkhash);
+					if (0 != stripe_ctl->blkroot)
+						locks |= lke_showtree(NULL, &pctl2, all, wait, pid, one_lock, memory,
+									&stripe_sub_len);
+					/* lock space usage consists of: control_block + nodes(locks) +  processes + substrings */
+					/* any of those subspaces can be bottleneck.
+					 * Therefore we will report the subspace which is running out.
+					 */
+					ls_free = MIN(((float)stripe_ctl->blkcnt) / stripe_ctl->max_blkcnt, ls_free);
+					ls_free = MIN(((float)stripe_ctl->prccnt) / stripe_ctl->max_prccnt, ls_free);
+					ls_free = MIN(1 - (((float)stripe_sub_len) / (stripe_ctl->subtop - stripe_ctl->subbase)),
+							ls_free);
+					prc_free += stripe_ctl->prccnt;
+					prc_max += stripe_ctl->max_prccnt;
+					blk_free += stripe_ctl->blkcnt;
+					blk_max += stripe_ctl->max_blkcnt;
+					shr_sub_len += stripe_sub_len;
+					sub_size += stripe_ctl->subtop - stripe_ctl->subbase;
+					if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
+						free(pctl2.shrhash);
 				}
-				if (!nocrit)
-					REL_LOCK_CRIT(pctl, was_crit);
-				else if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
-					SHMDT(pctl.shrhash);
-				shr_sub_len = 0;
-				MLK_PVTCTL_SET_CTL(pctl2, ctl);
-				if (MLK_CTL_BLKHASH_EXT != pctl.ctl->blkhash)
-					pctl2.shrhash = (mlk_shrhash_ptr_t)R2A(pctl2.ctl->blkhash);
-				locks = (0 == ctl->blkroot)
-						? FALSE
-						: lke_showtree(NULL, &pctl2, all, wait, pid, one_lock, memory, &shr_sub_len);
-				/* lock space usage consists of: control_block + nodes(locks) +  processes + substrings */
-				/* any of those subspaces can be bottleneck.
-				 * Therefore we will report the subspace which is running out.
-				 */
-				ls_free = MIN(((float)ctl->blkcnt) / ctl->max_blkcnt, ((float)ctl->prccnt) / ctl->max_prccnt);
-				ls_free = MIN(1-(((float)shr_sub_len) / (ctl->subtop - ctl->subbase)), ls_free);
 				ls_free *= 100;	/* Scale to [0-100] range. (couldn't do this inside util_out_print) */
 				if (ls_free < 1) /* No memory? Notify user. */
 					gtm_putmsg_csa(NULL, VARLSTCNT(4) ERR_LOCKSPACEFULL, 2, DB_LEN_STR(reg));
 				gtm_putmsg_csa(NULL, VARLSTCNT(10) ERR_LOCKSPACEINFO, 8, REG_LEN_STR(reg),
-					   (ctl->max_prccnt - ctl->prccnt), ctl->max_prccnt,
-					   (ctl->max_blkcnt - ctl->blkcnt), ctl->max_blkcnt,
-					   shr_sub_len, (ctl->subtop - ctl->subbase));
-				if (MLK_CTL_BLKHASH_EXT == pctl.ctl->blkhash)
-					free(pctl2.shrhash);
+					   (prc_max - prc_free), prc_max, (blk_max - blk_free), blk_max, shr_sub_len, sub_size);
 				free(ctl);
 			} else
 			{
@@ -180,7 +209,7 @@ void	lke_show(void)
 			gtm_putmsg_csa(NULL, VARLSTCNT(4) ERR_LOCKSPACEUSE, 2, ((int)ls_free),
 				       csa->hdr->lock_space_size/OS_PAGELET_SIZE);
 			if (nocrit)
-				gtm_putmsg_csa(NULL, VARLSTCNT(3) ERR_LOCKCRITOWNER, 1, LOCK_CRIT_OWNER(csa));
+				gtm_putmsg_csa(NULL, VARLSTCNT(3) ERR_LOCKCRITOWNER, 1, crit_owner);
 		}
 	}
 	if (!match && (0 != regname.len))
@@ -0,0 +1,690 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* B+tree layout for large local variable subscript levels.
+ *
+ * A subscript level starts out as an AVL tree of "lvTreeNode" structures (see lv_tree.c). Once that tree grows taller than
+ * LV_BTREE_MIN_AVL_HEIGHT, every lookup or $ORDER at that level takes a cache miss per AVL level, so the level is converted
+ * (once) into a B+tree of "lvBtreeBlk" blocks. The "lvTreeNode" structures are kept as is (they hold the value, the child
+ * subscript level and are pointed to from all over the runtime) but are no longer linked to each other. Instead each block
+ * holds up to LV_BTREE_FANOUT of them in key order along with an 8-byte order preserving prefix of each key. A search
+ * compares against the contiguous prefix array and only looks at the "lvTreeNode" (and the stringpool for string keys) if
+ * the prefixes are equal. Leaf blocks are doubly linked so in-order traversal does not need to go back up the tree.
+ *
+ * While a node is in a B+tree, its "balance" field is TREE_IN_BTREE and its "avl_parent" field points to its leaf block
+ * (see LV_BTREE_LEAF). The "lvTree" has "avl_root" set to NULL and "bt_root" pointing to the root block. "avl_height" is
+ * left non-zero as long as the level has at least one node since callers (e.g. lv_kill) rely on that.
+ *
+ * Blocks are split when they fill up and freed when they become empty but are not merged with their siblings when they
+ * become sparse. Every block's entries are the minimum key of the corresponding subtree, so index block entries always
+ * point to live nodes (see lvBtreeFixMin).
+ */
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "collseq.h"
+#include "subscript.h"
+#include "lv_tree.h"
+#include "lv_val.h"
+#include "arit.h"
+
+LITREF	int4		ten_pwr[NUM_DEC_DG_1L+1];
+
+/* The prefix space is split as follows so numbers collate before strings which collate before $ZYSQLNULL.
+ *	[0, LV_BTREE_NUM_ZERO)			negative numbers
+ *	[LV_BTREE_NUM_ZERO, LV_BTREE_STR_PREFIX)	zero and positive numbers
+ *	[LV_BTREE_STR_PREFIX, MAXUINT8)		strings (first LV_BTREE_STR_PREFIX_LEN bytes)
+ *	MAXUINT8				$ZYSQLNULL
+ */
+#define	LV_BTREE_NUM_ZERO	((gtm_uint64_t)1 << 61)
+#define	LV_BTREE_STR_PREFIX	((gtm_uint64_t)1 << 63)
+#define	LV_BTREE_STR_PREFIX_LEN	7
+#define	LV_BTREE_SQLNULL_PREFIX	MAXUINT8
+
+/* # of entries put in each leaf block when converting an AVL tree. Leave some room for random inserts. */
+#define	LV_BTREE_LOAD		(LV_BTREE_FANOUT - (LV_BTREE_FANOUT / 4))
+
+STATICFNDCL gtm_uint64_t lvBtreeNumPrefix(int sgn, int e, uint4 m1, uint4 m0);
+STATICFNDCL gtm_uint64_t lvBtreeIntPrefix(int4 m);
+STATICFNDCL gtm_uint64_t lvBtreeStrPrefix(char *addr, uint4 len);
+STATICFNDCL gtm_uint64_t lvBtreeKeyPrefix(treeKeySubscr *key);
+STATICFNDCL gtm_uint64_t lvBtreeNodePrefix(lvTreeNode *node);
+STATICFNDCL lvBtreeBlk *lvBtreeBlkAlloc(uint4 level);
+STATICFNDCL int lvBtreeBlkSearch(lvBtreeBlk *blk, treeKeySubscr *key, gtm_uint64_t prefix, int *cmp);
+STATICFNDCL lvTreeNode *lvBtreeSearch(lvTree *lvt, treeKeySubscr *key, lvBtreeBlk **leafp, int *posp);
+STATICFNDCL int lvBtreeChildIndex(lvBtreeBlk *parent, lvBtreeBlk *blk);
+STATICFNDCL int lvBtreeNodeIndex(lvBtreeBlk *leaf, lvTreeNode *node);
+STATICFNDCL void lvBtreeFixMin(lvBtreeBlk *blk);
+STATICFNDCL void lvBtreeBlkInsert(lvTree *lvt, lvBtreeBlk *blk, int pos, gtm_uint64_t prefix, lvTreeNode *node,
+					lvBtreeBlk *child);
+STATICFNDCL void lvBtreeBlkRemove(lvTree *lvt, lvBtreeBlk *blk, int pos);
+STATICFNDCL lvBtreeBlk *lvBtreeBlkClone(lvBtreeBlk *blk, lvTree *cloneTree, lvBtreeBlk *parent, lvBtreeBlk **lastBlk,
+					boolean_t refCntMaint);
+STATICFNDCL void lvBtreeBlkFree(lvBtreeBlk *blk);
+
+/* Sign, exponent and the two 9-digit halves of the mantissa of a normalized number compare in that order (see the
+ * LV_AVL_TREE_NUMKEY_CMP macro in lv_tree.c). Pack them in that order, dropping the low 6 bits of the low order half
+ * so the magnitude fits in 61 bits. Dropping bits keeps the order (equal prefixes just need a full comparison).
+ */
+STATICFNDEF gtm_uint64_t lvBtreeNumPrefix(int sgn, int e, uint4 m1, uint4 m0)
+{
+	gtm_uint64_t	mag;
+
+	mag = ((gtm_uint64_t)e << 54) | ((gtm_uint64_t)m1 << 24) | (m0 >> 6);
+	return sgn ? (LV_BTREE_NUM_ZERO - 1 - mag) : (LV_BTREE_NUM_ZERO + mag);
+}
+
+/* An MV_INT key is converted to the float representation the same way "lvAvlTreeNodeFltConv" does it */
+STATICFNDEF gtm_uint64_t lvBtreeIntPrefix(int4 m)
+{
+	int		sgn, e;
+	uint4		m1;
+	const int4	*pwr;
+
+	if (0 == m)
+		return LV_BTREE_NUM_ZERO;
+	sgn = (0 > m);
+	m1 = sgn ? -m : m;
+	for (e = 0, pwr = &ten_pwr[0]; m1 >= *pwr; e++, pwr++)
+		assert(pwr < ARRAYTOP(ten_pwr));
+	return lvBtreeNumPrefix(sgn, e + EXP_INT_UNDERF, m1 * ten_pwr[NUM_DEC_DG_1L - e], 0);
+}
+
+STATICFNDEF gtm_uint64_t lvBtreeStrPrefix(char *addr, uint4 len)
+{
+	gtm_uint64_t	prefix;
+	int		i;
+
+	for (prefix = 0, i = 0; i < LV_BTREE_STR_PREFIX_LEN; i++)
+		prefix = (prefix << 8) | ((i < len) ? (unsigned char)addr[i] : 0);
+	return LV_BTREE_STR_PREFIX | prefix;
+}
+
+STATICFNDEF gtm_uint64_t lvBtreeKeyPrefix(treeKeySubscr *key)
+{
+	int	mvtype;
+
+	mvtype = key->mvtype;
+	if (TREE_KEY_SUBSCR_IS_CANONICAL(mvtype))
+		return (MVTYPE_IS_INT(mvtype) ? lvBtreeIntPrefix(key->m[1])
+					      : lvBtreeNumPrefix(key->sgn, key->e, key->m[1], key->m[0]));
+	if (MVTYPE_IS_SQLNULL(mvtype))
+		return LV_BTREE_SQLNULL_PREFIX;
+	return lvBtreeStrPrefix(key->str.addr, key->str.len);
+}
+
+STATICFNDEF gtm_uint64_t lvBtreeNodePrefix(lvTreeNode *node)
+{
+	int		mvtype;
+	lvTreeNodeNum	*fltNode;
+
+	mvtype = node->key_mvtype;
+	if (TREE_KEY_SUBSCR_IS_CANONICAL(mvtype))
+	{
+		fltNode = (lvTreeNodeNum *)node;
+		if (MV_INT & mvtype)
+			return lvBtreeIntPrefix(fltNode->key_m0);
+		return lvBtreeNumPrefix(fltNode->key_flags.key_bits.key_sgn, fltNode->key_flags.key_bits.key_e,
+						fltNode->key_m1, fltNode->key_m0);
+	}
+	if (MVTYPE_IS_SQLNULL(mvtype))
+		return LV_BTREE_SQLNULL_PREFIX;
+	return lvBtreeStrPrefix(node->key_addr, node->key_len);
+}
+
+/* Leaf blocks do not need the "child" array so do not allocate it */
+STATICFNDEF lvBtreeBlk *lvBtreeBlkAlloc(uint4 level)
+{
+	lvBtreeBlk	*blk;
+
+	blk = (lvBtreeBlk *)malloc(level ? SIZEOF(lvBtreeBlk) : OFFSETOF(lvBtreeBlk, child[0]));
+	blk->parent = blk->prev = blk->next = NULL;
+	blk->nkeys = 0;
+	blk->level = level;
+	return blk;
+}
+
+/* Returns the lowest index whose key is >= "key" (blk->nkeys if there is none). "*cmp" is set to the result of comparing
+ * "key" with the key at that index (0 if equal, < 0 if "key" is lesser) or to 1 if there is no such index.
+ */
+STATICFNDEF int lvBtreeBlkSearch(lvBtreeBlk *blk, treeKeySubscr *key, gtm_uint64_t prefix, int *cmp)
+{
+	int		lo, hi, mid, midcmp, loCmp;
+	gtm_uint64_t	midprefix;
+
+	lo = 0;
+	hi = blk->nkeys;
+	loCmp = 1;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		midprefix = blk->prefix[mid];
+		if (prefix != midprefix)
+			midcmp = (prefix < midprefix) ? -1 : 1;
+		else
+			midcmp = lvAvlTreeKeySubscrCmp(key, blk->node[mid]);
+		if (0 < midcmp)
+			lo = mid + 1;
+		else
+		{
+			hi = mid;
+			loCmp = midcmp;
+		}
+	}
+	*cmp = (lo < blk->nkeys) ? loCmp : 1;
+	return lo;
+}
+
+/* Finds the leaf block and position where "key" is or would be inserted. Returns the node if "key" exists and NULL otherwise.
+ * Like the AVL tree lookup, the last looked up node is kept as a clue. If the key is within the range of the clue's leaf
+ * block (or beyond the edge of the tree on the clue's side), only that block is searched. This makes $ORDER loops and
+ * sequential loads (e.g. MERGE) skip the descent from the root.
+ */
+STATICFNDEF lvTreeNode *lvBtreeSearch(lvTree *lvt, treeKeySubscr *key, lvBtreeBlk **leafp, int *posp)
+{
+	gtm_uint64_t	prefix;
+	lvBtreeBlk	*blk;
+	lvTreeNode	*node;
+	int		pos, cmp, last;
+
+	assert(NULL != lvt->bt_root);
+	prefix = lvBtreeKeyPrefix(key);
+	blk = NULL;
+	if (NULL != (node = lvt->lastLookup.lastNodeLookedUp))
+	{
+		assert(TREE_IN_BTREE == node->balance);
+		blk = LV_BTREE_LEAF(node);
+		assert(blk->nkeys && !blk->level);
+		last = blk->nkeys - 1;
+		if (prefix != blk->prefix[0])
+			cmp = (prefix < blk->prefix[0]) ? -1 : 1;
+		else
+			cmp = lvAvlTreeKeySubscrCmp(key, blk->node[0]);
+		if (0 >= cmp)
+		{
+			if ((0 > cmp) && (NULL != blk->prev))
+				blk = NULL;	/* before this block and it is not the first block */
+			pos = 0;
+		} else
+		{
+			if (prefix != blk->prefix[last])
+				cmp = (prefix < blk->prefix[last]) ? -1 : 1;
+			else
+				cmp = lvAvlTreeKeySubscrCmp(key, blk->node[last]);
+			if (0 < cmp)
+			{
+				if (NULL != blk->next)
+					blk = NULL;	/* after this block and it is not the last block */
+				pos = blk ? blk->nkeys : 0;
+			} else if (0 == cmp)
+				pos = last;
+			else
+				pos = lvBtreeBlkSearch(blk, key, prefix, &cmp);
+		}
+	}
+	if (NULL == blk)
+	{	/* Clue did not help. Descend from the root. */
+		blk = lvt->bt_root;
+		while (blk->level)
+		{	/* Go to the last child whose lowest key is <= "key" (or to the first child if "key" is lower than all) */
+			pos = lvBtreeBlkSearch(blk, key, prefix, &cmp);
+			if (cmp && pos)
+				pos--;
+			blk = blk->child[pos];
+		}
+		pos = lvBtreeBlkSearch(blk, key, prefix, &cmp);
+	}
+	*leafp = blk;
+	*posp = pos;
+	node = ((pos < blk->nkeys) && (0 == cmp)) ? blk->node[pos] : NULL;
+	lvt->lastLookup.lastNodeLookedUp = (NULL != node) ? node : blk->node[(pos < blk->nkeys) ? pos : blk->nkeys - 1];
+	return node;
+}
+
+STATICFNDEF int lvBtreeChildIndex(lvBtreeBlk *parent, lvBtreeBlk *blk)
+{
+	int	i;
+
+	for (i = 0; parent->child[i] != blk; i++)
+		assert(i < parent->nkeys);
+	return i;
+}
+
+STATICFNDEF int lvBtreeNodeIndex(lvBtreeBlk *leaf, lvTreeNode *node)
+{
+	int	i;
+
+	for (i = 0; leaf->node[i] != node; i++)
+		assert(i < leaf->nkeys);
+	return i;
+}
+
+/* The lowest key in "blk" changed. Fix the entries pointing to "blk" in its ancestors as long as it is their lowest key too. */
+STATICFNDEF void lvBtreeFixMin(lvBtreeBlk *blk)
+{
+	lvBtreeBlk	*parent;
+	int		i;
+
+	assert(blk->nkeys);
+	for ( ; NULL != (parent = blk->parent); blk = parent)
+	{
+		i = lvBtreeChildIndex(parent, blk);
+		parent->prefix[i] = blk->prefix[0];
+		parent->node[i] = blk->node[0];
+		if (i)
+			break;
+	}
+}
+
+/* Inserts an entry at position "pos" of "blk". For a leaf block "node" is the new lv node and "child" is NULL.
+ * For an index block "child" is the new child block and "node"/"prefix" its lowest key.
+ * A full block is split in two halves. If the new entry goes past the end of the rightmost block of its level (e.g. keys
+ * being added in collating order), the full block is left as is and the new entry starts a new block instead.
+ */
+STATICFNDEF void lvBtreeBlkInsert(lvTree *lvt, lvBtreeBlk *blk, int pos, gtm_uint64_t prefix, lvTreeNode *node,
+					lvBtreeBlk *child)
+{
+	lvBtreeBlk	*newblk, *target, *root;
+	int		split, n, i;
+
+	assert((0 <= pos) && (pos <= blk->nkeys));
+	assert((NULL == child) == (0 == blk->level));
+	newblk = NULL;
+	target = blk;
+	if (LV_BTREE_FANOUT == blk->nkeys)
+	{
+		split = ((LV_BTREE_FANOUT == pos) && (NULL == blk->next)) ? LV_BTREE_FANOUT : (LV_BTREE_FANOUT / 2);
+		newblk = lvBtreeBlkAlloc(blk->level);
+		n = LV_BTREE_FANOUT - split;
+		memcpy(&newblk->prefix[0], &blk->prefix[split], n * SIZEOF(blk->prefix[0]));
+		memcpy(&newblk->node[0], &blk->node[split], n * SIZEOF(blk->node[0]));
+		if (blk->level)
+		{
+			memcpy(&newblk->child[0], &blk->child[split], n * SIZEOF(blk->child[0]));
+			for (i = 0; i < n; i++)
+				newblk->child[i]->parent = newblk;
+		} else
+		{
+			for (i = 0; i < n; i++)
+				newblk->node[i]->avl_parent = (lvTreeNode *)newblk;
+		}
+		newblk->nkeys = n;
+		blk->nkeys = split;
+		newblk->parent = blk->parent;
+		newblk->prev = blk;
+		newblk->next = blk->next;
+		if (NULL != blk->next)
+			blk->next->prev = newblk;
+		blk->next = newblk;
+		if (pos >= split)
+		{	/* "newblk" is not yet linked into the parent so its lowest key can change freely */
+			target = newblk;
+			pos -= split;
+		}
+	}
+	n = target->nkeys - pos;
+	memmove(&target->prefix[pos + 1], &target->prefix[pos], n * SIZEOF(target->prefix[0]));
+	memmove(&target->node[pos + 1], &target->node[pos], n * SIZEOF(target->node[0]));
+	target->prefix[pos] = prefix;
+	target->node[pos] = node;
+	if (NULL != child)
+	{
+		memmove(&target->child[pos + 1], &target->child[pos], n * SIZEOF(target->child[0]));
+		target->child[pos] = child;
+		child->parent = target;
+	} else
+		node->avl_parent = (lvTreeNode *)target;
+	target->nkeys++;
+	if ((target == blk) && (0 == pos))
+		lvBtreeFixMin(blk);
+	if (NULL == newblk)
+		return;
+	if (NULL == blk->parent)
+	{	/* Split the root. The tree grows one level taller. */
+		root = lvBtreeBlkAlloc(blk->level + 1);
+		root->prefix[0] = blk->prefix[0];
+		root->node[0] = blk->node[0];
+		root->child[0] = blk;
+		root->prefix[1] = newblk->prefix[0];
+		root->node[1] = newblk->node[0];
+		root->child[1] = newblk;
+		root->nkeys = 2;
+		blk->parent = newblk->parent = root;
+		lvt->bt_root = root;
+	} else
+		lvBtreeBlkInsert(lvt, blk->parent, lvBtreeChildIndex(blk->parent, blk) + 1, newblk->prefix[0], newblk->node[0],
+					newblk);
+}
+
+/* Removes the entry at position "pos" of "blk". A block that becomes empty is freed and removed from its parent. */
+STATICFNDEF void lvBtreeBlkRemove(lvTree *lvt, lvBtreeBlk *blk, int pos)
+{
+	lvBtreeBlk	*parent;
+	int		n;
+
+	assert((0 <= pos) && (pos < blk->nkeys));
+	n = --blk->nkeys - pos;
+	memmove(&blk->prefix[pos], &blk->prefix[pos + 1], n * SIZEOF(blk->prefix[0]));
+	memmove(&blk->node[pos], &blk->node[pos + 1], n * SIZEOF(blk->node[0]));
+	if (blk->level)
+		memmove(&blk->child[pos], &blk->child[pos + 1], n * SIZEOF(blk->child[0]));
+	if (blk->nkeys)
+	{
+		if (0 == pos)
+			lvBtreeFixMin(blk);
+		return;
+	}
+	if (NULL != blk->prev)
+		blk->prev->next = blk->next;
+	if (NULL != blk->next)
+		blk->next->prev = blk->prev;
+	parent = blk->parent;
+	if (NULL == parent)
+		lvt->bt_root = NULL;
+	else
+		lvBtreeBlkRemove(lvt, parent, lvBtreeChildIndex(parent, blk));
+	free(blk);
+}
+
+/* Converts the AVL tree of "lvt" into a B+tree. Called once the AVL tree gets taller than LV_BTREE_MIN_AVL_HEIGHT. */
+void lvBtreeConvert(lvTree *lvt)
+{
+	lvBtreeBlk	*blk, *first, *last, *parent;
+	lvTreeNode	*node;
+	int		i;
+	uint4		level;
+
+	assert(NULL == lvt->bt_root);
+	assert(NULL != lvt->avl_root);
+	/* First collect the nodes in key order into leaf blocks. The AVL links of the nodes are needed to find the in-order
+	 * successor so do not touch the nodes until the traversal is done.
+	 */
+	first = last = NULL;
+	for (node = lvAvlTreeFirst(lvt); NULL != node; node = lvAvlTreeNext(node))
+	{
+		if ((NULL == last) || (LV_BTREE_LOAD == last->nkeys))
+		{
+			blk = lvBtreeBlkAlloc(0);
+			if (NULL == last)
+				first = blk;
+			else
+			{
+				last->next = blk;
+				blk->prev = last;
+			}
+			last = blk;
+		}
+		i = last->nkeys++;
+		last->prefix[i] = lvBtreeNodePrefix(node);
+		last->node[i] = node;
+	}
+	for (blk = first; NULL != blk; blk = blk->next)
+	{
+		for (i = 0; i < blk->nkeys; i++)
+		{
+			node = blk->node[i];
+			node->balance = TREE_IN_BTREE;
+			node->avl_left = node->avl_right = NULL;
+			node->avl_parent = (lvTreeNode *)blk;
+		}
+	}
+	/* Now build the index levels bottom up until a level has only one block */
+	for (level = 1; NULL != first->next; level++)
+	{
+		parent = last = NULL;
+		for (blk = first; NULL != blk; blk = blk->next)
+		{
+			if ((NULL == parent) || (LV_BTREE_FANOUT == parent->nkeys))
+			{
+				parent = lvBtreeBlkAlloc(level);
+				if (NULL == last)
+					first = parent;
+				else
+				{
+					last->next = parent;
+					parent->prev = last;
+				}
+				last = parent;
+			}
+			i = parent->nkeys++;
+			parent->prefix[i] = blk->prefix[0];
+			parent->node[i] = blk->node[0];
+			parent->child[i] = blk;
+			blk->parent = parent;
+		}
+	}
+	lvt->bt_root = first;
+	lvt->avl_root = NULL;
+	lvt->lastLookup.lastNodeLookedUp = NULL;
+	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
+}
+
+lvTreeNode *lvBtreeLookup(lvTree *lvt, treeKeySubscr *key)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+
+	return lvBtreeSearch(lvt, key, &leaf, &pos);
+}
+
+/* Inserts "node" (already allocated and with its key initialized from "key" by "lvAvlTreeNodeInsert") into the B+tree */
+void lvBtreeNodeInsert(lvTree *lvt, treeKeySubscr *key, lvTreeNode *node)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+	DEBUG_ONLY(lvTreeNode	*found;)
+
+	DEBUG_ONLY(found =) lvBtreeSearch(lvt, key, &leaf, &pos);
+	assert(NULL == found);
+	node->balance = TREE_IN_BTREE;
+	node->avl_left = node->avl_right = NULL;
+	lvBtreeBlkInsert(lvt, leaf, pos, lvBtreeKeyPrefix(key), node, NULL);
+	lvt->lastLookup.lastNodeLookedUp = node;
+	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
+}
+
+void lvBtreeNodeDelete(lvTree *lvt, lvTreeNode *node)
+{
+	lvBtreeBlk	*root;
+
+	assert(TREE_IN_BTREE == node->balance);
+	lvt->lastLookup.lastNodeLookedUp = NULL;
+	lvBtreeBlkRemove(lvt, LV_BTREE_LEAF(node), lvBtreeNodeIndex(LV_BTREE_LEAF(node), node));
+	/* Shorten the tree while the root has just one child */
+	while ((NULL != (root = lvt->bt_root)) && root->level && (1 == root->nkeys))
+	{
+		lvt->bt_root = root->child[0];
+		lvt->bt_root->parent = NULL;
+		free(root);
+	}
+	if (NULL == lvt->bt_root)
+		lvt->avl_height = 0;	/* level is now empty; lv_kill and LV_HAS_CHILD rely on this */
+}
+
+lvTreeNode *lvBtreeFirst(lvTree *lvt)
+{
+	lvBtreeBlk	*blk;
+
+	for (blk = lvt->bt_root; blk->level; blk = blk->child[0])
+		;
+	return blk->node[0];
+}
+
+lvTreeNode *lvBtreeLast(lvTree *lvt)
+{
+	lvBtreeBlk	*blk;
+
+	for (blk = lvt->bt_root; blk->level; blk = blk->child[blk->nkeys - 1])
+		;
+	return blk->node[blk->nkeys - 1];
+}
+
+lvTreeNode *lvBtreeNext(lvTreeNode *node)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+
+	leaf = LV_BTREE_LEAF(node);
+	pos = lvBtreeNodeIndex(leaf, node) + 1;
+	if (pos < leaf->nkeys)
+		return leaf->node[pos];
+	return (NULL != (leaf = leaf->next)) ? leaf->node[0] : NULL;
+}
+
+lvTreeNode *lvBtreePrev(lvTreeNode *node)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+
+	leaf = LV_BTREE_LEAF(node);
+	pos = lvBtreeNodeIndex(leaf, node);
+	if (pos)
+		return leaf->node[pos - 1];
+	return (NULL != (leaf = leaf->prev)) ? leaf->node[leaf->nkeys - 1] : NULL;
+}
+
+lvTreeNode *lvBtreeKeyNext(lvTree *lvt, treeKeySubscr *key)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+
+	if (NULL != lvBtreeSearch(lvt, key, &leaf, &pos))
+		pos++;
+	if (pos < leaf->nkeys)
+		return leaf->node[pos];
+	return (NULL != (leaf = leaf->next)) ? leaf->node[0] : NULL;
+}
+
+lvTreeNode *lvBtreeKeyPrev(lvTree *lvt, treeKeySubscr *key)
+{
+	lvBtreeBlk	*leaf;
+	int		pos;
+
+	lvBtreeSearch(lvt, key, &leaf, &pos);
+	if (pos)
+		return leaf->node[pos - 1];
+	return (NULL != (leaf = leaf->prev)) ? leaf->node[leaf->nkeys - 1] : NULL;
+}
+
+STATICFNDEF lvBtreeBlk *lvBtreeBlkClone(lvBtreeBlk *blk, lvTree *cloneTree, lvBtreeBlk *parent, lvBtreeBlk **lastBlk,
+					boolean_t refCntMaint)
+{
+	lvBtreeBlk	*cloneBlk;
+	lvTreeNode	*cloneNode;
+	int		i;
+
+	cloneBlk = lvBtreeBlkAlloc(blk->level);
+	memcpy(&cloneBlk->prefix[0], &blk->prefix[0], blk->nkeys * SIZEOF(blk->prefix[0]));
+	cloneBlk->nkeys = blk->nkeys;
+	cloneBlk->parent = parent;
+	if (NULL != (cloneBlk->prev = lastBlk[blk->level]))
+		cloneBlk->prev->next = cloneBlk;
+	lastBlk[blk->level] = cloneBlk;
+	for (i = 0; i < blk->nkeys; i++)
+	{
+		if (blk->level)
+		{
+			cloneBlk->child[i] = lvBtreeBlkClone(blk->child[i], cloneTree, cloneBlk, lastBlk, refCntMaint);
+			cloneBlk->node[i] = cloneBlk->child[i]->node[0];
+		} else
+		{
+			cloneNode = lvTreeNodeClone(blk->node[i], cloneTree, refCntMaint);
+			cloneNode->avl_left = cloneNode->avl_right = NULL;
+			cloneNode->avl_parent = (lvTreeNode *)cloneBlk;
+			cloneBlk->node[i] = cloneNode;
+		}
+	}
+	return cloneBlk;
+}
+
+/* Clones the B+tree of "lvt" (and all lv nodes in it) into "cloneTree" (used by the LV_TREE_CLONE macro). Unlike the AVL
+ * tree clone, the new tree does not need to be rebuilt node by node: the blocks are copied as is.
+ */
+void lvBtreeClone(lvTree *lvt, lvTree *cloneTree, boolean_t refCntMaint)
+{
+	lvBtreeBlk	*lastBlk[LV_BTREE_MAX_LEVELS];
+
+	assertpro(lvt->bt_root->level < LV_BTREE_MAX_LEVELS);
+	memset(lastBlk, 0, SIZEOF(lastBlk));
+	cloneTree->bt_root = lvBtreeBlkClone(lvt->bt_root, cloneTree, NULL, lastBlk, refCntMaint);
+}
+
+STATICFNDEF void lvBtreeBlkFree(lvBtreeBlk *blk)
+{
+	int	i;
+
+	if (blk->level)
+	{
+		for (i = 0; i < blk->nkeys; i++)
+			lvBtreeBlkFree(blk->child[i]);
+	}
+	free(blk);
+}
+
+/* Frees the B+tree blocks of "lvt". The lv nodes themselves are freed by the caller. */
+void lvBtreeFree(lvTree *lvt)
+{
+	assert(NULL != lvt->bt_root);
+	lvBtreeBlkFree(lvt->bt_root);
+	lvt->bt_root = NULL;
+}
+
+#ifdef DEBUG
+boolean_t lvBtreeIsWellFormed(lvTree *lvt)
+{
+	lvBtreeBlk	*blk, *first, *leaf;
+	lvTreeNode	*node, *prevNode;
+	int		i;
+
+	assert(NULL == lvt->avl_root);
+	assert(lvt->avl_height);
+	assert(NULL == lvt->bt_root->parent);
+	prevNode = NULL;
+	for (first = lvt->bt_root; NULL != first; first = first->level ? first->child[0] : NULL)
+	{
+		assert(NULL == first->prev);
+		for (blk = first; NULL != blk; blk = blk->next)
+		{
+			assert(blk->nkeys && (LV_BTREE_FANOUT >= blk->nkeys));
+			assert((NULL == blk->next) || (blk->next->prev == blk));
+			assert((NULL == blk->next) || (blk->next->level == blk->level));
+			for (i = 0; i < blk->nkeys; i++)
+			{
+				node = blk->node[i];
+				assert(blk->prefix[i] == lvBtreeNodePrefix(node));
+				if (blk->level)
+				{
+					assert(blk->child[i]->parent == blk);
+					assert(blk->child[i]->level + 1 == blk->level);
+					assert(node == blk->child[i]->node[0]);
+					continue;
+				}
+				assert(node->tree_parent == lvt);
+				assert(TREE_IN_BTREE == node->balance);
+				assert(LV_BTREE_LEAF(node) == blk);
+				assert((NULL == prevNode) || (0 > lvAvlTreeNodeSubscrCmp(prevNode, node)));
+				prevNode = node;
+				if (NULL != node->sbs_child)
+					assert(lvTreeIsWellFormed(node->sbs_child));
+			}
+		}
+	}
+	if (NULL != (node = lvt->lastLookup.lastNodeLookedUp))
+	{
+		leaf = LV_BTREE_LEAF(node);
+		assert(node == leaf->node[lvBtreeNodeIndex(leaf, node)]);
+	}
+	return TRUE;
+}
+#endif
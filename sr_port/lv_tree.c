@@ -3,7 +3,7 @@
  * Copyright (c) 2011-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -267,10 +267,9 @@ STATICFNDEF void lvAvlTreeNodeFltConv(lvTreeNodeNum *fltNode)
 	}													\
 }
 
-#ifdef DEBUG
-/* This function is currently DEBUG-only because no one is supposed to be calling it.
- * Callers are usually performance sensitive and should therefore use the LV_AVL_TREE_NUMKEY_CMP
- * or LV_AVL_TREE_STRKEY_CMP macros that this function in turn invokes.
+/* Callers in the AVL tree code are usually performance sensitive and should therefore use the LV_AVL_TREE_NUMKEY_CMP
+ * or LV_AVL_TREE_STRKEY_CMP macros that this function in turn invokes. The B+tree code (lv_btree.c) calls this only
+ * when the 8-byte key prefixes it compares first are equal.
  */
 int lvAvlTreeKeySubscrCmp(treeKeySubscr *aSubscr, lvTreeNode *bNode)
 {
@@ -289,6 +288,7 @@ int lvAvlTreeKeySubscrCmp(treeKeySubscr *aSubscr, lvTreeNode *bNode)
 	return retVal;
 }
 
+#ifdef DEBUG
 /* This function is currently coded not as efficiently as it needs to be because it is only invoked by dbg code.
  * Hence the definition inside a #ifdef DEBUG. If this change and pro code needs it, the below code needs to be revisited.
  */
@@ -393,6 +393,8 @@ lvTreeNode *lvAvlTreeFirst(lvTree *lvt)
 {
 	lvTreeNode	*avl_first, *next;
 
+	if (NULL != lvt->bt_root)
+		return lvBtreeFirst(lvt);
 	next = lvt->avl_root;
 	if (NULL == next)
 		return NULL;
@@ -409,6 +411,8 @@ lvTreeNode *lvAvlTreeLast(lvTree *lvt)
 {
 	lvTreeNode	*avl_last, *next;
 
+	if (NULL != lvt->bt_root)
+		return lvBtreeLast(lvt);
 	next = lvt->avl_root;
 	if (NULL == next)
 		return NULL;
@@ -453,6 +457,8 @@ lvTreeNode *lvAvlTreePrev(lvTreeNode *node)
 	lvTreeNode	*prev, *tmp, *parent;
 
 	assert(NULL != node);
+	if (LV_NODE_IN_BTREE(node))
+		return lvBtreePrev(node);
 	prev = node->avl_left;
 	if (NULL != prev)
 	{	/* in-order predecessor is BELOW "node" */
@@ -486,6 +492,8 @@ lvTreeNode *lvAvlTreeKeyPrev(lvTree *lvt, treeKeySubscr *key)
 {
 	lvTreeNode	*node, *tmp, *prev, *parent;
 
+	if (NULL != lvt->bt_root)
+		return lvBtreeKeyPrev(lvt, key);
 	node = lvAvlTreeLookup(lvt, key, &parent);
 	if (NULL != node)	/* most common case */
 	{
@@ -520,6 +528,8 @@ lvTreeNode *lvAvlTreeNext(lvTreeNode *node)
 	lvTreeNode	*next, *tmp, *parent;
 
 	assert(NULL != node);
+	if (LV_NODE_IN_BTREE(node))
+		return lvBtreeNext(node);
 	next = node->avl_right;
 	if (NULL != next)
 	{	/* in-order successor is BELOW "node" */
@@ -554,6 +564,8 @@ lvTreeNode *lvAvlTreeKeyNext(lvTree *lvt, treeKeySubscr *key)
 {
 	lvTreeNode	*node, *tmp, *next, *parent;
 
+	if (NULL != lvt->bt_root)
+		return lvBtreeKeyNext(lvt, key);
 	node = lvAvlTreeLookup(lvt, key, &parent);
 	if (NULL != node)	/* most common case */
 	{
@@ -585,6 +597,8 @@ lvTreeNode *lvAvlTreeFirstPostOrder(lvTree *lvt)
 {
 	lvTreeNode	*first, *tmp;
 
+	if (NULL != lvt->bt_root)
+		return lvBtreeFirst(lvt);	/* B+tree nodes have no links between them so in-order is fine */
 	first = lvt->avl_root;
 	if (NULL == first)
 		return NULL;
@@ -607,6 +621,8 @@ lvTreeNode *lvAvlTreeNextPostOrder(lvTreeNode *node)
 	lvTreeNode		*next, *tmp, *parent;
 
 	assert(NULL != node);
+	if (LV_NODE_IN_BTREE(node))
+		return lvBtreeNext(node);
 	parent = node->avl_parent;
 	if (NULL == parent)	/* Reached root node of the AVL tree in the post order traversal */
 		return NULL;	/* Done with post-order traversal */
@@ -766,11 +782,12 @@ lvTreeNode *lvAvlTreeKeyCollatedPrev(lvTree *lvt, treeKeySubscr *key)
 	return node;
 }
 
-/* Function to clone an avl tree (used by the LV_TREE_CLONE macro). Uses recursion to descend the tree. */
-lvTreeNode *lvAvlTreeCloneSubTree(lvTreeNode *node, lvTree *lvt, lvTreeNode *avl_parent, boolean_t refCntMaint)
+/* Function to clone one node (and the subscript levels underneath it) into the tree "lvt". The caller sets up the links of
+ * the cloned node within "lvt" (used by the AVL tree and B+tree clone functions).
+ */
+lvTreeNode *lvTreeNodeClone(lvTreeNode *node, lvTree *lvt, boolean_t refCntMaint)
 {
-        lvTreeNode        *cloneNode, *left, *right;
-        lvTreeNode        *leftSubTree, *rightSubTree;
+        lvTreeNode        *cloneNode;
 	lvTree		*lvt_child;
 	lv_val		*base_lv, *cntnr_lv;
 
@@ -816,7 +833,6 @@ lvTreeNode *lvAvlTreeCloneSubTree(lvTreeNode *node, lvTree *lvt, lvTreeNode *avl
 		assert(IS_OFFSET_AND_SIZE_MATCH(lvTreeNode, filler_8byte, lvTreeNodeNum, key_m1));
 		((lvTreeNodeNum *)cloneNode)->key_m1 = ((lvTreeNodeNum *)node)->key_m1;
 	)
-	cloneNode->avl_parent = avl_parent;
 	lvt_child = node->sbs_child;
 	base_lv = lvt->base_lv;
 	if (NULL != lvt_child)
@@ -824,6 +840,18 @@ lvTreeNode *lvAvlTreeCloneSubTree(lvTreeNode *node, lvTree *lvt, lvTreeNode *avl
 		LV_TREE_CLONE(lvt_child, cloneNode, base_lv, refCntMaint);	/* initializes "cloneNode->sbs_child" */
 	} else
 		cloneNode->sbs_child = NULL;
+	return cloneNode;
+}
+
+/* Function to clone an avl tree (used by the LV_TREE_CLONE macro). Uses recursion to descend the tree. */
+lvTreeNode *lvAvlTreeCloneSubTree(lvTreeNode *node, lvTree *lvt, lvTreeNode *avl_parent, boolean_t refCntMaint)
+{
+        lvTreeNode        *cloneNode, *left, *right;
+        lvTreeNode        *leftSubTree, *rightSubTree;
+
+	assert(NULL != node);
+	cloneNode = lvTreeNodeClone(node, lvt, refCntMaint);
+	cloneNode->avl_parent = avl_parent;
 	left = node->avl_left;
 	leftSubTree = (NULL != left) ? lvAvlTreeCloneSubTree(left, lvt, cloneNode, refCntMaint) : NULL;
 	cloneNode->avl_left = leftSubTree;
@@ -879,6 +907,8 @@ boolean_t lvTreeIsWellFormed(lvTree *lvt)
 		assert(sbs_depth == lvt->sbs_depth);
 		/* Check lvt->base_lv */
 		assert((lv_val *)sbs_parent == lvt->base_lv);
+		if (NULL != lvt->bt_root)
+			return lvBtreeIsWellFormed(lvt);
 		/* Note: lvt->avl_height is checked in lvAvlTreeNodeIsWellFormed */
 		/* Check lvt->avl_root */
 		if (NULL != (avl_root = lvt->avl_root))
@@ -1072,6 +1102,11 @@ lvTreeNode *lvAvlTreeLookupInt(lvTree *lvt, treeKeySubscr *key, lvTreeNode **loo
 	assert(TREE_KEY_SUBSCR_IS_CANONICAL(key->mvtype));
 	assert(MVTYPE_IS_INT(key->mvtype));
 	assert(NULL != lookupParent);
+	if (NULL != lvt->bt_root)
+	{
+		*lookupParent = NULL;	/* "lvAvlTreeNodeInsert" does not need a parent for a B+tree */
+		return lvBtreeLookup(lvt, key);
+	}
 	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
 	key_m1 = key->m[1];
 	/* First see if node can be looked up easily from the lastLookup clue (without a tree traversal) */
@@ -1221,6 +1256,11 @@ lvTreeNode *lvAvlTreeLookupNum(lvTree *lvt, treeKeySubscr *key, lvTreeNode **loo
 	assert(TREE_KEY_SUBSCR_IS_CANONICAL(key->mvtype));
 	assert(!MVTYPE_IS_INT(key->mvtype));
 	assert(NULL != lookupParent);
+	if (NULL != lvt->bt_root)
+	{
+		*lookupParent = NULL;	/* "lvAvlTreeNodeInsert" does not need a parent for a B+tree */
+		return lvBtreeLookup(lvt, key);
+	}
 	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
 	/* First see if node can be looked up easily from the lastLookup clue (without a tree traversal) */
 	lastLookup = &lvt->lastLookup;
@@ -1370,6 +1410,11 @@ lvTreeNode *lvAvlTreeLookupStr(lvTree *lvt, treeKeySubscr *key, lvTreeNode **loo
 	assert(!TREE_KEY_SUBSCR_IS_CANONICAL(key->mvtype));
 	assert(MVTYPE_IS_STRING(key->mvtype));
 	assert(NULL != lookupParent);
+	if (NULL != lvt->bt_root)
+	{
+		*lookupParent = NULL;	/* "lvAvlTreeNodeInsert" does not need a parent for a B+tree */
+		return lvBtreeLookup(lvt, key);
+	}
 	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
 	key_addr = key->str.addr;
 	key_len = key->str.len;
@@ -1760,6 +1805,12 @@ lvTreeNode *lvAvlTreeNodeInsert(lvTree *lvt, treeKeySubscr *key, lvTreeNode *par
 		node->key_addr = key->str.addr;
 	}
 	node->balance = TREE_BALANCED;
+	if (NULL != lvt->bt_root)
+	{	/* This subscript level has already been converted to a B+tree */
+		assert(NULL == parent);
+		lvBtreeNodeInsert(lvt, key, node);
+		return node;
+	}
 	/* node->descent_dir is initialized later when this node is part of a lvAvlTreeLookup operation.
 	 * this field is not used by anyone until then so ok not to initialize it here.
 	 * Update lastLookup clue to reflect the newly inserted node. Note that this clue will continue
@@ -1846,6 +1897,8 @@ lvTreeNode *lvAvlTreeNodeInsert(lvTree *lvt, treeKeySubscr *key, lvTreeNode *par
 		lastLookup->lastNodeMin = NULL;	/* ensure lastLookup clue is uptodate */
 		lastLookup->lastNodeMax = NULL;	/* ensure lastLookup clue is uptodate */
 	}
+	if (LV_BTREE_MIN_AVL_HEIGHT < lvt->avl_height)
+		lvBtreeConvert(lvt);	/* AVL tree has gotten too tall; switch this subscript level to a B+tree */
 	TREE_DEBUG_ONLY(assert(lvTreeIsWellFormed(lvt));)
 	return node;
 }
@@ -1887,6 +1940,11 @@ void lvAvlTreeNodeDelete(lvTree *lvt, lvTreeNode *node)
 	assert(IS_LVAVLTREENODE(((lv_val *)node)));	/* ensure input "node" is of type "lvTreeNode *" or "lvTreeNodeNum *"
 							 * and not "lv_val *" */
 	assert(lvt == node->tree_parent);
+	if (LV_NODE_IN_BTREE(node))
+	{
+		lvBtreeNodeDelete(lvt, node);
+		return;
+	}
 	nodeLeft = node->avl_left;
 	nodeRight = node->avl_right;
 	nodeParent = node->avl_parent;
@@ -2055,6 +2113,8 @@ void lvAvlTreeNodePrepareForDelete(lvTreeNode *node)
 	lvTreeNode	*curNode, *parentNode;
 
 	assert(NULL != node);
+	if (LV_NODE_IN_BTREE(node))
+		return;	/* B+tree deletes do not need any descent path */
 	curNode = node;
 	for ( ; ; )
 	{
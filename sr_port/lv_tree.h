@@ -3,7 +3,7 @@
  * Copyright (c) 2011-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -130,8 +130,37 @@ typedef struct lvTreeStruct
 					     */
 	lvTreeNode		*sbs_parent;/* pointer to parent (points to lv_val if sbs_depth==1 and lvTreeNode if sbs_depth>1) */
 	treeSrchStatus		lastLookup; /* clue to last node lookup in the AVL tree rooted at "avl_root" */
+	struct lvBtreeBlkStruct	*bt_root;   /* if non-NULL, this subscript level is a B+tree (see lv_btree.c) rooted here and
+					     * "avl_root" is NULL.
+					     */
 } lvTree;
 
+/* Large subscript levels are converted from an AVL tree to a B+tree (see lv_btree.c) with blocks of the following layout.
+ * "prefix[i]" is an order preserving 8-byte prefix of the key of "node[i]". In index blocks (level > 0), "node[i]" is
+ * the lowest key underneath "child[i]". Leaf blocks (level == 0) are allocated without the "child" array.
+ */
+#define	LV_BTREE_FANOUT		32	/* max # of entries in a B+tree block */
+#define	LV_BTREE_MIN_AVL_HEIGHT	12	/* an AVL tree taller than this is converted to a B+tree (at least 2**11 nodes) */
+#define	LV_BTREE_MAX_LEVELS	16	/* max # of levels in a B+tree (sizes the work array in lvBtreeClone) */
+
+typedef struct lvBtreeBlkStruct
+{
+	struct lvBtreeBlkStruct	*parent;	/* index block pointing to this block (NULL for the root) */
+	struct lvBtreeBlkStruct	*prev;		/* previous block at the same level */
+	struct lvBtreeBlkStruct	*next;		/* next block at the same level */
+	uint4			nkeys;		/* # of entries in use */
+	uint4			level;		/* 0 for leaf blocks */
+	gtm_uint64_t		prefix[LV_BTREE_FANOUT];
+	lvTreeNode		*node[LV_BTREE_FANOUT];
+	struct lvBtreeBlkStruct	*child[LV_BTREE_FANOUT];
+} lvBtreeBlk;
+
+/* A node in a B+tree has its "balance" field set to TREE_IN_BTREE and its "avl_parent" field overloaded to point to the
+ * leaf block containing it. Its "avl_left" and "avl_right" fields are NULL.
+ */
+#define	LV_BTREE_LEAF(NODE)	((lvBtreeBlk *)(NODE)->avl_parent)
+#define	LV_NODE_IN_BTREE(NODE)	(TREE_IN_BTREE == (NODE)->balance)
+
 /* This section defines macros for the AVL tree implementation. Note that an AVL tree maintains its log(n) height by ensuring
  * the left and right subtrees at any level never differ in height by more than 1.
  */
@@ -148,6 +177,7 @@ typedef struct lvTreeStruct
 #define TREE_LEFT_HEAVY		0	/* should be same as TREE_DESCEND_LEFT (an implementation efficiency) */
 #define TREE_RIGHT_HEAVY 	1	/* should be same as TREE_DESCEND_RIGHT (an implementation efficiency) */
 #define TREE_BALANCED		2
+#define TREE_IN_BTREE		3	/* not an AVL balance factor; node is part of a B+tree (see lv_btree.c) */
 
 #define TREE_IS_LEFT_HEAVY(bal)		(bal) == TREE_LEFT_HEAVY
 #define TREE_IS_RIGHT_HEAVY(bal)	(bal) == TREE_RIGHT_HEAVY
@@ -215,8 +245,8 @@ typedef struct lvTreeStruct
 
 #define	LV_NODE_KEY_IS_NULL_SUBS(NODE)	(LV_NODE_KEY_IS_STRING(NODE) && (0 == NODE->key_len))
 
-#ifdef DEBUG
 int 		lvAvlTreeKeySubscrCmp(treeKeySubscr *aSubscr, lvTreeNode *bNode);
+#ifdef DEBUG
 int 		lvAvlTreeNodeSubscrCmp(lvTreeNode *aNode, lvTreeNode *bNode);
 #endif
 lvTreeNode	*lvAvlTreeFirst(lvTree *lvt);
@@ -233,6 +263,7 @@ lvTreeNode	*lvAvlTreeNodeCollatedNext(lvTreeNode *node);
 lvTreeNode	*lvAvlTreeKeyCollatedPrev(lvTree *lvt, treeKeySubscr *key);
 lvTreeNode	*lvAvlTreeNodeCollatedPrev(lvTreeNode *node);
 lvTreeNode	*lvAvlTreeCloneSubTree(lvTreeNode *node, lvTree *lvt, lvTreeNode *avl_parent, boolean_t refCntMaint);
+lvTreeNode	*lvTreeNodeClone(lvTreeNode *node, lvTree *lvt, boolean_t refCntMaint);
 void		lvAvlTreeNodePrepareForDelete(lvTreeNode *node);
 
 #ifdef DEBUG
@@ -247,6 +278,22 @@ lvTreeNode	*lvAvlTreeLookup(lvTree *lvt, treeKeySubscr *key, lvTreeNode **lookup
 lvTreeNode	*lvAvlTreeNodeInsert(lvTree *lvt, treeKeySubscr *key, lvTreeNode *parent);
 void		lvAvlTreeNodeDelete(lvTree *lvt, lvTreeNode *node);
 
+void		lvBtreeConvert(lvTree *lvt);
+lvTreeNode	*lvBtreeLookup(lvTree *lvt, treeKeySubscr *key);
+void		lvBtreeNodeInsert(lvTree *lvt, treeKeySubscr *key, lvTreeNode *node);
+void		lvBtreeNodeDelete(lvTree *lvt, lvTreeNode *node);
+lvTreeNode	*lvBtreeFirst(lvTree *lvt);
+lvTreeNode	*lvBtreeLast(lvTree *lvt);
+lvTreeNode	*lvBtreeNext(lvTreeNode *node);
+lvTreeNode	*lvBtreePrev(lvTreeNode *node);
+lvTreeNode	*lvBtreeKeyNext(lvTree *lvt, treeKeySubscr *key);
+lvTreeNode	*lvBtreeKeyPrev(lvTree *lvt, treeKeySubscr *key);
+void		lvBtreeClone(lvTree *lvt, lvTree *cloneTree, boolean_t refCntMaint);
+void		lvBtreeFree(lvTree *lvt);
+#ifdef DEBUG
+boolean_t	lvBtreeIsWellFormed(lvTree *lvt);
+#endif
+
 /* The following LV_TREE_* macros are not defined as functions for performance reasons (to avoid overhead of parameter passing
  * and C stack push and pop)
  */
@@ -266,6 +313,7 @@ void		lvAvlTreeNodeDelete(lvTree *lvt, lvTreeNode *node);
 					   */										\
 	(SBS_PARENT)->sbs_child = NEWTREE;										\
 	NEWTREE->lastLookup.lastNodeLookedUp = NULL;									\
+	NEWTREE->bt_root = NULL;											\
 }
 
 #define	LV_TREE_NODE_DELETE(LVT, NODE)								\
@@ -292,7 +340,8 @@ void		lvAvlTreeNodeDelete(lvTree *lvt, lvTreeNode *node);
 	assert(OFFSETOF(lvTree, base_lv) + SIZEOF(LVT->base_lv) == OFFSETOF(lvTree, avl_root));				\
 	assert(OFFSETOF(lvTree, avl_root) + SIZEOF(LVT->avl_root) == OFFSETOF(lvTree, sbs_parent));			\
 	assert(OFFSETOF(lvTree, sbs_parent) + SIZEOF(LVT->sbs_parent) == OFFSETOF(lvTree, lastLookup));			\
-	assert(OFFSETOF(lvTree, lastLookup) + SIZEOF(LVT->lastLookup) == SIZEOF(lvTree));				\
+	assert(OFFSETOF(lvTree, lastLookup) + SIZEOF(LVT->lastLookup) == OFFSETOF(lvTree, bt_root));			\
+	assert(OFFSETOF(lvTree, bt_root) + SIZEOF(LVT->bt_root) == SIZEOF(lvTree));					\
 	/* Directly copy the first 3 fields */										\
 	memcpy(cloneTree, (LVT), OFFSETOF(lvTree, avl_height) + SIZEOF(LVT->avl_height));				\
 	cloneTree->base_lv = BASE_LV;											\
@@ -301,10 +350,15 @@ void		lvAvlTreeNodeDelete(lvTree *lvt, lvTreeNode *node);
 	(SBS_PARENT)->sbs_child = cloneTree;										\
 	/* reset clue in cloned tree as source tree pointers are no longer relevant in cloned tree */			\
 	cloneTree->lastLookup.lastNodeLookedUp = NULL;									\
+	cloneTree->bt_root = NULL;											\
 	if (NULL != (avl_root = (LVT)->avl_root))									\
         	cloneTree->avl_root = lvAvlTreeCloneSubTree(avl_root, cloneTree, NULL, (REFCNTMAINT));			\
 	else														\
+	{														\
         	cloneTree->avl_root = NULL;										\
+		if (NULL != (LVT)->bt_root)										\
+			lvBtreeClone((LVT), cloneTree, (REFCNTMAINT));							\
+	}														\
 }
 
 #ifdef TREE_DEBUG
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -480,6 +480,8 @@ void	set_active_lv(lv_val *newlv, boolean_t do_assert, int type);
 									\
 	sym = LVT_GET_SYMVAL(LVT);					\
 	assert(NULL != LVT_GET_PARENT(LVT));				\
+	if (NULL != LVT->bt_root)					\
+		lvBtreeFree(LVT);	/* free the B+tree blocks */	\
 	LVT_PARENT(LVT) = NULL;	/* indicates this is free */		\
 	/* avl_root is overloaded to store linked list in free state */	\
 	LVT->avl_root = (lvTreeNode *)sym->lvtree_flist;		\
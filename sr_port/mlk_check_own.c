@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -65,7 +68,7 @@ boolean_t	mlk_check_own(mlk_pvtblk *x)
 		} else if (BLOCKING_PROC_DEAD(x, time, icount, status))
 		{	/* process that owned lock has died, free lock. */
 			x->blocked->owner = 0;
-			csa->hdr->trans_hist.lock_sequence++;
+			MLK_BUMP_LOCK_SEQUENCE(csa);
 			ret_val = TRUE;
 		}
 	} else
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -38,7 +38,7 @@ static inline void prepare_for_gc(mlk_pvtctl_ptr_t pctl)
 	pid_t			old_gc;
 	mlk_ctldata_ptr_t	ctl;
 
-	assert(!LOCK_CRIT_HELD(pctl->csa));
+	assert(!LOCK_CRIT_HELD(pctl));
 
 	ctl = pctl->ctl;
 	while (TRUE)
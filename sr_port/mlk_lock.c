@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -147,7 +147,7 @@ gtm_uint64_t mlk_lock(mlk_pvtblk *p, UINTPTR_T auxown, boolean_t new)
 						p->nodptr = d;
 						p->sequence = d->sequence;
 					}
-					csa->hdr->trans_hist.lock_sequence++;
+					MLK_BUMP_LOCK_SEQUENCE(csa);
 				}
 			} else
 			{	/* Lock was not previously owned */
@@ -159,7 +159,7 @@ gtm_uint64_t mlk_lock(mlk_pvtblk *p, UINTPTR_T auxown, boolean_t new)
 						p->nodptr = d;
 						p->sequence = d->sequence;
 					}
-					csa->hdr->trans_hist.lock_sequence++;
+					MLK_BUMP_LOCK_SEQUENCE(csa);
 				} else
 				{	/* The lock is graciously granted */
 					if (!new)
@@ -175,7 +175,7 @@ gtm_uint64_t mlk_lock(mlk_pvtblk *p, UINTPTR_T auxown, boolean_t new)
 							&curr_entry->pvec->jpv_node[0], SIZEOF(curr_entry->pvec->jpv_node));
 						/* cases of calls from omi_prc_lock() and rc_prc_lock() are not currently handled */
 					}
-					d->sequence = p->sequence = csa->hdr->trans_hist.lock_sequence++;
+					d->sequence = p->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
 					MLK_LOGIN(d);
 					p->nodptr = d;
 					retval = 0;
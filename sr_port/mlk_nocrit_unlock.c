@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -22,14 +22,16 @@
 #include "gdsfhead.h"
 #include "filestruct.h"
 #include "mlkdef.h"
+#include "mlk_ops.h"
 #include "mlk_unlock.h"
 
 GBLREF	uint4 		process_id;
 
 /* This function is similar to "mlk_unlock" except that it does not get crit. So does what can be safely done
- * and leaves the rest to be done by the next guy who has crit and wants this lock. Note that this means processes
- * that are waiting on this lock might not be woken up right away but will eventually wake up in their sleep-poll wait loop.
- * But that is considered okay given the merits of this quick nocrit unlock (speedy process exit, no crit contention).
+ * and leaves the rest to be done by the next guy who has crit and wants this lock. Note that processes sleeping on
+ * this lock in "mlk_wait_blocked" are woken up right away but a process on its pending list is not sent a wakeup and, if
+ * it is not one of those sleepers, will eventually wake up in its sleep-poll wait loop. But that is considered okay given
+ * the merits of this quick nocrit unlock (speedy process exit, no crit contention).
  */
 void mlk_nocrit_unlock(mlk_pvtblk *p)
 {
@@ -46,13 +48,14 @@ void mlk_nocrit_unlock(mlk_pvtblk *p)
 	d = p->nodptr;
 	if ((d->owner == process_id) && (p->sequence == d->sequence))
 	{
-		d->sequence = csa->hdr->trans_hist.lock_sequence++;	/* bump sequence so waiters realize this lock is released */
+		d->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);	/* bump sequence so waiters realize this lock is released */
 		d->owner = 0;	/* Setting this marks the lock as available */
 		/* Note: The key unlock operation is setting d->owner to 0. The shared sequence increment can happen
 		 * before or after that. It is only a fast way to signal lock waiters of this unlock. Even if the sequence
 		 * increment actually happens way after the d->owner=0 (due to out-of-order executions), the worst is the
 		 * lock waiter might have waited a little more than necessary. No correctness issues.
 		 */
+		mlk_wake_blocked(&p->pvtctl, d);
 	}
 	return;
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2021-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2021-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -19,9 +19,15 @@
 /* mlk_ops.h */
 
 #include <sys/shm.h>
+#include <errno.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
 
 #include "interlock.h"
 #include "do_shmat.h"
+#include "mmrhash.h"
 
 static inline void mlk_pvtctl_set_ctl(mlk_pvtctl_ptr_t pctl, mlk_ctldata_ptr_t ctl)
 {
@@ -46,6 +52,18 @@ static inline void mlk_pvtctl_init(mlk_pvtctl_ptr_t pctl, struct gd_region_struc
 	pctl->hash_fail_cnt = 0;
 }
 
+/* Initializes "pctl" for the stripe of "reg"'s lock space that holds resources with the top level name "name" */
+static inline void mlk_pvtctl_init_name(mlk_pvtctl_ptr_t pctl, struct gd_region_struct *reg, unsigned char *name, int len)
+{
+	uint4	hash;
+
+	mlk_pvtctl_init(pctl, reg);
+	if ((NULL == pctl->ctl) || !MLK_CTL_IS_STRIPED(pctl->ctl))
+		return;
+	ydb_mmrhash_32(name, len, MLK_STRIPE_HASH_SEED, &hash);
+	MLK_PVTCTL_SET_CTL(*pctl, MLK_CTL_STRIPE(pctl->ctl, hash % pctl->ctl->num_stripes));
+}
+
 static inline void mlk_shrhash_insert(mlk_pvtctl_ptr_t pctl, int bucket_idx, int target_idx, uint4 shrblk_idx,
 				      mlk_subhash_val_t hash)
 {
@@ -75,7 +93,25 @@ static inline void rel_lock_crit(mlk_pvtctl_ptr_t pctl, boolean_t was_crit)
 		if (!was_crit)
 			rel_crit(pctl->region);
 	} else
-		rel_latch(&csa->nl->lock_crit);
+		rel_latch(LOCK_CRIT_LATCH(pctl));
+}
+
+/* Releases the LOCK crit of any stripe of "reg"'s lock space this process holds (used to get to a known state at exit) */
+static inline void rel_held_lock_crit(struct gd_region_struct *reg)
+{
+	GBLREF uint4	process_id;
+	mlk_pvtctl	pctl;
+	uint4		i, num_stripes;
+
+	mlk_pvtctl_init(&pctl, reg);
+	if (pctl.csa->lock_crit_with_db)
+		return;
+	for (i = 0, num_stripes = pctl.ctl->num_stripes; i < num_stripes; i++)
+	{
+		MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE(pctl.csa->mlkctl, i));
+		if (LOCK_CRIT_HELD(&pctl))
+			rel_lock_crit(&pctl, FALSE);
+	}
 }
 
 static inline void grab_lock_crit_intl(mlk_pvtctl_ptr_t pctl, boolean_t *ret_was_crit)
@@ -93,7 +129,7 @@ static inline void grab_lock_crit_intl(mlk_pvtctl_ptr_t pctl, boolean_t *ret_was
 	{	/* Return value of "grab_latch" does not need to be checked because we pass
 		 * in GRAB_LATCH_INDEFINITE_WAIT as the timeout.
 		 */
-		grab_latch(&csa->nl->lock_crit, GRAB_LATCH_INDEFINITE_WAIT, WS_38, csa);
+		grab_latch(LOCK_CRIT_LATCH(pctl), GRAB_LATCH_INDEFINITE_WAIT, WS_38, csa);
 		*ret_was_crit = FALSE;				/* Initialize to keep code analyzer happy */
 	}
 }
@@ -105,8 +141,18 @@ static inline void grab_lock_crit_and_sync(mlk_pvtctl_ptr_t pctl, boolean_t *ret
 	assert(NULL != pctl->ctl);
 	assert(NULL != pctl->csa);
 	assert(NULL != pctl->shrblk);
-	assert(pctl->ctl == pctl->csa->mlkctl);
 	assert(pctl->shrblk == (mlk_shrblk_ptr_t)R2A(pctl->ctl->blkbase) - 1);
+	if (MLK_CTL_IS_STRIPED(pctl->ctl))
+	{	/* Each stripe keeps its hash table inside the stripe (see mlk_shrhash_resize) */
+		assert(((sm_uc_ptr_t)pctl->ctl >= (sm_uc_ptr_t)pctl->csa->mlkctl)
+			&& ((sm_uc_ptr_t)pctl->ctl < (sm_uc_ptr_t)pctl->csa->mlkctl + pctl->csa->mlkctl_len));
+		grab_lock_crit_intl(pctl, ret_was_crit);
+		assert(MLK_CTL_BLKHASH_EXT != pctl->ctl->blkhash);
+		pctl->shrhash = (mlk_shrhash_ptr_t)R2A(pctl->ctl->blkhash);
+		pctl->shrhash_size = pctl->ctl->num_blkhash;
+		return;
+	}
+	assert(pctl->ctl == pctl->csa->mlkctl);
 	do
 	{
 		grab_lock_crit_intl(pctl, ret_was_crit);
@@ -150,4 +196,55 @@ static inline void grab_lock_crit_and_sync(mlk_pvtctl_ptr_t pctl, boolean_t *ret
 	pctl->shrhash_size = pctl->ctl->num_blkhash;
 }
 
+/* Sleeps until the shrblk blocking "p" changes its sequence number (the owner released it, LKE cleared it or it was
+ * recovered from a dead owner) or "msec" milliseconds pass, whichever comes first. The wait is bounded so a release whose
+ * wakeup is lost, and a blocking process that was kill -9ed (which never wakes anyone), only cost what self-wake polling did.
+ * Returns FALSE without sleeping if the node has already changed or futexes are not available, in which case the caller
+ * falls back to a timed sleep.
+ */
+static inline boolean_t mlk_wait_blocked(mlk_pvtblk *p, uint4 msec)
+{
+#	if defined(__linux__) && defined(SYS_futex)
+	struct timespec		ts;
+	mlk_ctldata_ptr_t	ctl;
+	boolean_t		slept;
+	uint4			blk_sequence;
+
+	assert(NULL != p->blocked);
+	ctl = p->pvtctl.ctl;
+	ts.tv_sec = msec / MILLISECS_IN_SEC;
+	ts.tv_nsec = (msec % MILLISECS_IN_SEC) * NANOSECS_IN_MSEC;
+	blk_sequence = p->blk_sequence;
+	INTERLOCK_ADD(&ctl->wake_waiters, 1);
+	SHM_READ_MEMORY_BARRIER;
+	/* The kernel rechecks that the sequence is still "blk_sequence" before sleeping so a wakeup issued by a release after
+	 * the above increment is not lost. EAGAIN means the node changed before we got to sleep.
+	 */
+	slept = (blk_sequence == p->blocked->sequence)
+		&& ((0 == syscall(SYS_futex, &p->blocked->sequence, FUTEX_WAIT, blk_sequence, &ts, NULL, 0))
+			|| (EAGAIN != errno));
+	INTERLOCK_ADD(&ctl->wake_waiters, -1);
+	return slept;
+#	else
+	return FALSE;
+#	endif
+}
+
+/* Called after changing the sequence number of "d" (normally with the stripe's LOCK crit held) to wake processes blocked by
+ * it in mlk_wait_blocked. With $ydb_lock_fifo set when the lock space was created, only the longest sleeping waiter is woken and
+ * it hands the wakeup on when it releases the lock; otherwise all waiters are woken and the fairness algorithm in
+ * mlk_shrblk_find sorts out who gets it.
+ */
+static inline void mlk_wake_blocked(mlk_pvtctl_ptr_t pctl, mlk_shrblk_ptr_t d)
+{
+#	if defined(__linux__) && defined(SYS_futex)
+	/* The interlocked read of "wake_waiters" is a full barrier between the caller's store of the sequence and the read of
+	 * "wake_waiters" (which the waiter increments before it reads the sequence in mlk_wait_blocked). A plain read could
+	 * be done before the store and miss a waiter that then sleeps on the old sequence until its timeout.
+	 */
+	if (0 < INTERLOCK_ADD(&pctl->ctl->wake_waiters, 0))
+		syscall(SYS_futex, &d->sequence, FUTEX_WAKE, pctl->ctl->wake_fifo ? 1 : INT_MAX, NULL, NULL, 0);
+#	endif
+}
+
 #endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -70,7 +70,7 @@ void	mlk_pvtblk_create (int subcnt, mval *extgbl1, va_list subptr)
 	va_list		mp;
 	int		i, len;
 	unsigned char	*cp, *cp_prev;
-	mval		*extgbl2, *mp_temp, val_xlated;
+	mval		*extgbl2, *mp_temp, *name, val_xlated;
 	mlk_pvtblk	*r;
 	gd_region	*reg;
 	gd_addr		*gld;
@@ -105,6 +105,7 @@ void	mlk_pvtblk_create (int subcnt, mval *extgbl1, va_list subptr)
 	VAR_COPY(mp, subptr);
 	mp_temp = va_arg(mp, mval *);
 	MV_FORCE_STR(mp_temp);
+	name = mp_temp;
 	/* If specified var name is global ^%Y*, the name is illegal to use in a LOCK command.
 	 * Ths first byte is '^' so skip it in the comparison.
 	 */
@@ -130,7 +131,7 @@ void	mlk_pvtblk_create (int subcnt, mval *extgbl1, va_list subptr)
 	 * Each string is preceeded by 1 byte string len.
 	 */
 	MLK_PVTBLK_ALLOC(len + subcnt, subcnt, 0, r);
-	MLK_PVTCTL_INIT(r->pvtctl, reg);
+	MLK_PVTCTL_INIT_NAME(r->pvtctl, reg, (unsigned char *)name->str.addr, name->str.len);
 	/* We can't do proper hashes for remote locks, so just skip hashing in the remote case. */
 	do_hash = (NULL != r->pvtctl.ctl);
 	r->translev = 1;
@@ -3,7 +3,7 @@
  * Copyright (c) 2019 Fidelity National Information		*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2021-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -73,7 +73,7 @@ void mlk_rehash(mlk_pvtctl_ptr_t pctl)
 	mlk_shrblk_ptr_t	root;
 	mlk_subhash_state_t	hs;
 
-	assert(LOCK_CRIT_HELD(pctl->csa));
+	assert(LOCK_CRIT_HELD(pctl));
 	root = (0 == pctl->ctl->blkroot) ? NULL : (mlk_shrblk_ptr_t)R2A(pctl->ctl->blkroot);
 	do {
 		memset(pctl->shrhash, 0, pctl->shrhash_size * SIZEOF(mlk_shrhash));
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  * 								*
  *	This source code contains the intellectual property	*
@@ -23,12 +23,40 @@
 #include "fileinfo.h"
 #include "gdsbt.h"
 #include "gdsfhead.h"
+#include "min_max.h"
 #include "mlk_shr_init.h"
 
+STATICFNDCL void mlk_shr_init_stripe(sm_uc_ptr_t base, int4 size);
+
 void mlk_shr_init(sm_uc_ptr_t base,
 		  int4 size,
 		  sgmnt_addrs *csa,
 		  boolean_t read_write)
+{
+	int			i, num_stripes, stripe_size;
+	mlk_ctldata_ptr_t	ctl;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	/* Split the lock space into as many stripes as requested but do not let a stripe get too small to be useful */
+	num_stripes = MAX(1, MIN((int)TREF(lock_stripes), size / MLK_MIN_STRIPE_SIZE));
+	assert(MLK_MAX_STRIPES >= num_stripes);
+	stripe_size = (1 == num_stripes) ? size : ROUND_DOWN2(size / num_stripes, SIZEOF(gtm_uint64_t));
+	for (i = 0; i < num_stripes; i++)
+	{
+		ctl = (mlk_ctldata_ptr_t)(base + (size_t)i * stripe_size);
+		mlk_shr_init_stripe((sm_uc_ptr_t)ctl, stripe_size);
+		ctl->num_stripes = num_stripes;
+		ctl->stripe_size = stripe_size;
+		ctl->wake_fifo = TREF(lock_fifo);
+	}
+	if (read_write)
+		csa->hdr->trans_hist.lock_sequence = 0;
+	return;
+}
+
+/* Lays out one stripe (or the entire lock space if not striped) */
+STATICFNDEF void mlk_shr_init_stripe(sm_uc_ptr_t base, int4 size)
 {
 	int			i, nr_blocks, nr_procs, shr_size, nr_buckets;
 	float			shrblk_adj, shrhash_adj;
@@ -89,8 +117,6 @@ void mlk_shr_init(sm_uc_ptr_t base,
 	cp = (sm_uc_ptr_t)base + size;
 	A2R(ctl->subtop ,cp);
 	assert(ctl->subtop > ctl->subbase);
-	if (read_write)
-		csa->hdr->trans_hist.lock_sequence = 0;
 	ctl->hash_shmid = INVALID_SHMID;
 	ctl->hash_seed = 0;
 	return;
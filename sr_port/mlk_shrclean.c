@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -41,7 +41,7 @@ GBLREF uint4	process_id;
 #define PROC_TABLE_SIZE 16384
 
 void fill_pid_table(mlk_shrblk_ptr_t d, pid_t *table, mlk_pvtctl_ptr_t pctl);
-void check_pids(pid_t *table, char *dead_table, sgmnt_addrs *csa);
+void check_pids(pid_t *table, char *dead_table, mlk_pvtctl_ptr_t pctl);
 void clean_pids(mlk_shrblk_ptr_t d, pid_t *pid_table, char *dead_table, mlk_pvtctl_ptr_t pctl);
 
 /**
@@ -56,7 +56,7 @@ void mlk_shrclean(mlk_pvtctl_ptr_t pctl)
 	char dead_table[PROC_TABLE_SIZE];
 	boolean_t	was_crit;
 
-	was_crit = LOCK_CRIT_HELD(pctl->csa);
+	was_crit = LOCK_CRIT_HELD(pctl);
 	assert(was_crit);
 	assert(pctl->ctl->lock_gc_in_progress.u.parts.latch_pid == process_id);
 	memset(pid_table, 0, SIZEOF(pid_t) * PROC_TABLE_SIZE);
@@ -65,11 +65,11 @@ void mlk_shrclean(mlk_pvtctl_ptr_t pctl)
 		return;
 	fill_pid_table((mlk_shrblk_ptr_t)R2A(pctl->ctl->blkroot), pid_table, pctl);
 	REL_LOCK_CRIT(*pctl, was_crit);
-	check_pids(pid_table, dead_table, pctl->csa);
+	check_pids(pid_table, dead_table, pctl);
 	GRAB_LOCK_CRIT_AND_SYNC(*pctl, was_crit);
 	if (pctl->ctl->blkroot)
 		clean_pids((mlk_shrblk_ptr_t)R2A(pctl->ctl->blkroot), pid_table, dead_table, pctl);
-	assert(LOCK_CRIT_HELD(pctl->csa));
+	assert(LOCK_CRIT_HELD(pctl));
 	return;
 }
 
@@ -115,13 +115,13 @@ void fill_pid_table(mlk_shrblk_ptr_t d, pid_t *table, mlk_pvtctl_ptr_t pctl)
  *
  * @param [in] pid_table list of PID's to check, or 0 if no PID is at a given slot
  * @param [out] dead_table will contain 1 in dead_table[i] if the table[i] is dead
- * @param [in] csa used to verify we don't hold lock crit
+ * @param [in] pctl used to verify we don't hold lock crit
 */
-void check_pids(pid_t *pid_table, char *dead_table, sgmnt_addrs *csa)
+void check_pids(pid_t *pid_table, char *dead_table, mlk_pvtctl_ptr_t pctl)
 {
 	uint4 i, crash_count;
 
-	assert(!LOCK_CRIT_HELD(csa));
+	assert(!LOCK_CRIT_HELD(pctl));
 	for (i = 0; i < PROC_TABLE_SIZE; i++)
 	{
 		if (pid_table[i] != 0)
@@ -161,7 +161,8 @@ void clean_pids(mlk_shrblk_ptr_t d, pid_t *pid_table, char *dead_table, mlk_pvtc
 		{
 			assertpro(cur->lsib != INVALID_LSIB_MARKER);
 			cur->owner = 0;
-			cur->sequence = pctl->csa->hdr->trans_hist.lock_sequence++;
+			cur->sequence = MLK_NEXT_LOCK_SEQUENCE(pctl->csa);
+			mlk_wake_blocked(pctl, cur);
 			deleted = mlk_shrblk_delete_if_empty(pctl, cur);
 		} else
 			deleted = FALSE;
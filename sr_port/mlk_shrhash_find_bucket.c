@@ -3,7 +3,7 @@
  * Copyright (c) 2018-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -104,9 +104,11 @@ int mlk_shrhash_find_bucket(mlk_pvtctl_ptr_t pctl, mlk_subhash_val_t hash)
 				pctl->gc_needed = pctl->ctl->gc_needed = TRUE;
 			else if (1 == pctl->hash_fail_cnt)
 			{
-				if (pctl->ctl->num_blkhash > (pctl->ctl->max_blkcnt - pctl->ctl->blkcnt) * 2)
+				if ((pctl->ctl->num_blkhash > (pctl->ctl->max_blkcnt - pctl->ctl->blkcnt) * 2)
+					|| MLK_CTL_IS_STRIPED(pctl->ctl))
 				{	/* We have more than twice as many hash buckets as we have active shrblks,
-					 * indicating something pathological, so try rehashing.
+					 * indicating something pathological, so try rehashing. The hash table of a
+					 * stripe lives inside the stripe and cannot be resized, so rehash it instead.
 					 */
 					pctl->rehash_needed = pctl->ctl->rehash_needed = TRUE;
 				} else
@@ -3,7 +3,7 @@
  * Copyright (c) 2018-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -42,7 +42,8 @@ boolean_t mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl)
 	size_t			shrhash_mem_new;
 	mlk_pvtctl		pctl_new;
 
-	assert(LOCK_CRIT_HELD(pctl->csa));
+	assert(LOCK_CRIT_HELD(pctl));
+	assert(!MLK_CTL_IS_STRIPED(pctl->ctl));
 	shrhash_size_old = pctl->ctl->num_blkhash;
 	shrhash_mem_new = NEW_SHRHASH_MEM(shrhash_size_old);
 	shrhash_size_new = shrhash_mem_new / SIZEOF(mlk_shrhash);
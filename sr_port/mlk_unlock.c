@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -73,7 +73,8 @@ void mlk_unlock(mlk_pvtblk *p)
 		if (d->owner == process_id && p->sequence == d->sequence)
 		{
 			d->owner = 0;
-			d->sequence = csa->hdr->trans_hist.lock_sequence++;
+			d->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
+			mlk_wake_blocked(&p->pvtctl, d);
 			assert(!d->owner || d->owner == process_id);
 			/* do not call mlk_tree_wake_children/mlk_wake_pending on "d" if d->owner is non-zero.
 			 * for comments on why, see comments about d->owner in mlk_wake_pending.c
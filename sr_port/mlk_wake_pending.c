@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -22,6 +22,7 @@
 #include "gdsfhead.h"
 #include "filestruct.h"
 #include "mlkdef.h"
+#include "mlk_ops.h"
 #include "gdsbgtr.h"
 #ifdef UNIX
 #include <errno.h>
@@ -63,7 +64,8 @@ void mlk_wake_pending(mlk_pvtctl_ptr_t pctl, mlk_shrblk_ptr_t d)
 	 * to release the lock it will fail as its private copy of "p->sequence" will not match the shared memory "d->sequence".
 	*/
 	assert(!d->owner);
-	d->sequence = csa->hdr->trans_hist.lock_sequence++;	/* This node is being awakened (GTCM) */
+	d->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);	/* This node is being awakened (GTCM) */
+	mlk_wake_blocked(pctl, d);
 	BG_TRACE_PRO_ANY(csa, mlock_wakeups);			/* Record halted slumbers */
 	for (pr = (mlk_prcblk_ptr_t)R2A(d->pending), lcnt = pctl->ctl->max_prccnt; lcnt; lcnt--)
 	{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -196,8 +196,28 @@ typedef struct	mlk_ctldata_struct	/* this describes the entire shared lock secti
 	global_latch_t		lock_gc_in_progress;	/* pid of the process doing the GC, or 0 if none */
 	mlk_subhash_seed_t	hash_seed;		/* seed value to use to initialize hash */
 	int			hash_shmid;		/* shared memory id of hash table, or INVALID_SHMID if internal. */
+	uint4			num_stripes;		/* number of stripes the lock space is split into (1 if not striped) */
+	uint4			stripe_size;		/* size of each stripe in bytes (the whole lock space if not striped) */
+	global_latch_t		stripe_crit;		/* latch serializing operations on this stripe (if striped) */
+	int4			wake_waiters;		/* # of processes sleeping (futex) on a blocking shrblk's sequence */
+	boolean_t		wake_fifo;		/* TRUE if a release wakes only the longest waiting of those processes */
 } mlk_ctldata;
 
+/* The lock space can be split into "num_stripes" equal stripes (see $ydb_lock_stripes). Each stripe is laid out as a complete
+ * lock space of its own (mlk_ctldata followed by its hash table, shrblks, prcblks and shrsubs), so a stripe has its own free
+ * lists, hash table and garbage collection. Resource names are assigned to a stripe based on a hash of their top level name
+ * so all nodes of a resource tree live in the same stripe. Unless LOCK crit is shared with database crit, each stripe has
+ * its own latch (stripe_crit) so processes locking names in different stripes do not serialize on one latch.
+ * Stripe 0 is at the start of the lock space, where GT.CM expects the mlk_ctldata.
+ */
+#define MLK_MAX_STRIPES			64
+#define MLK_MIN_STRIPE_SIZE		(OS_PAGELET_SIZE * 64)	/* Do not split the lock space into stripes smaller than this */
+#define MLK_STRIPE_HASH_SEED		0
+#define MLK_CTL_IS_STRIPED(CTL)		(1 < (CTL)->num_stripes)
+#define MLK_CTL_STRIPE(CTL, IDX)	((mlk_ctldata_ptr_t)((sm_uc_ptr_t)(CTL) + (size_t)(IDX) * (CTL)->stripe_size))
+/* The stripe (of the lock space starting at CTL) which holds the shared structure at PTR */
+#define MLK_CTL_STRIPE_OF(CTL, PTR)	MLK_CTL_STRIPE(CTL, ((sm_uc_ptr_t)(PTR) - (sm_uc_ptr_t)(CTL)) / (CTL)->stripe_size)
+
 /* Define types for shared memory resident structures */
 
 #ifdef DB64
@@ -254,6 +274,12 @@ typedef mlk_pvtctl	*mlk_pvtctl_ptr_t;
 		mlk_pvtctl_set_ctl(&(PCTL), CTL)
 #define MLK_PVTCTL_INIT(PCTL, REG)											\
 		mlk_pvtctl_init(&(PCTL), REG)
+/* Same as MLK_PVTCTL_INIT but also points PCTL at the stripe holding the resource whose top level name is NAME */
+#define MLK_PVTCTL_INIT_NAME(PCTL, REG, NAME, LEN)									\
+		mlk_pvtctl_init_name(&(PCTL), REG, NAME, LEN)
+/* Points the pvtctl of PVTBLK at the stripe of its resource. Needs the pvtblk value (the first subscript is the name). */
+#define MLK_PVTCTL_INIT_PVTBLK(PVTBLK, REG)										\
+		mlk_pvtctl_init_name(&(PVTBLK)->pvtctl, REG, (PVTBLK)->value + 1, (PVTBLK)->value[0])
 
 typedef struct	mlk_pvtblk_struct	/* one of these entries exists for each nref which is locked or being processed */
 {
@@ -468,9 +494,22 @@ typedef struct mlk_stats_struct
 		grab_lock_crit_intl(&(PCTL), &(RET_WAS_CRIT))
 #define REL_LOCK_CRIT(PCTL, WAS_CRIT)								\
 		rel_lock_crit(&(PCTL), WAS_CRIT)
-#define LOCK_CRIT_OWNER(CSA)									\
-		((CSA)->lock_crit_with_db ? -1 : (CSA)->nl->lock_crit.u.parts.latch_pid)
-#define LOCK_CRIT_HELD(CSA)									\
-		((CSA)->lock_crit_with_db ? ((CSA)->now_crit) : (process_id == (CSA)->nl->lock_crit.u.parts.latch_pid))
+#define REL_HELD_LOCK_CRIT(REG)									\
+		rel_held_lock_crit(REG)
+#define LOCK_CRIT_LATCH(PCTL)									\
+		(MLK_CTL_IS_STRIPED((PCTL)->ctl) ? &(PCTL)->ctl->stripe_crit : &(PCTL)->csa->nl->lock_crit)
+#define LOCK_CRIT_OWNER(PCTL)									\
+		((PCTL)->csa->lock_crit_with_db ? -1 : LOCK_CRIT_LATCH(PCTL)->u.parts.latch_pid)
+#define LOCK_CRIT_HELD(PCTL)									\
+		((PCTL)->csa->lock_crit_with_db ? ((PCTL)->csa->now_crit)					\
+						: (process_id == LOCK_CRIT_LATCH(PCTL)->u.parts.latch_pid))
+
+/* Returns the current lock sequence number and bumps it. Processes holding the latches of different stripes can do this
+ * concurrently, hence the interlocked add.
+ */
+#define MLK_NEXT_LOCK_SEQUENCE(CSA)								\
+		((uint4)INTERLOCK_ADD(&(CSA)->hdr->trans_hist.lock_sequence, 1) - 1)
+#define MLK_BUMP_LOCK_SEQUENCE(CSA)								\
+		((void)INTERLOCK_ADD(&(CSA)->hdr->trans_hist.lock_sequence, 1))
 
 #endif
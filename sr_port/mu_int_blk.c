@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -40,6 +40,7 @@
 #include "anticipatory_freeze.h"
 #ifdef GTM_TRIGGER
 #include "gv_trigger.h"
+#include "db_readahead.h"
 #endif
 
 #define NEG_SUB	127
@@ -162,6 +163,7 @@ GBLREF boolean_t		nct_err_type;
 GBLREF boolean_t		debug_mupip;
 GBLREF int			rec_len;
 GBLREF jnlpool_addrs_ptr_t	jnlpool;
+GBLREF gd_region		*gv_cur_region;
 error_def(ERR_DBBADKYNM);
 error_def(ERR_DBBADNSUB);
 error_def(ERR_DBBADPNTR);
@@ -294,6 +296,7 @@ boolean_t mu_int_blk(
 	unsigned short	numsubs;
 	unsigned int	null_subscript_cnt;
 	boolean_t	coll_ret;
+	unix_db_info	*udi;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -320,6 +323,13 @@ boolean_t mu_int_blk(
 		blk_base = mu_int_read(blk, &ondsk_blkver, &free_blk_base);	/* ondsk_blkver set to GDSV4 or GDSV6 (GDSVCURR) */
 	if (!blk_base)
 		return FALSE;	/* Only occurs on malloc failure, so don't worry about mu_int_plen. */
+	if (!block_being_retried && (0 < level) && TREF(readahead_blks))
+	{	/* The children of this index block are integ'ed next; have the OS start reading them (see db_readahead.c) */
+		udi = FILE_INFO(gv_cur_region);
+		if (!udi->fd_opened_with_o_direct)
+			db_readahead_index(udi->fd, BLK_ZERO_OFF(mu_int_data.start_vbn), mu_int_data.blk_size,
+					mu_int_data.trans_hist.total_blks, blk_base);
+	}
 	blk_size = (int)((blk_hdr_ptr_t)blk_base)->bsiz;
 	if (!muint_fast)
 	{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,6 +34,7 @@
 #include "db_snapshot.h"
 #include "mupip_exit.h"
 #include "t_qread.h"
+#include "gds_blk_compress.h"
 
 GBLREF sgmnt_data		mu_int_data;
 GBLREF int4			mu_int_ovrhd;
@@ -174,6 +175,11 @@ uchar_ptr_t mu_int_read(block_id blk, enum db_ver *ondsk_blkver, uchar_ptr_t *fr
 			}
 		}
 	}
+	/* A block written compressed (MUPIP SET -COMPRESSION) that cannot be uncompressed is left as is for the INTEG checks to
+	 * report, like any other damaged block.
+	 */
+	if (IS_BLK_COMPRESSED(tmp_ptr))
+		gds_blk_uncompress(tmp_ptr, mu_int_data.blk_size, FALSE);
 	GDS_BLK_UPGRADE_IF_NEEDED(blk, tmp_ptr, tmp_ptr, &mu_int_data, ondsk_blkver, status, mu_int_data.fully_upgraded);
 	if (SS_NORMAL != status)
 		if (ERR_DYNUPGRDFAIL == status)
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020 YottaDB LLC and/or its subsidiaries.      *
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.      *
  * All rights reserved.                                         *
  *								*
  *	This source code contains the intellectual property	*
@@ -110,6 +110,7 @@ typedef struct coll_hdr_struct
 #define BIN_LABEL_STR_MAX_SIZE 		128
 #define ZWR_GO_LABEL_MAX_SIZE		1024
 #define EXTR_DEFAULT_LABEL		"YottaDB MUPIP EXTRACT"
+#define EXTR_MANIFEST_LABEL		"YottaDB MUPIP EXTRACT MANIFEST"	/* 1st line of an EXTRACT -PARALLEL manifest */
 
 #define V4_BIN_HEADER_VERSION		"4"
 #define V4_BIN_HEADER_LABEL		"GDS BINARY EXTRACT LEVEL "V4_BIN_HEADER_VERSION
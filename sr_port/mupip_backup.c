@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -86,6 +86,7 @@
 #include "repl_sem.h"
 #include "gtm_sem.h"
 #include "anticipatory_freeze.h"
+#include "gds_cbt.h"
 
 #define PATH_DELIM		'/'
 /* Note: Use %08x for process_id in the format string below to ensure we have 8 hex digits always irrespective of the
@@ -1228,6 +1229,8 @@ repl_inst_bkup_done2:
 			}
 			assert((0 == jnl_seqno) || !REPL_ENABLED(cs_data) || (cs_data->reg_seqno <= jnl_seqno));
 			memcpy(rptr->backup_hdr, cs_data, SIZEOF_FILE_HDR(cs_data));
+			/* The copy has the changed block maps this backup reads (see mubinccpy), so restart one for the next */
+			gds_cbt_start(cs_data, cs_addrs->ti->curr_tn);
 			if (online) /* save a copy of the fileheader, modify current fileheader and release crit */
 			{
 				if (0 != cs_addrs->hdr->abandoned_kills)
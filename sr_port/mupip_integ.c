@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -55,6 +55,11 @@
 #include "muextr.h"
 #include "mu_getkey.h"
 #include "gvt_inline.h"
+#include "gtm_multi_proc.h"
+#include "gtm_stdlib.h"
+#include "gtm_unistd.h"
+#include "gtmio.h"
+#include "eintr_wrappers.h"
 
 #define MAX_UTIL_LEN			96
 #define APPROX_ALL_ERRORS		1000000
@@ -62,6 +67,7 @@
 #define PERCENT_FACTOR			100
 #define PERCENT_DECIMAL_SCALE		100000
 #define PERCENT_SCALE_FACTOR		1000
+#define MU_INT_MP_COPY_SIZE		32768
 
 #define TEXT1 " is incorrect, should be "
 #define TEXT2 "!/Largest transaction number found in database was "
@@ -149,35 +155,48 @@ GBLREF gv_namehead		*gv_target;
 GBLREF sgmnt_addrs		*cs_addrs;
 GBLREF short			crash_count;
 GBLREF tp_region		*grlist;
+GBLREF boolean_t		skip_exit_handler;
+
+/* One entry per region checked by "mu_int_multi_proc" */
+typedef struct
+{
+	tp_region	*rptr;
+	int		index;		/* position of the region in the region list (and in "mu_int_mp_results") */
+	int		fd;		/* unlinked temporary file the output of the check of the region goes to */
+} mu_int_mp_task;
+
+/* Outcome of the check of one region by "mu_int_multi_proc" */
+typedef struct
+{
+	uint4		errors;
+	uint4		skipreg_cnt;
+	boolean_t	error_mupip;
+	boolean_t	ctrlc_occurred;
+	boolean_t	done;
+} mu_int_mp_result;
+
+STATICDEF boolean_t		full, muint_all_index_blocks, online_integ, stats_specified;
+STATICDEF block_id		muint_block;
+STATICDEF mu_int_mp_result	*mu_int_mp_shm_results;	/* one entry per region in "gtm_multi_proc" shared memory */
+STATICDEF mu_int_mp_result	*mu_int_mp_results;	/* private copy of the above made once all regions are done */
+
+STATICFNDCL int mu_int_reglist(tp_region *rptr);
+STATICFNDCL int mu_int_parallel(tp_region *rptr, int max_procs);
+STATICFNDCL uint4 mu_int_multi_proc_init(mu_int_mp_task *task);
+STATICFNDCL uint4 mu_int_multi_proc(mu_int_mp_task *task);
+STATICFNDCL uint4 mu_int_multi_proc_finish(mu_int_mp_task *task);
 
 void mupip_integ(void)
 {
-	boolean_t		full, muint_all_index_blocks, retvalue_mu_int_reg, region_was_frozen;
-	boolean_t		update_filehdr, update_header_tn;
-	boolean_t		online_integ = FALSE, stats_specified;
-	char			*temp, util_buff[MAX_UTIL_LEN];
-	unsigned char		dummy;
 	unsigned char		key_buff[2048];
-	short			iosb[4];
 	unsigned short		keylen;
-	int			idx, total_errors, util_len;
-	uint4			cli_status, leftpt, mu_data_adj, mu_index_adj, prev_errknt, rightpt;
-	block_id		dir_root, muint_block;
-	enum cum_type		c_type;
-	enum tot_type		t_type;
-	file_control		*fc;
-	gtm_uint64_t		blocks_free = MAXUINT8;
-	gtm_uint64_t		mu_int_tot[TOT_TYPE_MAX][CUM_TYPE_MAX], tot_blks, tot_recs;
-	tp_region		*rptr;
-	sgmnt_addrs		*csa;
-	sgmnt_data_ptr_t	csd;
+	boolean_t		parallel;
+	int			max_procs, total_errors;
+	uint4			cli_status;
+	tp_region		*rptr = NULL;
 	span_node_integ		span_node_data;
 	char			ss_filename[YDB_PATH_MAX];
 	unsigned short		ss_file_len = YDB_PATH_MAX;
-	unix_db_info		*udi;
-	gd_region		*baseDBreg, *reg;
-	sgmnt_addrs		*baseDBcsa;
-	node_local_ptr_t	baseDBnl;
 	sgmnt_addrs		*tcsa;
 	char 			*db_file_name;
 	DCL_THREADGBL_ACCESS;
@@ -333,6 +352,71 @@ void mupip_integ(void)
 		} else /* Establish the condition handler ONLY if ONLINE INTEG was not requested */
 			ESTABLISH(mu_freeze_ch);
 	}
+	if (region && (CLI_PRESENT == cli_present("PARALLEL")))
+	{
+		if (!cli_get_int("PARALLEL", &max_procs))
+			max_procs = 0;	/* Treat -PARALLEL without any value as one process per region */
+	} else
+		max_procs = 1;
+	parallel = ((1 != max_procs) && (NULL != rptr->fPtr));
+	if (parallel)
+		total_errors = mu_int_parallel(rptr, max_procs);
+	else
+		total_errors = mu_int_reglist(rptr);
+	if (!region)
+	{
+		db_ipcs_reset(gv_cur_region);
+		mu_gv_cur_reg_free(); /* mu_gv_cur_reg_init done in mu_int_init() */
+		REVERT;
+	}
+	if (error_mupip)
+		total_errors++;
+	if (mu_ctrly_occurred || mu_ctrlc_occurred)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) mu_ctrly_occurred ? ERR_CTRLY : ERR_CTRLC);
+		mupip_exit(ERR_MUNOFINISH);
+	}
+	if (0 != total_errors)
+		mupip_exit(ERR_INTEGERRS);
+	if (0 != mu_int_skipreg_cnt)
+		mupip_exit(ERR_MUNOTALLINTEG);
+	if (!mu_region_found)
+		mupip_exit(ERR_MUNOACTION);
+	tcsa = !parallel ? REG2CSA(gv_cur_region) : NULL;	/* with -PARALLEL, no region is open here */
+	if ((NULL != tcsa) && (NULL != tcsa->ti) && (0 != tcsa->ti->total_blks) && (NULL != tcsa->hdr)
+		&& (0 != MAXTOTALBLKS(tcsa->hdr)))
+	{
+		db_file_name = (char *)gv_cur_region->dyn.addr->fname;
+		warn_db_sz(db_file_name, 0, tcsa->ti->total_blks, MAXTOTALBLKS(tcsa->hdr));
+	}
+	mupip_exit(SS_NORMAL);
+}
+
+/* Checks the regions in the list starting at "rptr" (or the file named by the WHAT parameter if "region" is FALSE) one
+ * after the other and reports the results of each. Returns the total number of errors found.
+ */
+STATICFNDEF int mu_int_reglist(tp_region *rptr)
+{
+	boolean_t		retvalue_mu_int_reg, region_was_frozen;
+	boolean_t		update_filehdr, update_header_tn;
+	char			*temp, util_buff[MAX_UTIL_LEN];
+	unsigned char		dummy;
+	int			idx, total_errors, util_len;
+	uint4			leftpt, mu_data_adj, mu_index_adj, prev_errknt, rightpt;
+	block_id		dir_root;
+	enum cum_type		c_type;
+	file_control		*fc;
+	gtm_uint64_t		blocks_free = MAXUINT8;
+	gtm_uint64_t		mu_int_tot[TOT_TYPE_MAX][CUM_TYPE_MAX], tot_blks, tot_recs;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	unix_db_info		*udi;
+	gd_region		*baseDBreg, *reg;
+	sgmnt_addrs		*baseDBcsa;
+	node_local_ptr_t	baseDBnl;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
 	for (total_errors = mu_int_errknt = 0;  ;  total_errors += mu_int_errknt, mu_int_errknt = 0)
 	{
 		if (mu_ctrly_occurred || mu_ctrlc_occurred)
@@ -883,32 +967,145 @@ void mupip_integ(void)
 		} else
 			break;
 	}
-	if (!region)
+	total_errors += mu_int_errknt;
+	mu_int_errknt = 0;
+	return total_errors;
+}
+
+/* Checks the regions in the list starting at "rptr" in parallel, using at most "max_procs" processes (0 implies one process
+ * per region). The output of the check of each region is captured in a temporary file and copied to stderr in region order
+ * once all regions are done so the report is the same as that of a serial INTEG. Returns the total number of errors found.
+ */
+STATICFNDEF int mu_int_parallel(tp_region *rptr, int max_procs)
+{
+	char			tmpfilename[YDB_PATH_MAX], buff[MU_INT_MP_COPY_SIZE];
+	int			idx, ntasks, nread, rc, save_errno, total_errors;
+	mu_int_mp_task		*tasks, *task;
+	mu_int_mp_result	*res;
+	tp_region		*rlist;
+	void			**ret_array;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	for (ntasks = 0, rlist = rptr; NULL != rlist; rlist = rlist->fPtr)
+		ntasks++;
+	if (!max_procs || (max_procs > ntasks))
+		max_procs = ntasks;
+	max_procs = MIN(max_procs, MULTI_PROC_MAX_PROCS - 1);
+	tasks = (mu_int_mp_task *)malloc(SIZEOF(mu_int_mp_task) * ntasks);
+	for (idx = 0, rlist = rptr; idx < ntasks; idx++, rlist = rlist->fPtr)
 	{
-		db_ipcs_reset(gv_cur_region);
-		mu_gv_cur_reg_free(); /* mu_gv_cur_reg_init done in mu_int_init() */
-		REVERT;
+		task = &tasks[idx];
+		task->rptr = rlist;
+		task->index = idx;
+		SNPRINTF(tmpfilename, SIZEOF(tmpfilename), "%.*s/mupintXXXXXX", (TREF(gtm_tmpdir)).len, (TREF(gtm_tmpdir)).addr);
+		MKSTEMP(tmpfilename, task->fd);
+		if (FD_INVALID == task->fd)
+		{
+			save_errno = errno;
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(8) ERR_SYSCALL, 5, LEN_AND_LIT("mkstemp()"), CALLFROM, save_errno);
+			mupip_exit(ERR_MUNOACTION);
+		}
+		UNLINK(tmpfilename);	/* the file lives on until "task->fd" is closed */
 	}
-	total_errors += mu_int_errknt;
-	if (error_mupip)
-		total_errors++;
-	if (mu_ctrly_occurred || mu_ctrlc_occurred)
+	ret_array = (void **)malloc(SIZEOF(void *) * ntasks);
+	mu_int_mp_results = (mu_int_mp_result *)malloc(SIZEOF(mu_int_mp_result) * ntasks);
+	memset(mu_int_mp_results, 0, SIZEOF(mu_int_mp_result) * ntasks);
+	/* Any error in setting up the processes has been reported by "gtm_multi_proc". Regions that did not get checked as
+	 * a result show up as not "done" below.
+	 */
+	(void)gtm_multi_proc((gtm_multi_proc_fnptr_t)&mu_int_multi_proc, ntasks, max_procs, ret_array, (void *)tasks,
+			SIZEOF(mu_int_mp_task), SIZEOF(mu_int_mp_result) * ntasks,
+			(gtm_multi_proc_fnptr_t)&mu_int_multi_proc_init, (gtm_multi_proc_fnptr_t)&mu_int_multi_proc_finish);
+	FFLUSH(stderr);
+	for (total_errors = 0, idx = 0; idx < ntasks; idx++)
 	{
-		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) mu_ctrly_occurred ? ERR_CTRLY : ERR_CTRLC);
-		mupip_exit(ERR_MUNOFINISH);
+		task = &tasks[idx];
+		res = &mu_int_mp_results[idx];
+		if (0 == lseek(task->fd, 0, SEEK_SET))
+		{
+			do
+			{
+				DOREADRL(task->fd, buff, SIZEOF(buff), nread);
+				if (0 < nread)
+					DOWRITERC(2, buff, nread, rc);
+			} while (SIZEOF(buff) == nread);
+		}
+		CLOSEFILE_RESET(task->fd, rc);	/* resets "task->fd" to FD_INVALID */
+		total_errors += res->errors;
+		mu_int_skipreg_cnt += res->skipreg_cnt;
+		if (res->error_mupip || !res->done)
+			error_mupip = TRUE;
+		if (res->ctrlc_occurred)
+			mu_ctrlc_occurred = TRUE;
 	}
-	if (0 != total_errors)
-		mupip_exit(ERR_INTEGERRS);
-	if (0 != mu_int_skipreg_cnt)
-		mupip_exit(ERR_MUNOTALLINTEG);
-	if (!mu_region_found)
-		mupip_exit(ERR_MUNOACTION);
-	tcsa = REG2CSA(gv_cur_region);
-	if ((NULL != tcsa) && (NULL != tcsa->ti) && (0 != tcsa->ti->total_blks) && (NULL != tcsa->hdr)
-		&& (0 != MAXTOTALBLKS(tcsa->hdr)))
+	free(mu_int_mp_results);
+	mu_int_mp_results = NULL;
+	free(ret_array);
+	free(tasks);
+	return total_errors;
+}
+
+/* This initialization function is called by gtm_multi_proc after shared memory creation */
+STATICFNDEF uint4 mu_int_multi_proc_init(mu_int_mp_task *task)
+{
+	multi_proc_shm_hdr_t	*mp_hdr;	/* Pointer to "multi_proc_shm_hdr_t" structure in shared memory */
+
+	assert(multi_proc_in_use);
+	mp_hdr = multi_proc_shm_hdr;
+	mu_int_mp_shm_results = (mu_int_mp_result *)((sm_uc_ptr_t)mp_hdr->shm_ret_array + (SIZEOF(void *) * mp_hdr->ntasks));
+	return SS_NORMAL;
+}
+
+/* Checks one region in a process forked off by gtm_multi_proc. Always returns SS_NORMAL so errors in one region do not stop
+ * the check of the other regions. The outcome is passed back to the parent in "mu_int_mp_shm_results".
+ */
+STATICFNDEF uint4 mu_int_multi_proc(mu_int_mp_task *task)
+{
+	mu_int_mp_result	*res;
+	tp_region		rlist;
+	int			rc, save_stderr;
+
+	assert(multi_proc_in_use);
+	res = &mu_int_mp_shm_results[task->index];
+	/* Unlike the usual gtm_multi_proc task, this process opens the database itself (the parent has no region open)
+	 * so let the exit handler run it down.
+	 */
+	skip_exit_handler = FALSE;
+	/* The output of this region goes to its own file so it does not interleave with that of the other regions. Since
+	 * no output device is shared, the output need not be serialized with the multi-process latch either.
+	 */
+	FFLUSH(stderr);
+	save_stderr = dup(2);
+	DUP2(task->fd, 2, rc);
+	multi_proc_in_use = FALSE;
+	rlist = *task->rptr;
+	rlist.fPtr = NULL;
+	error_mupip = FALSE;
+	mu_int_skipreg_cnt = 0;
+	res->errors = mu_int_reglist(&rlist);
+	res->skipreg_cnt = mu_int_skipreg_cnt;
+	res->error_mupip = error_mupip;
+	res->ctrlc_occurred = (mu_ctrly_occurred || mu_ctrlc_occurred);
+	res->done = TRUE;
+	FFLUSH(stderr);
+	multi_proc_in_use = TRUE;
+	if (FD_INVALID != save_stderr)
 	{
-		db_file_name = (char *)gv_cur_region->dyn.addr->fname;
-		warn_db_sz(db_file_name, 0, tcsa->ti->total_blks, MAXTOTALBLKS(tcsa->hdr));
+		DUP2(save_stderr, 2, rc);
+		CLOSEFILE(save_stderr, rc);
 	}
-	mupip_exit(SS_NORMAL);
+	return SS_NORMAL;
+}
+
+/* This function is called by gtm_multi_proc once all the forked off processes are done */
+STATICFNDEF uint4 mu_int_multi_proc_finish(mu_int_mp_task *task)
+{
+	multi_proc_shm_hdr_t	*mp_hdr;	/* Pointer to "multi_proc_shm_hdr_t" structure in shared memory */
+
+	assert(multi_proc_in_use);
+	mp_hdr = multi_proc_shm_hdr;
+	/* The shared memory goes away on return so keep a private copy of the results */
+	memcpy(mu_int_mp_results, mu_int_mp_shm_results, SIZEOF(mu_int_mp_result) * mp_hdr->ntasks);
+	return SS_NORMAL;
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -84,6 +84,10 @@ void mupip_set(void)
 	if ((CLI_PRESENT == cli_present("ACCESS_METHOD"))
 		|| (CLI_PRESENT == cli_present("ASYNCIO"))
 		|| (CLI_NEGATED == cli_present("ASYNCIO"))
+		|| (CLI_NEGATED == cli_present("COMPRESSION"))
+		|| (CLI_PRESENT == cli_present("COMPRESSION"))
+		|| (CLI_NEGATED == cli_present("CRIT_QUEUE"))
+		|| (CLI_PRESENT == cli_present("CRIT_QUEUE"))
 		|| (CLI_NEGATED == cli_present("DEFER_ALLOCATE"))
 		|| (CLI_PRESENT == cli_present("DEFER_ALLOCATE"))
 		|| (CLI_PRESENT == cli_present("DEFER_TIME"))
@@ -98,6 +102,8 @@ void mupip_set(void)
 		|| (CLI_PRESENT == cli_present("HARD_SPIN_COUNT"))
 		|| (CLI_NEGATED == cli_present("INST_FREEZE_ON_ERROR"))
 		|| (CLI_PRESENT == cli_present("INST_FREEZE_ON_ERROR"))
+		|| (CLI_NEGATED == cli_present("IO_URING"))
+		|| (CLI_PRESENT == cli_present("IO_URING"))
 		|| (CLI_PRESENT == cli_present("KEY_SIZE"))
 		|| (CLI_PRESENT == cli_present("LCK_SHARES_DB_CRIT"))
 		|| (CLI_NEGATED == cli_present("LCK_SHARES_DB_CRIT"))
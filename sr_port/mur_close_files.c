@@ -3,7 +3,7 @@
  * Copyright (c) 2003-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -65,6 +65,7 @@
 #endif
 #include "interlock.h"
 #include "do_semop.h"
+#include "gds_cbt.h"
 
 #define WARN_STATUS(jctl)											\
 if (SS_NORMAL != jctl->status)											\
@@ -413,6 +414,10 @@ boolean_t mur_close_files(void)
 							csd->last_rec_backup = 1;
 							csd->last_rec_bkup_last_blk = 1;
 						}
+						/* Before images applied by backward recovery updated blocks without marking them in
+						 * the changed block maps, so stop using those (see gds_cbt.h).
+						 */
+						CBT_INVALIDATE(csd);
 					} else
 					{	/* Restore states. Otherwise, reissuing the command might fail.
 						 * However, before using rctl make sure it was properly initialized.
@@ -3,6 +3,9 @@
  * Copyright (c) 2003-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -41,23 +44,32 @@
 
 #else /* !MUR_USE_AIO && !VMS */
 
+/* Without AIO, starting a read only asks the OS to bring the chunk into the file system cache; the read itself is done when
+ * the buffer is waited for, by which time the caller has usually processed the other buffer and the data is in memory.
+ * The channel is saved as the read may be waited for after "jctl->channel" has changed (see "rip_channel" in muprec.h).
+ * A failed hint only loses the overlap.
+ */
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_START) is thread-safe */
 #define MUR_FREAD_START(JCTL, BUFF_DESC, RET_STATUS)					\
 {											\
 	assert(JCTL->eof_addr > (BUFF_DESC)->dskaddr);					\
+	assert(!(BUFF_DESC)->read_in_progress);						\
 	(BUFF_DESC)->blen = MIN(MUR_BUFF_SIZE, JCTL->eof_addr - (BUFF_DESC)->dskaddr);	\
-	DO_FILE_READ(JCTL->channel, (BUFF_DESC)->dskaddr, (BUFF_DESC)->base, 		\
-			(BUFF_DESC)->blen, JCTL->status, JCTL->status2);		\
+	(BUFF_DESC)->rip_channel = JCTL->channel;					\
+	posix_fadvise((BUFF_DESC)->rip_channel, (off_t)(BUFF_DESC)->dskaddr, (off_t)(BUFF_DESC)->blen,	\
+			POSIX_FADV_WILLNEED);						\
 	(BUFF_DESC)->read_in_progress = TRUE;						\
-	RET_STATUS = JCTL->status;							\
+	RET_STATUS = SS_NORMAL;								\
 }
 
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_WAIT) is thread-safe */
-#define MUR_FREAD_WAIT(JCTL, BUFF_DESC, RET_STATUS)				\
-{										\
-	assert((BUFF_DESC)->read_in_progress);					\
-	(BUFF_DESC)->read_in_progress = FALSE;					\
-	RET_STATUS = SS_NORMAL;							\
+#define MUR_FREAD_WAIT(JCTL, BUFF_DESC, RET_STATUS)					\
+{											\
+	assert((BUFF_DESC)->read_in_progress);						\
+	(BUFF_DESC)->read_in_progress = FALSE;						\
+	DO_FILE_READ((BUFF_DESC)->rip_channel, (BUFF_DESC)->dskaddr, (BUFF_DESC)->base,	\
+			(BUFF_DESC)->blen, JCTL->status, JCTL->status2);		\
+	RET_STATUS = JCTL->status;							\
 }
 
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_CANCEL) is thread-safe */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -67,6 +67,7 @@
 #include "gvt_inline.h"
 
 GBLREF spdesc			stringpool;
+GBLREF stp_gcol_stats_t		stp_gcol_stats;
 GBLREF int4			cache_hits, cache_fails;
 GBLREF uint4			max_cache_entries;
 GBLREF unsigned char		*stackbase, *stacktop;
@@ -126,6 +127,7 @@ LITREF	mval		literal_null;
 #define		NO_REPLINST		"No replication instance defined"
 #define		STATS_MAX_DIGITS	MAX_DIGITS_IN_INT8
 #define		STATS_KEYWD_SIZE	(3 + 1 + 1)	/* 3 character mnemonic, colon and comma */
+#define		HIST_KEYWD_SIZE		(4 + 1 + 1)	/* 4 character mnemonic, colon and comma */
 
 #define STATS_PUT_PARM(TXT, CNTR, BASE)					\
 {									\
@@ -137,6 +139,22 @@ LITREF	mval		literal_null;
 	assert(stringpool.free <= stringpool.top);			\
 }
 
+#define HIST_PUT_PARM(TXT, HIST, BASE)						\
+{										\
+	int	lcl_bucket;							\
+										\
+	MEMCPY_LIT(stringpool.free, TXT);					\
+	stringpool.free += STR_LIT_LEN(TXT);					\
+	*stringpool.free++ = ':';						\
+	for (lcl_bucket = 0; lcl_bucket < GVSTATS_HIST_BUCKETS; lcl_bucket++)	\
+	{									\
+		stringpool.free = i2ascl(stringpool.free, BASE.HIST[lcl_bucket]);	\
+		*stringpool.free++ = ';';					\
+	}									\
+	*(stringpool.free - 1) = ',';	/* replace trailing bucket separator */	\
+	assert(stringpool.free <= stringpool.top);				\
+}
+
 void	op_fnview(int numarg, mval *dst, ...)
 {	boolean_t	save_transform;
 	char		instfilename[MAX_FN_LEN + 1 + 1];	/* 1 for possible flag character */
@@ -215,6 +233,22 @@ void	op_fnview(int numarg, mval *dst, ...)
 		case VTK_ICMISS:
 			n = cache_fails;
 			break;
+		case VTK_SPGCSTATS:
+			/* Minor (nursery only) and major (full) stringpool collection counts, bytes of live strings they
+			 * compacted and the time (in nanoseconds) they took, followed by the longest single collection.
+			 */
+			ENSURE_STP_FREE_SPACE(7 * (STATS_MAX_DIGITS + STATS_KEYWD_SIZE));
+			dst->str.addr = (char *)stringpool.free;
+			STATS_PUT_PARM("MNC", minor_gcols, stp_gcol_stats);
+			STATS_PUT_PARM("MJC", major_gcols, stp_gcol_stats);
+			STATS_PUT_PARM("MNB", minor_bytes, stp_gcol_stats);
+			STATS_PUT_PARM("MJB", major_bytes, stp_gcol_stats);
+			STATS_PUT_PARM("MNT", minor_nsec, stp_gcol_stats);
+			STATS_PUT_PARM("MJT", major_nsec, stp_gcol_stats);
+			STATS_PUT_PARM("MXT", max_nsec, stp_gcol_stats);
+			stringpool.free--;	/* subtract one to remove extra trailing comma delimiter */
+			dst->str.len = INTCAST((char *)stringpool.free - dst->str.addr);
+			break;
 		case VTK_SPSIZE:
 			commastr.len = 1;
 			commastr.addr = ",";
@@ -674,6 +708,28 @@ void	op_fnview(int numarg, mval *dst, ...)
 			} else
 				dst->str.len = 0;
 			break;
+		case VTK_GVHIST:
+			assert(gd_header);
+			if (!parmblk.gv_ptr->open)
+				gv_init_reg(parmblk.gv_ptr);
+			csa = &FILE_INFO(parmblk.gv_ptr)->s_addrs;
+			if (NULL != csa->hdr)
+			{
+				ENSURE_STP_FREE_SPACE(n_gvstats_hist_types
+							* (GVSTATS_HIST_BUCKETS * (STATS_MAX_DIGITS + 1) + HIST_KEYWD_SIZE) + 1);
+				dst->str.addr = (char *)stringpool.free;
+#				define TAB_GVSTATS_HIST(HIST,TEXT1,TEXT2)	HIST_PUT_PARM(TEXT1, HIST, csa->nl->gvstats_hist)
+#				include "tab_gvstats_hist.h"
+#				undef TAB_GVSTATS_HIST
+				assert(stringpool.free < stringpool.top);
+				if ((RDBF_NOSTATS & csa->reservedDBFlags) && !(RDBF_NOSTATS & csa->hdr->reservedDBFlags))
+					*(stringpool.free - 1) = '?';	/* mark as questionable */
+				else
+					stringpool.free--;		/* subtract one to remove extra trailing delimiter */
+				dst->str.len = INTCAST((char *)stringpool.free - dst->str.addr);
+			} else
+				dst->str.len = 0;
+			break;
 		case VTK_TID:
 			newlevel = MV_FORCE_INT(parmblk.value);
 			if (!tp_pointer || newlevel <= 0)
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2011 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -110,9 +110,10 @@ lv_val	*op_getindx(UNIX_ONLY_COMMA(int argcnt) lv_val *start, ...)
 	{	/* If coming in through "ydb_get_s" (SimpleAPI/SimpleThreadAPI), do not issue LVUNDEF here since
 		 * the variable name is most likely not added to the lv hash table which means the LVUNDEF error
 		 * would show a lvn with subscripts but without a local variable name. Let caller "ydb_get_s" figure
-		 * out how to correctly issue the LVUNDEF error. Hence the check for LYDB_RTN_GET below.
+		 * out how to correctly issue the LVUNDEF error. Hence the check for LYDB_RTN_GET (and LYDB_RTN_GET_MANY) below.
 		 */
-		if (undef_inhibit || (LYDB_RTN_GET == TREF(libyottadb_active_rtn)))
+		if (undef_inhibit || (LYDB_RTN_GET == TREF(libyottadb_active_rtn))
+				|| (LYDB_RTN_GET_MANY == TREF(libyottadb_active_rtn)))
 			lv = (lvTreeNode *)&literal_null;
 		else
 		{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -50,6 +50,7 @@
 #include "gdsfhead.h"
 #include "gdscc.h"
 #include "filestruct.h"
+#include "mlk_ops.h"
 #include "buddy_list.h"		/* needed for tp.h */
 #include "io.h"
 #include "jnl.h"
@@ -173,7 +174,7 @@ int	op_lock2_common(uint8 timeout, unsigned char laflag) /* timeout is in nanose
 	unsigned char		action;
 	ABS_TIME		cur_time, end_time, remain_time;
 	mv_stent		*mv_zintcmd;
-	uint4			sleep_msec;
+	uint4			sleep_msec, wait_msec;
 	mlk_pvtctl_ptr_t	pctl;
 	DCL_THREADGBL_ACCESS;
 
@@ -331,6 +332,13 @@ int	op_lock2_common(uint8 timeout, unsigned char laflag) /* timeout is in nanose
 				if (outofband || !mlk_check_own(pvt_ptr1))
 				{	/* If CTL-C, check lock owner */
 					UPDATE_PROC_WAIT_STATE(pvt_ptr1->pvtctl.csa, WS_39, -1);
+					/* With $ydb_lock_fifo a release wakes only one waiter. If that was us, we will not take the
+					 * lock, so pass the wakeup on to the next waiter rather than leave it asleep. If it was not
+					 * us, the extra wakeup only makes a waiter recheck the lock.
+					 */
+					if (pvt_ptr1->pvtctl.ctl->wake_fifo && (NULL != pvt_ptr1->blocked)
+							&& (pvt_ptr1->blk_sequence != pvt_ptr1->blocked->sequence))
+						mlk_wake_blocked(&pvt_ptr1->pvtctl, pvt_ptr1->blocked);
 					if (pvt_ptr1->nodptr)		/* Get off pending list to be sent a wake */
 						mlk_unpend(pvt_ptr1);
 					/* Cancel all remote locks obtained so far */
@@ -380,10 +388,29 @@ int	op_lock2_common(uint8 timeout, unsigned char laflag) /* timeout is in nanose
 			 * same lock resource, "mlk_shrblk_find" assumes a sleep has happened in between two locking attempts.
 			 */
 			UPDATE_PROC_WAIT_STATE(pvt_ptr1->pvtctl.csa, WS_39, 1);
-			hiber_start_wait_any(sleep_msec);
-			sleep_msec = sleep_msec * 2;
-			if (LOCK_SELF_WAKE_MAX <= sleep_msec)
-				sleep_msec = LOCK_SELF_WAKE_START;
+			/* If we know which node blocks us, sleep until its holder releases it (see "mlk_wait_blocked"). The wait
+			 * is capped at LOCK_SELF_WAKE_MAX msec (and the time left for a timed LOCK) so a blocking process that
+			 * was kill -9ed is still noticed below. Otherwise (no futex support, no room in the lock space or the
+			 * blocking node changed before we got to sleep) fall back to the self-wake sleeps.
+			 */
+			wait_msec = LOCK_SELF_WAKE_MAX;
+			if (NO_M_TIMEOUT != timeout)
+			{
+				sys_get_curr_time(&cur_time);
+				remain_time = sub_abs_time(&end_time, &cur_time);
+				if ((0 > remain_time.tv_sec) || (0 > remain_time.tv_nsec))
+					wait_msec = 0;	/* out of time; "mlk_wait_blocked" returns right away */
+				else if (LOCK_SELF_WAKE_MAX > remain_time.tv_sec * MILLISECS_IN_SEC)
+					wait_msec = (uint4)MIN(wait_msec, (remain_time.tv_sec * MILLISECS_IN_SEC)
+							+ DIVIDE_ROUND_UP(remain_time.tv_nsec, NANOSECS_IN_MSEC));
+			}
+			if ((NULL == pvt_ptr1->blocked) || !mlk_wait_blocked(pvt_ptr1, wait_msec))
+			{
+				hiber_start_wait_any(sleep_msec);
+				sleep_msec = sleep_msec * 2;
+				if (LOCK_SELF_WAKE_MAX <= sleep_msec)
+					sleep_msec = LOCK_SELF_WAKE_START;
+			}
 			/* Every reattempt at a blocking lock needs crit which could be a bottleneck. So minimize reattempts.
 			 * The "blk_sequence" check below serves that purpose. If the sequence number is different between
 			 * the shared and private copies, it means the lock state in shared memory has changed since last we
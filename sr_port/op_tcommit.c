@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -212,6 +212,7 @@ enum cdb_sc	op_tcommit(void)
 	jnlpool_addrs_ptr_t	save_jnlpool;
 	boolean_t		before_image_needed;
 	boolean_t		skip_invoke_restart;
+	gtm_uint64_t		tend_start, tend_nsec;
 #	ifdef DEBUG
 	enum cdb_sc		prev_status;
 #	endif
@@ -494,6 +495,9 @@ enum cdb_sc	op_tcommit(void)
 				SET_WC_BLOCKED_FINAL_RETRY_IF_NEEDED(csa, cnl, status);
 				TP_RETRY_ACCOUNTING(csa, cnl);
 			}
+			/* Time "tp_tend" only if a region of the transaction keeps stats */
+			for (tend_start = 0, si = first_sgm_info; (NULL != si) && !tend_start; si = si->next_sgm_info)
+				tend_start = GVSTATS_HIST_START(si->tp_csa);
 			if ((cdb_sc_normal != status) || !tp_tend())
 			{	/* Commit failed BEFORE invoking or DURING "tp_tend" */
 				DEBUG_ONLY(prev_status = status;)
@@ -516,6 +520,7 @@ enum cdb_sc	op_tcommit(void)
 				return status;	/* return status to caller who cares about it */
 			} else
 			{	/* Now that tp_tend() is done and we do not hold crit, check if we had an unhandled IO timer pop. */
+				tend_nsec = tend_start ? (gvstats_hist_now() - tend_start) : 0;
 				if (unhandled_stale_timer_pop)
 					process_deferred_stale();
 				for (si = first_sgm_info; NULL != si; si = si->next_sgm_info)
@@ -530,6 +535,8 @@ enum cdb_sc	op_tcommit(void)
 					}
 					INCR_GVSTATS_COUNTER(csa, cnl, n_tp_readwrite, 1);
 					INCR_GVSTATS_COUNTER(csa, cnl, n_tp_blkwrite, si->cw_set_depth);
+					if (tend_start)
+						GVSTATS_HIST_ADD_NSEC(csa, cnl, h_tp_commit, tend_nsec);
 					GVSTATS_SET_CSA_STATISTIC(csa, db_curr_tn, si->start_tn);
 					TP_TEND_CHANGE_REG(si);
 					wcs_timer_start(gv_cur_region, TRUE);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -400,6 +400,7 @@ void	op_view(int numarg, mval *keyword, ...)
 						case dba_bg:
 							csa = &FILE_INFO(reg)->s_addrs;
 							memset((char *)csa->gvstats_rec_p, 0, SIZEOF(gvstats_rec_t));
+							memset((char *)&csa->gvstats_hist, 0, SIZEOF(gvstats_hist_t));
 							break;
 						case dba_cm:
 						case dba_usr:
@@ -1071,6 +1072,7 @@ STATICFNDEF void view_dbop(unsigned char keycode, viewparm *parmblkptr, mval *th
 					CLRGVSTATS(cs_addrs);
 				/* Reset process stats in either process-private storage or a shared statsDB record */
 				memset((char *)cs_addrs->gvstats_rec_p, 0, SIZEOF(gvstats_rec_t));
+				memset((char *)&cs_addrs->gvstats_hist, 0, SIZEOF(gvstats_hist_t));
 				break;
 			case VTK_JNLERROR:
 				if (!reg->read_only)
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  * Copyright (c) 2017 Stephen L Johnson. All rights reserved.	*
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include "gtm_string.h"
 #include "gtm_stdio.h"
+#include "gtm_time.h"
 
 #include "gtmio.h"
 #include "gdsroot.h"
@@ -77,6 +78,7 @@ GBLREF int	rts_stp_low_reclaim_passes;
 GBLREF int	indr_stp_incr_factor;
 GBLREF int	rts_stp_incr_factor;
 #endif
+GBLREF stp_gcol_stats_t		stp_gcol_stats;
 
 GBLREF mvar 			*mvartab;
 GBLREF mlabel 			*mlabtab;
@@ -384,6 +386,63 @@ static void expand_stp(size_t new_size)	/* BYPASSOK */
 }
 
 #ifndef STP_MOVE
+/* Minor collection. Strings in [stringpool.base, stringpool.gen_top) survived the previous collection and are assumed to
+ * still be mostly live so they are left where they are; only the live strings above gen_top (the nursery) are sorted and
+ * compacted down to gen_top. Since strings hold no pointers and all roots have already been gathered into [array, topstr),
+ * this is just the usual compaction restricted to the nursery entries. Garbage in the old generation is reclaimed by the
+ * next major (full) collection. Returns FALSE without touching the stringpool if the caller needs to do a major collection,
+ * i.e. if an mstr straddles gen_top or if compacting the nursery would not free up enough space.
+ */
+static boolean_t stp_gcol_nursery(ssize_t space_needed)
+{
+	mstr		**cstr, **nursery, *tmpstr;
+	unsigned char	*gen_top, *straddr, *tmpaddr, *begaddr, *endaddr;
+	ssize_t		totspace, tmplen, blklen, delta, padlen;
+
+	assert(!mstr_native_align);
+	gen_top = stringpool.gen_top;
+	/* Partition the gathered mstrs so the ones pointing into the nursery are at the end of the array */
+	for (cstr = array, nursery = topstr; cstr < nursery; )
+	{
+		tmpaddr = (unsigned char *)(*cstr)->addr;
+		if (tmpaddr < gen_top)
+		{
+			if ((tmpaddr + (*cstr)->len) > gen_top)
+				return FALSE;	/* string spans both generations (e.g. s2pool_concat() appended to it) */
+			cstr++;
+		} else
+		{
+			tmpstr = *cstr;
+			*cstr = *--nursery;
+			*nursery = tmpstr;
+		}
+	}
+	totspace = 0;
+	if (nursery != topstr)
+	{
+		stpg_sort(nursery, topstr - 1);
+		for (cstr = nursery, straddr = (unsigned char *)(*cstr)->addr; cstr < topstr; cstr++)
+		{
+			tmpaddr = (unsigned char *)(*cstr)->addr;
+			tmplen = (*cstr)->len;
+			if (tmpaddr + tmplen > straddr) /* if it is not a proper substring of previous one */
+			{
+				totspace += ((tmpaddr >= straddr) ? tmplen : (ssize_t)(tmpaddr + tmplen - straddr));
+				straddr = tmpaddr + tmplen;
+			}
+		}
+	}
+	/* Not worth it if the caller would still be short of space or would count this as a low reclaim pass */
+	if (((stringpool.top - gen_top - totspace) < space_needed)
+			|| (STP_LOWRECLAIM_LEVEL(stringpool.top - stringpool.base) > (stringpool.top - gen_top - totspace)))
+		return FALSE;
+	stringpool.free = gen_top;
+	cstr = nursery;
+	MOVE_WITHIN_STPOOL(cstr, topstr);
+	assert(stringpool.free <= gen_top + totspace);
+	return TRUE;
+}
+
 #ifdef DEBUG
 /* Verify the current symbol table that we will be processing later in "stp_gcol". This version is callable from anywhere
  * and is a great debuging tool for corrupted mstrs in local variable trees. Uncomment the call near the top of stp_gcol to
@@ -495,7 +554,9 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 	lv_xnew_var		*xnewvar;
 	lvzwrite_datablk	*lvzwrblk;
 	tp_var			*restore_ent;
-	boolean_t		non_mandatory_expansion, exp_gt_spc_needed;
+	boolean_t		non_mandatory_expansion, exp_gt_spc_needed, minor;
+	struct timespec		gc_start, gc_end;
+	gtm_uint64_t		gc_nsec;
 	routine_source		*rsptr;
 	glvn_pool_entry		*slot, *top;
 	int			i, n;
@@ -509,6 +570,8 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 	assert(!stringpool_unusable);
 	assert(!stringpool_unexpandable);
 	stringpool.gcols++;
+	clock_gettime(CLOCK_MONOTONIC, &gc_start);
+	minor = FALSE;
 #	ifndef STP_MOVE
 	/* Before we get cooking with our stringpool GC, check if it is appropriate to call lv_val garbage collection.
 	 * This is data that can get orphaned with no way to access it when aliases are used. This form of GC is only done
@@ -924,6 +987,16 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 			}
 		}
 	}
+#	ifndef STP_MOVE
+	/* Try compacting just the nursery unless a major collection is due or the old generation is not usable */
+	if ((stringpool.minor_gcols < TREF(stp_gcol_minor_max)) && !mstr_native_align
+		&& (stringpool.base < stringpool.gen_top) && (stringpool.gen_top <= stringpool.free)
+		&& stp_gcol_nursery(space_needed))
+	{
+		minor = TRUE;
+		goto stp_gcol_done;
+	}
+#	endif
 	space_before_compact = stringpool.top - stringpool.free; /* Available space before compaction */
 	DEBUG_ONLY(blklen = stringpool.free - stringpool.base);
 	old_free = stringpool.free;
@@ -1116,8 +1189,30 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 		}
 #		endif
 	}
+#	ifndef STP_MOVE
+stp_gcol_done:
+#	endif
 	assert(stringpool.free >= stringpool.base);
 	assert(stringpool.free <= stringpool.top);
+	clock_gettime(CLOCK_MONOTONIC, &gc_end);
+	gc_nsec = ((gtm_uint64_t)(gc_end.tv_sec - gc_start.tv_sec) * NANOSECS_IN_SEC) + gc_end.tv_nsec - gc_start.tv_nsec;
+	if (gc_nsec > stp_gcol_stats.max_nsec)
+		stp_gcol_stats.max_nsec = gc_nsec;
+	if (minor)
+	{
+		stp_gcol_stats.minor_gcols++;
+		stp_gcol_stats.minor_bytes += stringpool.free - stringpool.gen_top;
+		stp_gcol_stats.minor_nsec += gc_nsec;
+		stringpool.minor_gcols++;
+	} else
+	{
+		stp_gcol_stats.major_gcols++;
+		stp_gcol_stats.major_bytes += stringpool.free - stringpool.base;
+		stp_gcol_stats.major_nsec += gc_nsec;
+		stringpool.minor_gcols = 0;
+	}
+	/* Whatever survived this collection is the old generation for the next one */
+	stringpool.gen_top = stringpool.free;
 	stringpool.invokestpgcollevel = (STP_SPACE_USED_MULTIPLIER * (space_asked + stringpool.free - stringpool.base))
 		+ stringpool.base;
 	stringpool.invokestpgcollevel = (((stringpool.invokestpgcollevel - stringpool.base) < STP_GCOL_TRIGGER_FLOOR)
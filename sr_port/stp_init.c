@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -47,5 +50,7 @@ void stp_init(size_t size)
 		= na_page[0] - SIZEOF(char *);
 	set_noaccess (na_page, &stringpool.prvprt);
 	stringpool.gcols = 0;
+	stringpool.gen_top = stringpool.base;	/* no old generation yet */
+	stringpool.minor_gcols = 0;
 	return;
 }
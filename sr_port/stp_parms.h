@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -35,3 +35,6 @@
 			 * part, it will be concentrated at the bottom of the stringpool (so the OS can swap the rest out).
 			 */
 #define STP_GCOL_TRIGGER_FLOOR 150000 /* Don't set the target level to call the garbage collector below this value. */
+#define STP_GCOL_MINOR_MAX	16	/* default for $ydb_stp_gcol_minor_max: the max # of minor (nursery only) collections between
+			 * two full collections. 0 makes every collection a full one.
+			 */
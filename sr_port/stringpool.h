@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -20,8 +20,22 @@ typedef struct
 	unsigned int	strpllim;	/* non-zero value is user specified guard on expansion */
 	boolean_t	strpllimwarned;	/* if limit is in place, has been exceeded, and not recovered from */
 	unsigned char	prvprt;		/* stores memory protections used in guarding stp space */
+	unsigned char	*gen_top;	/* strings below this survived the last collection (the old generation); a minor
+					 * collection only compacts the nursery above it (see stp_gcol_nursery) */
+	unsigned int	minor_gcols;	/* minor collections since the last full collection */
 } spdesc;
 
+typedef struct
+{
+	gtm_uint64_t	minor_gcols;	/* # of collections that only compacted the nursery */
+	gtm_uint64_t	major_gcols;	/* # of collections that compacted the entire stringpool */
+	gtm_uint64_t	minor_bytes;	/* bytes of live strings compacted by minor collections */
+	gtm_uint64_t	major_bytes;	/* bytes of live strings compacted by major collections */
+	gtm_uint64_t	minor_nsec;	/* time spent in minor collections */
+	gtm_uint64_t	major_nsec;	/* time spent in major collections */
+	gtm_uint64_t	max_nsec;	/* longest single collection */
+} stp_gcol_stats_t;
+
 void	stp_expand_array(void);
 void	stp_gcol(size_t space_needed);										/* BYPASSOK */
 void	stp_move(char *from, char *to);
@@ -3,7 +3,7 @@
  * Copyright (c) 2007-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -91,6 +91,7 @@
 #include "db_snapshot.h"
 #include "wcs_wt.h"
 #include "stringpool.h"
+#include "gds_cbt.h"
 
 error_def(ERR_DBFILERR);
 error_def(ERR_FREEBLKSLOW);
@@ -313,6 +314,7 @@ enum cdb_sc	mm_update(cw_set_element *cs, trans_num ctn, trans_num effective_tn,
 	INCR_DB_CSH_COUNTER(cs_addrs, n_bgmm_updates, 1);
 	blkid = cs->blk;
 	assert((0 <= blkid) && (blkid < cs_addrs->ti->total_blks));
+	CBT_MARK(cs_data, blkid);
 	db_addr[0] = MM_BASE_ADDR(cs_addrs) + (sm_off_t)cs_data->blk_size * (blkid);
 	/* check for online backup -- ATTN: this part of code is similar to the BG_BACKUP_BLOCK macro */
 	if ((blkid >= cs_addrs->nl->nbb) && (NULL != cs->old_block)
@@ -467,6 +469,7 @@ enum cdb_sc	bg_update_phase1(cw_set_element *cs, trans_num ctn, sgm_info *si)
 	blkid = cs->blk;
 	/* assert changed to assertpro 2/15/2012. can be changed back once reorg truncate has been running for say 3 to 4 years */
 	assertpro((0 <= blkid) && (blkid < csa->ti->total_blks));
+	CBT_MARK(csd, blkid);
 	INCR_DB_CSH_COUNTER(csa, n_bgmm_updates, 1);
 	bt = bt_put(gv_cur_region, blkid);
 	GTM_WHITE_BOX_TEST(WBTEST_BG_UPDATE_BTPUTNULL, bt, NULL);
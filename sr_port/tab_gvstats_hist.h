@@ -0,0 +1,22 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* Latency histograms kept alongside the gvstats counters (see gvstats_hist_t in gvstats_rec.h). Each entry defines an array
+ * of GVSTATS_HIST_BUCKETS log2-bucketed counts in the file header, node_local and sgmnt_addrs. The TEXT1 codes are used by
+ * $VIEW("GVHIST") and the TEXT2 descriptions by DSE DUMP -FILEHEADER -GVSTATS.
+ * As with tab_gvstats_rec.h, additions are to be done at the END of the file.
+ */
+TAB_GVSTATS_HIST(h_get               , "HGET", "GET latency                  ")
+TAB_GVSTATS_HIST(h_set               , "HSET", "SET latency                  ")
+TAB_GVSTATS_HIST(h_tp_commit         , "HTPC", "TP commit latency            ")
+TAB_GVSTATS_HIST(h_crit              , "HCRT", "Crit acquisition latency     ")
+TAB_GVSTATS_HIST(h_jnl_fsync         , "HJFS", "Journal fsync latency        ")
@@ -3,6 +3,9 @@
  * Copyright (c) 2008-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -156,3 +159,12 @@ TAB_GVSTATS_REC(f_ws47               , "TRGA", "wait flag for grab region for tr
  * End Aggregate Stats Definition (please do not delete this)
  */
 #endif
+/* Stats below are saved in the file header along with the ones before the WS stats (see gvstats_rec_cnl2csd) */
+TAB_GVSTATS_REC(n_trig_eval          , "TGE",  "# of TriGgers Evaluated for a match   ")
+TAB_GVSTATS_REC(n_trig_fired         , "TGF",  "# of TriGgers Fired                   ")
+TAB_GVSTATS_REC(n_hash_chain_retry   , "HCR",  "# of Hash Chain Retries exhausted     ")
+TAB_GVSTATS_REC(n_readahead_blks     , "RAB",  "# of Read Ahead Blocks hinted to OS   ")
+TAB_GVSTATS_REC(n_readahead_hit      , "RAH",  "# of Read Ahead blocks later Hit      ")
+TAB_GVSTATS_REC(n_readahead_miss     , "RAM",  "# of Read Ahead blocks Missed (unused)")
+TAB_GVSTATS_REC(n_blk_cmp_write      , "CBW",  "# of Compressed Block Writes          ")
+TAB_GVSTATS_REC(n_blk_uncmp_read     , "CBR",  "# of Compressed Block Reads           ")
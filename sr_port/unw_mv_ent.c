@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -110,6 +110,7 @@ GBLREF int 			dollar_truth;
 void unw_mv_ent(mv_stent *mv_st_ent)
 {
 	lv_blk			*lp, *lpnext;
+	lvTree			*lvt, *lvttop;
 	lv_val			*lvval_ptr;
 	symval			*symval_ptr, *sym;
 	ht_ent_mname		*hte;
@@ -259,6 +260,12 @@ void unw_mv_ent(mv_stent *mv_st_ent)
 				for (lp = symval_ptr->lvtree_first_block; NULL != lp; lp = lpnext)
 				{
 					lpnext = lp->next;
+					/* Subscript levels that were converted to B+trees have malloced blocks of their own */
+					for (lvt = (lvTree *)LV_BLK_GET_BASE(lp), lvttop = lvt + lp->numUsed; lvt < lvttop; lvt++)
+					{
+						if ((NULL != LVT_GET_PARENT(lvt)) && (NULL != lvt->bt_root))
+							lvBtreeFree(lvt);
+					}
 					free(lp);
 				}
 				symval_ptr->lvtree_first_block = NULL;
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -53,6 +53,7 @@ VIEWTAB("GVDUPSETNOOP",		VTP_NULL | VTP_VALUE,		VTK_GVDUPSETNOOP,	MV_STR),
 VIEWTAB("GVFILE",		VTP_DBREGION,			VTK_GVFILE,		MV_STR),
 VIEWTAB("GVFIRST",		VTP_NULL,			VTK_GVFIRST,		MV_STR), /* nodoc : archaic and deprecated.
 												  * use GVNEXT instead */
+VIEWTAB("GVHIST",		VTP_DBREGION,			VTK_GVHIST,		MV_STR),
 VIEWTAB("GVNEXT",		VTP_DBREGION,			VTK_GVNEXT,		MV_STR),
 VIEWTAB("GVSRESET",		VTP_DBREGION | VTP_NULL,	VTK_GVSRESET,		MV_STR),
 VIEWTAB("GVSTATS",		VTP_DBREGION,			VTK_GVSTATS,		MV_STR),
@@ -118,6 +119,7 @@ VIEWTAB("RESETGVSTATS",		VTP_NULL,			VTK_RESETGVSTATS,	MV_STR),
 VIEWTAB("RTNCHECKSUM",		VTP_RTNAME,			VTK_RTNCHECKSUM,	MV_STR),
 VIEWTAB("RTNNEXT",		VTP_RTNAME,			VTK_RTNEXT,		MV_STR),
 VIEWTAB("SETENV",		VTP_VALUE,			VTK_SETENV,		MV_STR),
+VIEWTAB("SPGCSTATS",		VTP_NULL,			VTK_SPGCSTATS,		MV_STR),
 VIEWTAB("SPSIZE",		VTP_NULL,			VTK_SPSIZE,		MV_STR),
 VIEWTAB("STATSHARE",		VTP_NULL | VTP_DBREGION,	VTK_STATSHARE,		MV_NM),
 VIEWTAB("STKSIZ",		VTP_NULL,			VTK_STKSIZ,		MV_NM),
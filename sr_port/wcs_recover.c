@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -255,7 +255,10 @@ void wcs_recover(gd_region *reg)
 	hash_hdr = (cache_rec_ptr_t)csa->acc_meth.bg.cache_state->cache_array;
 	bt_buckets = csd->bt_buckets;
 	for (cr = hash_hdr, cr_hi = cr + bt_buckets; cr < cr_hi; cr++)
+	{
+		BEGIN_BLKQUE_CHANGE(cr);		/* out-of-crit "db_csh_get" should not trust chains while we rebuild */
 		cr->blkque.fl = cr->blkque.bl = 0;	/* take no chances that the blkques are messed up */
+	}
 	cr_lo = cr_hi;
 	cr_hi = cr_lo + csd->n_bts;
 	blk_size = csd->blk_size;
@@ -652,6 +655,8 @@ void wcs_recover(gd_region *reg)
 		}
 		/* end of processing for a single cache record */
 	}	/* end of processing all cache records */
+	for (cr = hash_hdr, cr_hi = cr + bt_buckets; cr < cr_hi; cr++)
+		END_BLKQUE_CHANGE(cr);
 	assert(0 > GDS_CREATE_BLK_MAX);	/* the minimum block # is 0 which should be greater than the macro.
 					 * this is relied upon by cnl->highest_lbm_blk_changed maintenance code
 					 * in "bm_update" and "sec_shr_map_build".
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -39,6 +39,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BADCHAR,                    "$ydb_badchar",
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BAKTMPDIR,                  "$ydb_baktmpdir",                  "$gtm_baktmpdir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BAKTMPDIR_UC,               "$ydb_baktmpdir",                  "$GTM_BAKTMPDIR")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BLKUPGRADE_FLAG,            "$ydb_blkupgrade_flag",            "$gtm_blkupgrade_flag")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BLK_RSTRT_INDEX_SIZE,       "$ydb_blk_rstrt_index_size",       "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_BOOLEAN,                    "$ydb_boolean",                    "$gtm_boolean")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CALLIN_START,               "$ydb_callin_start",               "$GTM_CALLIN_START")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CHSET,                      "$ydb_chset",                      "$gtm_chset")
@@ -79,12 +80,15 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GDSCERT,                    "$ydb_gdscert",
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_HUPENABLE,		       "$ydb_hupenable",		  "$gtm_hupenable")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_ICU_VERSION,                "$ydb_icu_version",                "$gtm_icu_version")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_IPV4_ONLY,                  "$ydb_ipv4_only",                  "$gtm_ipv4_only")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_JNL_FSYNC_DELAY,            "$ydb_jnl_fsync_delay",            "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_JNL_RELEASE_TIMEOUT,        "$ydb_jnl_release_timeout",        "$gtm_jnl_release_timeout")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LCT_STDNULL,                "$ydb_lct_stdnull",                "$gtm_lct_stdnull")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINK,                       "$ydb_link",                       "$gtm_link")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINKTMPDIR,                 "$ydb_linktmpdir",                 "$gtm_linktmpdir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCALE,                     "$ydb_locale",                     "$gtm_locale")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCAL_COLLATE,              "$ydb_local_collate",              "$gtm_local_collate")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCK_FIFO,                  "$ydb_lock_fifo",                  "")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCK_STRIPES,               "$ydb_lock_stripes",               "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOG,                        "$ydb_log",                        "$gtm_log")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LVNULLSUBS,                 "$ydb_lvnullsubs",                 "$gtm_lvnullsubs")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_MAXTPTIME,                  "$ydb_maxtptime",                  "$gtm_zmaxtptime")
@@ -114,7 +118,9 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_PRINCIPAL_EDITING,          "$ydb_principal_e
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_PROCSTUCKEXEC,              "$ydb_procstuckexec",              "$gtm_procstuckexec")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_PROMPT,                     "$ydb_prompt",                     "$gtm_prompt")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_QUIET_HALT,                 "$ydb_quiet_halt",                 "$gtm_quiet_halt")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_READAHEAD,                  "$ydb_readahead",                  "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_RECOMPILE_NEWER_SRC,        "$ydb_recompile_newer_src",        "")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_CMP_STREAM,            "$ydb_repl_cmp_stream",            "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_FILTER_TIMEOUT,        "$ydb_repl_filter_timeout",        "$gtm_repl_filter_timeout")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_INSTANCE,              "$ydb_repl_instance",              "$gtm_repl_instance")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_INSTNAME,              "$ydb_repl_instname",              "$gtm_repl_instname")
@@ -122,10 +128,12 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_INSTSECONDARY,         "$ydb_repl_instse
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_ROUTINES,                   "$ydb_routines",                   "$gtmroutines")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SIDE_EFFECTS,               "$ydb_side_effects",               "$gtm_side_effects")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SOCKET_KEEPALIVE_IDLE,      "$ydb_socket_keepalive_idle",      "$gtm_socket_keepalive_idle")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SOCKET_WBUFFER,             "$ydb_socket_wbuffer",             "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SNAPTMPDIR,                 "$ydb_snaptmpdir",                 "$gtm_snaptmpdir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STATSDIR,                   "$ydb_statsdir",                   "$gtm_statsdir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STATSHARE,                  "$ydb_statshare",                  "$gtm_statshare")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STDXKILL,                   "$ydb_stdxkill",                   "$gtm_stdxkill")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STP_GCOL_MINOR_MAX,         "$ydb_stp_gcol_minor_max",         "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STRING_POOL_LIMIT,          "$ydb_string_pool_limit",          "$gtm_string_pool_limit")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SYSID,                      "$ydb_sysid",                      "$gtm_sysid")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TREAT_SIGUSR2_LIKE_SIGUSR1, "$ydb_treat_sigusr2_like_sigusr1", "")
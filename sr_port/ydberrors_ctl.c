@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -41,9 +41,9 @@ LITDEF	err_msg ydberrors[] = {
 	{ "SETENVFAIL", "VIEW \"SETENV\":\"!AD\" failed in setenv() system call", 2, 0 },
 	{ "UNSETENVFAIL", "VIEW \"UNSETENV\":\"!AD\" failed in unsetenv() system call", 2, 0 },
 	{ "UNKNOWNSYSERR", "[!UL] does not correspond to a known YottaDB error code", 1, 0 },
-	{ "UNUSED56R132", "Unused error - last used r1.32", 0, 0 },
+	{ "CURSORINVALID", "Cursor [!@UQ] passed to !AD is not an open cursor", 3, 0 },
 	{ "NODEEND", "End of list of nodes/subscripts", 0, 0 },
-	{ "UNUSED58R132", "Unused error - last used r1.32", 0, 0 },
+	{ "CURSORSNAPSHOT", "!AD : a snapshot cursor must be opened and used inside the same TP transaction", 2, 0 },
 	{ "INVTPTRANS", "Invalid TP transaction - either invalid TP token or transaction not in progress", 0, 0 },
 	{ "THREADEDAPINOTALLOWED", "Process cannot switch to using threaded Simple API while already using Simple API", 0, 0 },
 	{ "SIMPLEAPINOTALLOWED", "Process cannot switch to using Simple API while already using threaded Simple API", 0, 0 },
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -82,20 +82,21 @@ void gtcml_chklck(cm_lckblkreg *reg, bool timed)
 						{	/* Blocking process shrblk exists. Check it under crit lock */
 							csa = &FILE_INFO(gv_cur_region)->s_addrs;
 							MLK_PVTCTL_INIT(pctl, gv_cur_region);
+							MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE_OF(pctl.ctl, d));
 							GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
 							if (d->sequence != prc1->blk_sequence)
 							{	/* Blocking structure no longer ours - do artificial wakeup */
-								lck->sequence = csa->hdr->trans_hist.lock_sequence++;
+								lck->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
 							} else if (d->owner)
 							{	/* Blocking struct still has owner. Check if alive */
 								if (PROC_DEAD(d, time, icount, status))
 								{	/* process that owned lock has died, free lock */
 									d->owner = 0;
-									lck->sequence = csa->hdr->trans_hist.lock_sequence++;
+									lck->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
 								}
 							} else
 							{	/* No longer any owner (lke stole?). Wake up */
-								lck->sequence = csa->hdr->trans_hist.lock_sequence++;
+								lck->sequence = MLK_NEXT_LOCK_SEQUENCE(csa);
 							}
 							REL_LOCK_CRIT(pctl, was_crit);
 						}
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -38,6 +38,8 @@ void gtcml_chkreg(void)
 {
 	cm_lckblkreg	*reg, *reg1;
 	gtm_uint64_t	wakeup;
+	mlk_ctldata	*ctl;
+	uint4		num_stripes, stripe;
 
 	ASSERT_IS_LIBGNPSERVER;
 	sys_get_curr_time(&chkreg_time);	/* just once per pass */
@@ -56,7 +58,9 @@ void gtcml_chkreg(void)
 			 * outside of LOCK crit) is not a big deal - reconsider on any evidence to the contrary and if so check
 			 * mlk_unpend as well
 			 */
-			wakeup = ((mlk_ctldata *)FILE_INFO(gv_cur_region)->s_addrs.mlkctl)->wakeups;
+			ctl = (mlk_ctldata *)FILE_INFO(gv_cur_region)->s_addrs.mlkctl;
+			for (wakeup = 0, stripe = 0, num_stripes = ctl->num_stripes; stripe < num_stripes; stripe++)
+				wakeup += MLK_CTL_STRIPE(ctl, stripe)->wakeups;		/* any stripe waking up a process */
 			assert(wakeup);
 			if (reg->region->wakeup < wakeup)
 			{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -66,8 +66,8 @@ void gtcml_lklist(void)
 		translev = *ptr++; len--;
 		subcnt = *ptr++; len--;
 		MLK_PVTBLK_ALLOC(len, subcnt, 0, new_entry);
-		MLK_PVTCTL_INIT(new_entry->pvtctl, reg_ref->reghead->reg);
 		memcpy(&new_entry->value[0], ptr, len);
+		MLK_PVTCTL_INIT_PVTBLK(new_entry, reg_ref->reghead->reg);
 		ptr += len;
 		reg_ref->oper = PENDING;
 		new_entry->translev = translev;
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -60,6 +60,7 @@ cm_op_t gtcmtr_lke_clearrep(struct CLB *lnk, clear_request *creq)
 	uint4			status;
 	boolean_t		was_crit;
 	mlk_pvtctl		pctl;
+	uint4			num_stripes, stripe;
 
 	ASSERT_IS_LIBGNPSERVER;
 	cur_region = gv_cur_region = gtcm_find_region(curr_entry, creq->rnum)->reghead->reg;
@@ -71,12 +72,18 @@ cm_op_t gtcmtr_lke_clearrep(struct CLB *lnk, clear_request *creq)
 		dnode.len = creq->nodelength;
 		dnode.addr = creq->node;
 		MLK_PVTCTL_INIT(pctl, cur_region);
-		GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-		if (lke_ctl->blkroot != 0)
-			/* Remote lock clears are not supported, so LKE CLEAR -EXACT qualifier will not be supported on GT.CM.*/
-			lke_cleartree(&pctl, lnk, (mlk_shrblk_ptr_t)R2A(lke_ctl->blkroot), creq->all,
-				      creq->interactive, creq->pid, dnode, FALSE);
-		REL_LOCK_CRIT(pctl, was_crit);
+		for (stripe = 0, num_stripes = lke_ctl->num_stripes; stripe < num_stripes; stripe++)
+		{
+			MLK_PVTCTL_SET_CTL(pctl, MLK_CTL_STRIPE(lke_ctl, stripe));
+			GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
+			if (pctl.ctl->blkroot != 0)
+				/* Remote lock clears are not supported, so LKE CLEAR -EXACT qualifier will not be supported
+				 * on GT.CM.
+				 */
+				lke_cleartree(&pctl, lnk, (mlk_shrblk_ptr_t)R2A(pctl.ctl->blkroot), creq->all,
+					      creq->interactive, creq->pid, dnode, FALSE);
+			REL_LOCK_CRIT(pctl, was_crit);
+		}
 	}
 	srep.code = CMMS_U_LKEDELETE;
 	lnk->cbl = SIZEOF(srep.code);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -67,6 +67,8 @@ cm_op_t gtcmtr_lke_showrep(struct CLB *lnk, show_request *sreq)
 	uint4			status;
 	boolean_t		was_crit;
 	mlk_pvtctl		pctl, pctl2;
+	mlk_ctldata_ptr_t	stripe_ctl;
+	uint4			num_stripes, stripe;
 
 	ASSERT_IS_LIBGNPSERVER;
 	cur_region = gv_cur_region = gtcm_find_region(curr_entry, sreq->rnum)->reghead->reg;
@@ -75,21 +77,26 @@ cm_op_t gtcmtr_lke_showrep(struct CLB *lnk, show_request *sreq)
 		csa = &FILE_INFO(cur_region)->s_addrs;
 		ls_len = csa->mlkctl_len;
 		lke_ctl = (mlk_ctldata *)malloc(ls_len);
-		/* Prevent any modification of the lock space while we make a local copy of it */
 		pctl.region = cur_region;
 		pctl.csa = csa;
-		pctl.ctl = (mlk_ctldata_ptr_t)pctl.csa->mlkctl;
-		/* No need to set up shrblk just to do an lke_showtree() with no memory dump. */
-		GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-		memcpy((uchar_ptr_t)lke_ctl, pctl.ctl, ls_len);
-		pctl2 = pctl;
-		REL_LOCK_CRIT(pctl, was_crit);
-		pctl2.ctl = lke_ctl;
 		util_cm_print(lnk, 0, NULL, RESET);
 		dnode.len = sreq->nodelength;
 		dnode.addr = sreq->node;
-		if (lke_ctl->blkroot != 0)
-			(void)lke_showtree(lnk, &pctl2, sreq->all, sreq->wait, sreq->pid, dnode, FALSE, NULL);
+		for (stripe = 0, num_stripes = csa->mlkctl->num_stripes; stripe < num_stripes; stripe++)
+		{
+			pctl.ctl = MLK_CTL_STRIPE(csa->mlkctl, stripe);
+			/* Copy of the stripe goes at the same offset in "lke_ctl" as the stripe in shared memory */
+			stripe_ctl = (mlk_ctldata_ptr_t)((sm_uc_ptr_t)lke_ctl + ((sm_uc_ptr_t)pctl.ctl - (sm_uc_ptr_t)csa->mlkctl));
+			/* Prevent any modification of the lock space while we make a local copy of it */
+			/* No need to set up shrblk just to do an lke_showtree() with no memory dump. */
+			GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
+			memcpy((uchar_ptr_t)stripe_ctl, pctl.ctl, pctl.ctl->stripe_size);
+			pctl2 = pctl;
+			REL_LOCK_CRIT(pctl, was_crit);
+			pctl2.ctl = stripe_ctl;
+			if (stripe_ctl->blkroot != 0)
+				(void)lke_showtree(lnk, &pctl2, sreq->all, sreq->wait, sreq->pid, dnode, FALSE, NULL);
+		}
 		free(lke_ctl);
 	}
 	srep.code = CMMS_U_LKESHOW;
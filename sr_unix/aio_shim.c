@@ -3,7 +3,7 @@
  * Copyright (c) 2016-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -41,6 +41,16 @@
 #include <stdint.h>
 #include "gtm_poll.h"
 #include "gtm_stdlib.h"
+#include "min_max.h"
+#if defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#  endif
+#endif
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#  define USE_IO_URING		/* IORING_FEAT_RW_CUR_POS came in with IORING_OP_WRITE (Linux 5.6) */
+#  include <sys/mman.h>
+#endif
 
 /* aio_shim.c: serves as a "shim" between both POSIX AIO and Linux AIO
  * interfaces. Because POSIX AIO is truly asynchronous from the client's
@@ -56,6 +66,11 @@
  *     over the same region, we clean up everything so that the next write
  *     into that region will set up the kernel context for the second global
  *     directory.
+ *
+ * Regions with "asyncio_uring" set use an io_uring instance (one per global directory, like the Linux AIO context)
+ * instead. "aio_shim_write" only queues such writes in the submission ring and "aio_shim_submit" (invoked at the end of
+ * "wcs_wtstart" and "wcs_wtfini") submits all of them with one system call. The eventfd used for Linux AIO completions
+ * is registered with the ring so the same multiplexing thread reaps the completion ring and sets the aiocb status.
  */
 
 GBLREF  char 		*aio_shim_errstr;
@@ -124,6 +139,42 @@ MBSTART {								\
 #define ATOMIC_SUB_FETCH(ptr, val) INTERLOCK_ADD(ptr, -val)
 #define ATOMIC_ADD_FETCH(ptr, val) INTERLOCK_ADD(ptr, val)
 
+#ifdef USE_IO_URING
+#define io_uring_setup(entries, params) syscall(__NR_io_uring_setup, entries, params)
+#define io_uring_enter(fd, to_submit, min_complete, flags) syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0)
+#define io_uring_register(fd, opcode, arg, nr_args) syscall(__NR_io_uring_register, fd, opcode, arg, nr_args)
+
+struct aio_uring
+{
+	int			fd;
+	unsigned int		sq_entries;
+	unsigned int		sq_mask;
+	unsigned int		cq_mask;
+	unsigned int		*sq_head;	/* advanced by the kernel as it consumes submission queue entries */
+	unsigned int		*sq_tail;	/* advanced by us to make queued entries visible to the kernel */
+	unsigned int		*sq_array;
+	unsigned int		*cq_head;	/* advanced by the multiplexing thread as it reaps completions */
+	unsigned int		*cq_tail;	/* advanced by the kernel as writes complete */
+	struct io_uring_sqe	*sqes;
+	struct io_uring_cqe	*cqes;
+	void			*sq_ring;
+	void			*cq_ring;
+	size_t			sq_ring_sz;
+	size_t			cq_ring_sz;
+	size_t			sqes_sz;
+	unsigned int		sq_local_tail;	/* "sq_tail" including entries queued but not yet submitted */
+	unsigned int		pending;	/* number of entries queued but not yet submitted */
+	volatile int		num_ios;	/* number of writes queued or in flight */
+};
+
+STATICFNDCL int aio_uring_init(struct gd_info *gdi);
+STATICFNDCL void aio_uring_cleanup(struct aio_uring *uring);
+STATICFNDCL int aio_uring_write(struct gd_info *gdi, struct aiocb *aiocbp);
+STATICFNDCL void aio_uring_submit(struct gd_info *gdi);
+STATICFNDCL int aio_uring_reap(struct aio_uring *uring);
+STATICFNDCL void aio_uring_drain(struct gd_info *gdi);
+#endif
+
 /* Note that ERROR_LIT MUST be a literal */
 #define ISSUE_SYSCALL_RTS_ERROR_WITH_GD(GD, ERROR_LIT, SAVE_ERRNO)			\
 MBSTART {										\
@@ -191,6 +242,11 @@ STATICFNDCL void *io_getevents_multiplexer(void *arg)
 			ret = io_getevents_internal(gdi->ctx);
 			if (-1 == ret)
 				RECORD_ERROR_IN_WORKER_THREAD_AND_EXIT(gdi, "worker_thread::io_getevents()", errno);
+#			ifdef USE_IO_URING
+			SHM_READ_MEMORY_BARRIER;	/* for uptodate value of gdi->uring (set by main thread) */
+			if (NULL != gdi->uring)
+				ret += aio_uring_reap(gdi->uring);
+#			endif
 			num_ios = ATOMIC_SUB_FETCH(&gdi->num_ios, ret);
 			assert(num_ios >= 0);
 		}
@@ -377,6 +433,8 @@ STATICFNDCL int aio_shim_thread_init(gd_addr *gd)
 	tmp_gdi.laio_efd = FD_INVALID;
 	tmp_gdi.ctx = 0;
 	tmp_gdi.num_ios = 0;
+	tmp_gdi.uring = NULL;
+	tmp_gdi.uring_unavail = FALSE;
 	tmp_gdi.err_syscall = NULL;
 	tmp_gdi.save_errno = 0;
 	/* Sets up the eventfd which notifies the multiplexing thread that it must exit.  */
@@ -484,6 +542,17 @@ void aio_shim_destroy(gd_addr *gd)
 	assert(0 == ret);
 	if (-1 == ret)
 		ISSUE_SYSCALL_RTS_ERROR_WITH_GD(gd, "aio_shim_destroy::io_destroy", errno);
+#	ifdef USE_IO_URING
+	if (NULL != gdi->uring)
+	{	/* Closing the ring does not wait for writes in flight, which could then land on disk after another process
+		 * reissued them with newer contents, or from buffers reused by then. So, like "io_destroy" does for Linux
+		 * AIO, cancel what has not started and wait for every write to complete before tearing the ring down.
+		 */
+		aio_uring_drain(gdi);
+		aio_uring_cleanup(gdi->uring);
+		gdi->uring = NULL;
+	}
+#	endif
 	/* If there was at least one region with reg->was_open = TRUE, then it is possible regions in other glds
 	 * (different from "gd" have a "udi" with "udi->owning_gd" == "gd". So we would need to look at all regions
 	 * across all glds opened by this process. If no was_open region was ever seen by this process, then it is
@@ -561,6 +630,14 @@ int aio_shim_write(gd_region *reg, struct aiocb *aiocbp)
 	/* submit the write */
 	CHECK_ERROR_IN_WORKER_THREAD(reg, udi);
 	aiocbp->status = EINPROGRESS;
+#	ifdef USE_IO_URING
+	if (udi->s_addrs.hdr->asyncio_uring && !gdi->uring_unavail)
+	{
+		if ((NULL != gdi->uring) || (0 == aio_uring_init(gdi)))
+			return aio_uring_write(gdi, aiocbp);
+		gdi->uring_unavail = TRUE;	/* kernel does not support it; use Linux AIO from now on */
+	}
+#	endif
 	iocbp = (struct iocb *)aiocbp;
 	iocbp->aio_lio_opcode = IOCB_CMD_PWRITE;
 	iocbp->aio_resfd = gdi->laio_efd;
@@ -579,4 +656,247 @@ int aio_shim_write(gd_region *reg, struct aiocb *aiocbp)
 	return -1;
 }
 
+/* Submits all writes queued by "aio_shim_write" for regions with "asyncio_uring" set */
+void aio_shim_submit(gd_region *reg)
+{
+#	ifdef USE_IO_URING
+	gd_addr		*owning_gd;
+	struct gd_info	*gdi;
+
+	owning_gd = FILE_INFO(reg)->owning_gd;
+	if ((NULL != owning_gd) && (NULL != (gdi = owning_gd->gd_runtime->thread_gdi)))
+		aio_uring_submit(gdi);
+#	endif
+}
+
+#ifdef USE_IO_URING
+/* Sets up the io_uring instance of a multiplexing thread. Returns 0 on success and -1 (with errno set) otherwise. */
+STATICFNDEF int aio_uring_init(struct gd_info *gdi)
+{
+	struct io_uring_params	params;
+	struct aio_uring	*uring;
+	int			fd, efd, ret, save_errno;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	memset(&params, 0, SIZEOF(params));
+	if (-1 == (fd = io_uring_setup(TREF(ydb_aio_nr_events), &params)))
+		return -1;
+	if (!(params.features & IORING_FEAT_RW_CUR_POS))
+	{	/* Kernel predates IORING_OP_WRITE */
+		CLOSEFILE_RESET(fd, ret);
+		errno = EINVAL;
+		return -1;
+	}
+	uring = gtm_malloc(SIZEOF(struct aio_uring));
+	memset(uring, 0, SIZEOF(struct aio_uring));
+	uring->fd = fd;
+	uring->sq_ring = uring->cq_ring = uring->sqes = MAP_FAILED;
+	uring->sq_ring_sz = params.sq_off.array + params.sq_entries * SIZEOF(unsigned int);
+	uring->cq_ring_sz = params.cq_off.cqes + params.cq_entries * SIZEOF(struct io_uring_cqe);
+	uring->sqes_sz = params.sq_entries * SIZEOF(struct io_uring_sqe);
+	uring->sq_ring = mmap(NULL, uring->sq_ring_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED != uring->sq_ring)
+		uring->cq_ring = mmap(NULL, uring->cq_ring_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+					IORING_OFF_CQ_RING);
+	if (MAP_FAILED != uring->cq_ring)
+		uring->sqes = mmap(NULL, uring->sqes_sz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	efd = gdi->laio_efd;
+	if ((MAP_FAILED == uring->sqes) || (0 != io_uring_register(fd, IORING_REGISTER_EVENTFD, &efd, 1)))
+	{
+		save_errno = errno;
+		aio_uring_cleanup(uring);
+		errno = save_errno;
+		return -1;
+	}
+	uring->sq_entries = params.sq_entries;
+	uring->sq_mask = *(unsigned int *)((sm_uc_ptr_t)uring->sq_ring + params.sq_off.ring_mask);
+	uring->sq_head = (unsigned int *)((sm_uc_ptr_t)uring->sq_ring + params.sq_off.head);
+	uring->sq_tail = (unsigned int *)((sm_uc_ptr_t)uring->sq_ring + params.sq_off.tail);
+	uring->sq_array = (unsigned int *)((sm_uc_ptr_t)uring->sq_ring + params.sq_off.array);
+	uring->cq_mask = *(unsigned int *)((sm_uc_ptr_t)uring->cq_ring + params.cq_off.ring_mask);
+	uring->cq_head = (unsigned int *)((sm_uc_ptr_t)uring->cq_ring + params.cq_off.head);
+	uring->cq_tail = (unsigned int *)((sm_uc_ptr_t)uring->cq_ring + params.cq_off.tail);
+	uring->cqes = (struct io_uring_cqe *)((sm_uc_ptr_t)uring->cq_ring + params.cq_off.cqes);
+	uring->sq_local_tail = *uring->sq_tail;
+	SHM_WRITE_MEMORY_BARRIER;	/* multiplexing thread should see a fully initialized "uring" */
+	gdi->uring = uring;
+	return 0;
+}
+
+STATICFNDEF void aio_uring_cleanup(struct aio_uring *uring)
+{
+	int	ret;
+
+	if (MAP_FAILED != uring->sqes)
+		munmap(uring->sqes, uring->sqes_sz);
+	if (MAP_FAILED != uring->cq_ring)
+		munmap(uring->cq_ring, uring->cq_ring_sz);
+	if (MAP_FAILED != uring->sq_ring)
+		munmap(uring->sq_ring, uring->sq_ring_sz);
+	CLOSEFILE_RESET(uring->fd, ret);
+	assert(0 == ret);
+	gtm_free(uring);
+}
+
+/* Queues a write in the submission ring. It is submitted to the kernel by the next "aio_uring_submit" */
+STATICFNDEF int aio_uring_write(struct gd_info *gdi, struct aiocb *aiocbp)
+{
+	struct aio_uring	*uring;
+	struct io_uring_sqe	*sqe;
+	unsigned int		index;
+
+	uring = gdi->uring;
+	/* Limiting the number of writes in flight to the size of the submission ring ensures the completion ring
+	 * (twice as big) never overflows and a submission ring entry is never reused before the kernel consumed it.
+	 */
+	if (uring->num_ios >= (int)uring->sq_entries)
+	{	/* Same as io_submit() returning EAGAIN. Caller knows how to handle this. */
+		aio_shim_errstr = "io_uring_enter()";
+		errno = EAGAIN;
+		return -1;
+	}
+	index = uring->sq_local_tail & uring->sq_mask;
+	sqe = &uring->sqes[index];
+	memset(sqe, 0, SIZEOF(*sqe));
+	sqe->opcode = IORING_OP_WRITE;
+	sqe->fd = aiocbp->sys_iocb.aio_fildes;
+	sqe->off = aiocbp->sys_iocb.aio_offset;
+	sqe->addr = aiocbp->sys_iocb.aio_buf;
+	sqe->len = (unsigned int)aiocbp->sys_iocb.aio_nbytes;
+	sqe->user_data = (UINTPTR_T)aiocbp;
+	uring->sq_array[index] = index;
+	uring->sq_local_tail++;
+	uring->pending++;
+	ATOMIC_ADD_FETCH(&uring->num_ios, 1);
+	ATOMIC_ADD_FETCH(&gdi->num_ios, 1);
+	return 0;
+}
+
+/* Makes all queued writes visible to the kernel and submits them with one "io_uring_enter" call. Writes the kernel could not
+ * accept are marked ECANCELED so "wcs_wtfini" reissues them (just like writes canceled by "clean_wip_queue").
+ */
+STATICFNDEF void aio_uring_submit(struct gd_info *gdi)
+{
+	struct aio_uring	*uring;
+	struct aiocb		*aiocbp;
+	unsigned int		head;
+	int			ret, num_tries, num_ios;
+
+	uring = gdi->uring;
+	if ((NULL == uring) || (0 == uring->pending))
+		return;
+	SHM_WRITE_MEMORY_BARRIER;	/* submission ring entries need to be visible before the tail that covers them */
+	*(volatile unsigned int *)uring->sq_tail = uring->sq_local_tail;
+	for (num_tries = 0; num_tries < MAX_WIP_TRIES; num_tries++)
+	{
+		while ((-1 == (ret = io_uring_enter(uring->fd, uring->pending, 0, 0))) && (EINTR == errno))
+			;
+		SHM_READ_MEMORY_BARRIER;
+		head = *(volatile unsigned int *)uring->sq_head;
+		uring->pending = uring->sq_local_tail - head;
+		if (0 == uring->pending)
+			return;
+		assert((-1 != ret) || (EAGAIN == errno) || (EBUSY == errno));
+	}
+	for ( ; head != uring->sq_local_tail; head++)
+	{
+		aiocbp = (struct aiocb *)(UINTPTR_T)uring->sqes[uring->sq_array[head & uring->sq_mask]].user_data;
+		AIOCBP_SET_FLDS(aiocbp, -1, ECANCELED);
+		ATOMIC_SUB_FETCH(&uring->num_ios, 1);
+		num_ios = ATOMIC_SUB_FETCH(&gdi->num_ios, 1);
+		assert(num_ios >= 0);
+	}
+	uring->sq_local_tail -= uring->pending;
+	*(volatile unsigned int *)uring->sq_tail = uring->sq_local_tail;
+	uring->pending = 0;
+}
+
+/* Reaps the completion ring and returns the number of writes reaped. Invoked only by the multiplexing thread. */
+/* #GTM_THREAD_SAFE : The below function (aio_uring_reap) is thread-safe */
+STATICFNDEF int aio_uring_reap(struct aio_uring *uring)
+{
+	struct io_uring_cqe	*cqe;
+	struct aiocb		*aiocbp;
+	unsigned int		head, tail;
+	int			num_ios = 0;
+
+	head = *uring->cq_head;
+	while (TRUE)
+	{
+		tail = *(volatile unsigned int *)uring->cq_tail;
+		SHM_READ_MEMORY_BARRIER;	/* read completion ring entries only after the tail that covers them */
+		if (head == tail)
+			break;
+		for ( ; head != tail; head++, num_ios++)
+		{
+			cqe = &uring->cqes[head & uring->cq_mask];
+			aiocbp = (struct aiocb *)(UINTPTR_T)cqe->user_data;
+			if (NULL == aiocbp)
+			{	/* Completion of the cancel request issued by "aio_uring_drain"; not a write */
+				num_ios--;
+				continue;
+			}
+			/* A negative "res" is the negated errno, like with Linux AIO (see "io_getevents_internal") */
+			if (0 <= cqe->res)
+				AIOCBP_SET_FLDS(aiocbp, cqe->res, 0);
+			else
+				AIOCBP_SET_FLDS(aiocbp, -1, -cqe->res);
+		}
+		SHM_WRITE_MEMORY_BARRIER;	/* done with the entries before the kernel can reuse them */
+		*(volatile unsigned int *)uring->cq_head = head;
+	}
+	if (num_ios)
+		ATOMIC_SUB_FETCH(&uring->num_ios, num_ios);
+	return num_ios;
+}
+
+/* Submits any queued writes, asks the kernel to cancel the ones that have not started and waits until every write has
+ * completed (or been canceled) and was reaped. Invoked by the main thread only after the multiplexing thread exited.
+ */
+STATICFNDEF void aio_uring_drain(struct gd_info *gdi)
+{
+	struct aio_uring	*uring;
+	struct io_uring_sqe	*sqe;
+	unsigned int		index;
+	int			ret, num_ios;
+
+	uring = gdi->uring;
+	aio_uring_submit(gdi);
+	if (0 == uring->num_ios)
+		return;
+#	ifdef IORING_ASYNC_CANCEL_ANY
+	/* All submission ring entries were consumed by "aio_uring_submit" and the completion ring has room for one more
+	 * entry (see "aio_uring_write"), so the cancel request fits. Its completion has a zero "user_data" so
+	 * "aio_uring_reap" does not count it as a write. A kernel that does not know the flags fails the request, in which
+	 * case we just wait for the writes to complete.
+	 */
+	index = uring->sq_local_tail & uring->sq_mask;
+	sqe = &uring->sqes[index];
+	memset(sqe, 0, SIZEOF(*sqe));
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->cancel_flags = IORING_ASYNC_CANCEL_ALL | IORING_ASYNC_CANCEL_ANY;
+	sqe->user_data = 0;
+	uring->sq_array[index] = index;
+	uring->sq_local_tail++;
+	SHM_WRITE_MEMORY_BARRIER;
+	*(volatile unsigned int *)uring->sq_tail = uring->sq_local_tail;
+	while ((-1 == (ret = io_uring_enter(uring->fd, 1, 0, 0))) && (EINTR == errno))
+		;
+#	endif
+	while (0 < uring->num_ios)
+	{
+		while ((-1 == (ret = io_uring_enter(uring->fd, 0, 1, IORING_ENTER_GETEVENTS))) && (EINTR == errno))
+			;
+		assert(-1 != ret);
+		if (-1 == ret)
+			break;	/* cannot wait on the ring; closing it will still make the kernel cancel or finish the writes */
+		num_ios = aio_uring_reap(uring);
+		num_ios = ATOMIC_SUB_FETCH(&gdi->num_ios, num_ios);
+		assert(num_ios >= 0);
+	}
+}
+#endif
+
 #endif
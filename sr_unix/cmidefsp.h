@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -88,6 +88,7 @@ typedef struct clb_stat_struct
  */
 
 #include "gtm_inet.h"
+#include <sys/epoll.h>
 #ifdef __MVS__
 /* need fd_set */
 #include <sys/time.h>
@@ -102,6 +103,7 @@ struct CLB
 	struct sockaddr_storage peer_sas;	/* peer */
 	struct addrinfo		peer_ai;	/* peer */
 	int mun;     		                /* endpoint's file descriptor */
+	uint4 epoll_events;			/* events "mun" is registered for in ntd->epoll_fd */
 	void *usr;				/* client specific storage */
 	qio_iosb ios;				/* used for tracking inprocess I/O */
 	unsigned short cbl;			/* number of bytes read */
@@ -138,8 +140,8 @@ struct NTD
 	void		(*trc)(struct CLB *,int, unsigned char *, size_t);
 
 	int		listen_fd;		/* Server's listen file descriptor */
-	fd_set		rs,ws,es;		/* select I/O sets */
-	int		max_fd;			/* largest fd - for select processing*/
+	int		epoll_fd;		/* epoll set of the listen fd and all open links */
+	uint4		listen_events;		/* events "listen_fd" is registered for in "epoll_fd" */
 	VSIG_ATOMIC_T	sigio_interrupt;
 	VSIG_ATOMIC_T	sigurg_interrupt;
 	/* for mutex processing - use mutex_set set to block.
@@ -193,7 +195,7 @@ cmi_status_t cmj_clb_reset_async(struct CLB *lnk);
 void cmj_err(struct CLB *lnk, cmi_reason_t reason, cmi_status_t status);
 void cmj_exception_interrupt(struct CLB *lnk, int signo);
 void cmj_fini(struct CLB *lnk);
-int cmj_firstone(fd_set *s, int n);
+cmi_status_t cmj_epoll_update(struct NTD *tsk, int fd, uint4 *events, uint4 add, uint4 remove);
 struct CLB *cmj_getdeferred(struct NTD *tsk);
 void cmj_handler(int signo, siginfo_t *info, void *context);
 void cmj_housekeeping(void);
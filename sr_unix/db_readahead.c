@@ -0,0 +1,186 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_fcntl.h"
+
+#include "min_max.h"
+
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "db_readahead.h"
+
+/* Sequential readahead for B-tree scans.
+ *
+ * A $ORDER/$QUERY loop, MUPIP EXTRACT or MUPIP REORG moves from a block to its right sibling through "gvcst_rtsib", which
+ * reads one block at a time. When that move had to go to disk, "gvcst_rtsib" calls "db_readahead" with the parent index
+ * block, which hints the OS (POSIX_FADV_WILLNEED) to start reading the blocks the next $ydb_readahead records of the parent
+ * point to. Subsequent moves then find their blocks in the file system cache instead of waiting for the disk. Hints are
+ * only given for children not already hinted, and only once less than half of the window ahead is hinted, so hints go
+ * out in batches. MUPIP INTEG, which walks private copies of the blocks, hints all children of each index block it reads
+ * through "db_readahead_index".
+ *
+ * The blocks are not read into the global buffers: that would need a buffer (and crit) per block for reads that may not
+ * be needed, while a hint is free to ignore.
+ */
+
+GBLREF	sgmnt_addrs	*cs_addrs;
+GBLREF	gd_region	*gv_cur_region;
+
+/* Collects in "blks" the children of at most "max" records of index block "base", starting with the record at offset
+ * "*offset" and stopping at offset "top". "*offset" is moved past the records looked at and "*nblks" is set to the number of
+ * children collected. Since the block may be read out of crit, records are checked only as much as needed to stay within
+ * the buffer, and children that cannot be index or data blocks are skipped. Returns the number of records looked at.
+ */
+static int db_readahead_gather(sm_uc_ptr_t base, uint4 *offset, uint4 top, block_id total_blks, block_id *blks, int max,
+		int *nblks)
+{
+	rec_hdr_ptr_t	rp;
+	unsigned short	rec_size;
+	block_id	blk;
+	uint4		off;
+	int		nrecs, n;
+
+	for (off = *offset, nrecs = n = 0; (nrecs < max) && ((off + BSTAR_REC_SIZE) <= top); nrecs++, off += rec_size)
+	{
+		rp = (rec_hdr_ptr_t)(base + off);
+		GET_USHORT(rec_size, &rp->rsiz);
+		if ((BSTAR_REC_SIZE > rec_size) || ((off + rec_size) > top))
+			break;
+		GET_BLK_ID(blk, (sm_uc_ptr_t)rp + rec_size - SIZEOF(block_id));
+		if ((0 < blk) && (blk < total_blks) && !IS_BITMAP_BLK(blk))
+			blks[n++] = blk;
+	}
+	*offset = off;
+	*nblks = n;
+	return nrecs;
+}
+
+/* Hints the OS to read the "nblks" blocks in "blks", coalescing runs of consecutive blocks into one hint.
+ * Returns the number of blocks hinted.
+ */
+static int db_readahead_issue(int fd, off_t blk0_off, int4 blk_size, block_id *blks, int nblks)
+{
+	int	i, j;
+
+	for (i = 0; i < nblks; i = j)
+	{
+		for (j = i + 1; (j < nblks) && (blks[j] == (blks[j - 1] + 1)); j++)
+			;
+		if (0 != posix_fadvise(fd, blk0_off + (off_t)blks[i] * blk_size, (off_t)(j - i) * blk_size, POSIX_FADV_WILLNEED))
+			return i;
+	}
+	return nblks;
+}
+
+/* "parent" is the index block in the history "gvcst_rtsib" just built, with "curr_rec" at the record of the block the scan
+ * moved to. Reads ahead the children of the records after it. Works on cs_addrs/gv_cur_region.
+ */
+void db_readahead(srch_blk_status *parent)
+{
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	node_local_ptr_t	cnl;
+	unix_db_info		*udi;
+	sm_uc_ptr_t		base;
+	rec_hdr_ptr_t		rp;
+	block_id		blks[DB_READAHEAD_MAX], *slot;
+	trans_num		tn;
+	unsigned short		rec_size;
+	uint4			off, top, window;
+	int			ahead, nblks, i;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	window = TREF(readahead_blks);
+	csa = cs_addrs;
+	csd = csa->hdr;
+	if (!window || (dba_bg != csd->acc_meth) || csa->now_crit)
+		return;
+	udi = FILE_INFO(gv_cur_region);
+	if (udi->fd_opened_with_o_direct)
+		return;		/* reads bypass the file system cache */
+	base = parent->buffaddr;
+	top = ((blk_hdr_ptr_t)base)->bsiz;
+	off = parent->curr_rec.offset;
+	if ((top > csd->blk_size) || ((off + SIZEOF(rec_hdr)) > top))
+		return;
+	tn = ((blk_hdr_ptr_t)base)->tn;
+	if ((parent->blk_num != csa->ra_parent) || (tn != csa->ra_parent_tn))
+	{
+		csa->ra_parent = parent->blk_num;
+		csa->ra_parent_tn = tn;
+		csa->ra_upto = 0;
+	}
+	/* Skip the record of the block the caller just read */
+	rp = (rec_hdr_ptr_t)(base + off);
+	GET_USHORT(rec_size, &rp->rsiz);
+	if (BSTAR_REC_SIZE > rec_size)
+		return;
+	off += rec_size;
+	/* Count the records after it whose children were already hinted; "blks" is just scratch space here */
+	ahead = db_readahead_gather(base, &off, MIN(csa->ra_upto, top), csa->ti->total_blks, blks, window, &nblks);
+	if ((2 * ahead) >= window)
+		return;
+	db_readahead_gather(base, &off, top, csa->ti->total_blks, blks, window - ahead, &nblks);
+	csa->ra_upto = off;
+	nblks = db_readahead_issue(udi->fd, BLK_ZERO_OFF(csd->start_vbn), csd->blk_size, blks, nblks);
+	if (!nblks)
+		return;
+	cnl = csa->nl;
+	INCR_GVSTATS_COUNTER(csa, cnl, n_readahead_blks, nblks);
+	for (i = 0; i < nblks; i++)
+	{
+		slot = &csa->ra_blks[csa->ra_next++ % DB_READAHEAD_MAX];
+		if (*slot)
+			INCR_GVSTATS_COUNTER(csa, cnl, n_readahead_miss, 1);
+		*slot = blks[i];
+	}
+}
+
+/* Called through DB_READAHEAD_DSK_READ when block "blk" of "csa" is read from disk. Counts a hit if it was read ahead. */
+void db_readahead_hit(sgmnt_addrs *csa, block_id blk)
+{
+	int	i;
+
+	if (IS_BITMAP_BLK(blk))
+		return;		/* never read ahead; also keeps block 0 from matching an unused slot */
+	for (i = 0; i < DB_READAHEAD_MAX; i++)
+	{
+		if (blk == csa->ra_blks[i])
+		{
+			csa->ra_blks[i] = 0;
+			INCR_GVSTATS_COUNTER(csa, csa->nl, n_readahead_hit, 1);
+			return;
+		}
+	}
+}
+
+/* Hints the OS to read all children of index block "base", a private copy that MUPIP INTEG is about to walk. "fd" is the
+ * database file and "blk0_off" the offset of block 0 in it.
+ */
+void db_readahead_index(int fd, off_t blk0_off, int4 blk_size, block_id total_blks, sm_uc_ptr_t base)
+{
+	block_id	blks[DB_READAHEAD_MAX];
+	uint4		off, top;
+	int		nblks;
+
+	top = MIN(((blk_hdr_ptr_t)base)->bsiz, blk_size);
+	for (off = SIZEOF(blk_hdr); 0 < db_readahead_gather(base, &off, top, total_blks, blks, DB_READAHEAD_MAX, &nblks); )
+		db_readahead_issue(fd, blk0_off, blk_size, blks, nblks);
+}
@@ -0,0 +1,30 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef DB_READAHEAD_H_INCLUDED
+#define DB_READAHEAD_H_INCLUDED
+
+/* Called by dsk_read for every block BG reads from disk. Lets "gvcst_rtsib" tell a scan that goes to disk from one that
+ * finds its blocks in the global buffers, and counts the reads of blocks that were read ahead.
+ */
+#define	DB_READAHEAD_DSK_READ(CSA, BLK)					\
+MBSTART {								\
+	(CSA)->ra_dsk_read++;						\
+	if ((CSA)->ra_next)						\
+		db_readahead_hit(CSA, BLK);				\
+} MBEND
+
+void	db_readahead(srch_blk_status *parent);
+void	db_readahead_hit(sgmnt_addrs *csa, block_id blk);
+void	db_readahead_index(int fd, off_t blk0_off, int4 blk_size, block_id total_blks, sm_uc_ptr_t base);
+
+#endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -50,6 +50,8 @@
 #include "tp.h"
 #include "cdb_sc.h"
 #include "mupip_reorg_encrypt.h"
+#include "db_readahead.h"
+#include "gds_blk_compress.h"
 
 GBLREF	gd_region		*gv_cur_region;
 GBLREF	sgmnt_addrs		*cs_addrs;
@@ -150,7 +152,10 @@ int4	dsk_read (block_id blk, sm_uc_ptr_t buff, enum db_ver *ondsk_blkver, boolea
 		buff_is_modified_after_lseekread = FALSE;
 	assert(NULL != cnl);
 	if (dba_mm != csd->acc_meth)
+	{
 		INCR_GVSTATS_COUNTER(csa, cnl, n_dsk_read, 1);
+		DB_READAHEAD_DSK_READ(csa, blk);
+	}
 	enc_save_buff = buff;
 	/* The value of MUPIP_REORG_IN_PROG_LOCAL_DSK_READ indicates that this is a direct call from mupip_reorg_encrypt, operating
 	 * on a local buffer.
@@ -215,6 +220,13 @@ int4	dsk_read (block_id blk, sm_uc_ptr_t buff, enum db_ver *ondsk_blkver, boolea
 		}
 		ENABLE_INTERRUPTS(INTRPT_IN_CRYPT_RECONFIG, prev_intrpt_state);
 	}
+	if (!blk_free && (0 == save_errno) && IS_BLK_COMPRESSED(buff))
+	{	/* Written compressed with MUPIP SET -COMPRESSION in effect. Compression and encryption do not go together */
+		buff_is_modified_after_lseekread = TRUE;
+		save_errno = gds_blk_uncompress(buff, size, FALSE);
+		if (0 == save_errno)
+			INCR_GVSTATS_COUNTER(csa, cnl, n_blk_uncmp_read, 1);
+	}
 	if (!blk_free && (0 == save_errno))
 	{	/* See if block needs to be converted to current version. Assuming buffer is at least short aligned */
 		assert(0 == (long)buff % 2);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -619,6 +619,7 @@ CONDITION_HANDLER(mu_cre_file_ch);
 CONDITION_HANDLER(mu_extract_handler);
 CONDITION_HANDLER(mu_extract_handler1);
 CONDITION_HANDLER(mu_extract_handler2);
+CONDITION_HANDLER(mu_extract_stream_handler);
 CONDITION_HANDLER(mu_rndwn_all_helper_ch);
 CONDITION_HANDLER(mu_rndwn_repl_instance_ch);
 CONDITION_HANDLER(mu_rndwn_replpool_ch);
@@ -0,0 +1,176 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_fcntl.h"
+#include "gtm_string.h"
+#include <errno.h>
+
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gdsdbver.h"
+#include "gtm_zlib.h"
+#include "gds_blk_compress.h"
+
+GBLREF	volatile int4		fast_lock_count;
+GBLREF	volatile int4		gtmMallocDepth;
+GBLREF	int4			ydb_zlib_cmp_level;
+GBLREF	volatile boolean_t	timer_in_handler;
+OS_PAGE_SIZE_DECLARE
+
+STATICDEF int		blk_cmp_state;		/* 0 if zlib not yet loaded, 1 if loaded, -1 if it could not be loaded */
+STATICDEF int		blk_cmp_level = ZLIB_CMPLVL_NONE;	/* level the compression stream is set up with */
+STATICDEF boolean_t	blk_cmp_in_use;		/* TRUE while a block is being compressed into "blk_cmp_buff" */
+STATICDEF sm_uc_ptr_t	blk_cmp_buff;		/* OS_PAGE_SIZE aligned (for O_DIRECT) part of "blk_cmp_buff_base" */
+STATICDEF sm_uc_ptr_t	blk_cmp_buff_base;
+STATICDEF int4		blk_cmp_buff_len;
+STATICDEF sm_uc_ptr_t	blk_uncmp_buff;
+STATICDEF int4		blk_uncmp_buff_len;
+
+/* Loads zlib (if not already loaded, e.g. for replication) the first time a block is compressed or uncompressed.
+ * Returns FALSE if zlib or the functions needed are not available. As this loads a library, do not call it in a timer handler.
+ */
+boolean_t gds_blk_cmp_init(void)
+{
+	int4	save_cmp_level;
+
+	if (!blk_cmp_state)
+	{
+		if ((NULL == zlib_compress_fnptr) || (NULL == zlib_uncompress_fnptr))
+		{	/* "gtm_zlib_init" is meant for replication and only expects to be called when $ydb_zlib_cmp_level is set */
+			save_cmp_level = ydb_zlib_cmp_level;
+			if (ZLIB_CMPLVL_NONE == save_cmp_level)
+				ydb_zlib_cmp_level = ZLIB_CMPLVL_MAX;
+			gtm_zlib_init();
+			if (ZLIB_CMPLVL_NONE == save_cmp_level)
+				ydb_zlib_cmp_level = ZLIB_CMPLVL_NONE;
+		}
+		blk_cmp_state = ((NULL != zlib_compress_fnptr) && gtm_zlib_uncmp_blk_init()) ? 1 : -1;
+	}
+	return (0 < blk_cmp_state);
+}
+
+/* Compresses block "bp" with zlib "level" into a process-private buffer that is returned, with "*size" set to the length to
+ * write, i.e. the length of the compressed block rounded up to "align" (a power of 2 dividing "blk_size") with the padding
+ * zeroed. Returns NULL if the block cannot be compressed or does not compress to less than its size.
+ */
+sm_uc_ptr_t gds_blk_compress(blk_hdr_ptr_t bp, int4 blk_size, int level, int align, int *size)
+{
+	blk_cmp_hdr	*cmp_hdr;
+	uLongf		cmp_len;
+	int		bsiz, cmp_size, rc;
+
+	bsiz = bp->bsiz;
+	assert((SIZEOF(blk_hdr) <= bsiz) && (bsiz <= blk_size));
+	/* The compressed block has to fit in "bsiz" so that code that copies "bsiz" bytes of a block on disk gets all of it */
+	if ((SIZEOF(blk_cmp_hdr) >= bsiz) || (bsiz > blk_size) || blk_cmp_in_use)
+		return NULL;	/* too small to gain anything, or a nested call from a timer handler */
+	if ((!blk_cmp_state && (timer_in_handler || gtmMallocDepth)) || !gds_blk_cmp_init())
+		return NULL;
+	/* Setting up the buffer or a new compression level allocates memory, so leave that to a write outside a timer handler */
+	if (timer_in_handler && ((blk_size > blk_cmp_buff_len) || (level != blk_cmp_level)))
+		return NULL;
+	if (level != blk_cmp_level)
+	{
+		if (!gtm_zlib_cmp_blk_init(level))
+			return NULL;
+		blk_cmp_level = level;
+	}
+	blk_cmp_in_use = TRUE;
+	if (blk_size > blk_cmp_buff_len)
+	{
+		assert(0 == gtmMallocDepth);	/* should not be in a nested free/malloc */
+		if (NULL != blk_cmp_buff_base)
+			free(blk_cmp_buff_base);	/* keep only the one for the largest block size */
+		blk_cmp_buff_base = malloc(blk_size + OS_PAGE_SIZE);
+		blk_cmp_buff = (sm_uc_ptr_t)ROUND_UP2((UINTPTR_T)blk_cmp_buff_base, OS_PAGE_SIZE);
+		blk_cmp_buff_len = blk_size;
+	}
+	cmp_hdr = (blk_cmp_hdr *)blk_cmp_buff;
+	cmp_len = bsiz - SIZEOF(blk_cmp_hdr);
+	rc = gtm_zlib_cmp_blk((Bytef *)(cmp_hdr + 1), &cmp_len, (Bytef *)(bp + 1), bsiz - SIZEOF(blk_hdr));
+	if (Z_OK != rc)
+	{	/* Z_BUF_ERROR if it does not fit in "bsiz" */
+		blk_cmp_in_use = FALSE;
+		return NULL;
+	}
+	cmp_hdr->hdr = *bp;
+	cmp_hdr->hdr.bver = BLK_CMP_VER;
+	cmp_hdr->cmp_len = (uint4)cmp_len;
+	cmp_hdr->filler = 0;
+	cmp_size = SIZEOF(blk_cmp_hdr) + (int)cmp_len;
+	*size = (int)ROUND_UP2(cmp_size, align);
+	assert(*size <= blk_size);
+	memset(blk_cmp_buff + cmp_size, 0, *size - cmp_size);
+	blk_cmp_in_use = FALSE;
+	return blk_cmp_buff;
+}
+
+/* Uncompresses in place block "buff" of a database with "blk_size" blocks, if it was read from disk compressed. "swapped" is
+ * TRUE if the block is in the other endianness (MUPIP ENDIANCVT), in which case it is left in that endianness.
+ * Returns 0 or EIO if the block cannot be uncompressed.
+ */
+int gds_blk_uncompress(sm_uc_ptr_t buff, int4 blk_size, boolean_t swapped)
+{
+	blk_cmp_hdr	*cmp_hdr;
+	uLongf		uncmp_len;
+	uint4		bsiz, cmp_len;
+	int		rc;
+
+	cmp_hdr = (blk_cmp_hdr *)buff;
+	bsiz = swapped ? GTM_BYTESWAP_32(cmp_hdr->hdr.bsiz) : cmp_hdr->hdr.bsiz;
+	cmp_len = swapped ? GTM_BYTESWAP_32(cmp_hdr->cmp_len) : cmp_hdr->cmp_len;
+	if ((SIZEOF(blk_cmp_hdr) >= bsiz) || (bsiz > blk_size) || ((bsiz - SIZEOF(blk_cmp_hdr)) < cmp_len))
+		return EIO;
+	if (!gds_blk_cmp_init())
+		return EIO;
+	if (blk_size > blk_uncmp_buff_len)
+	{
+		assert(0 == fast_lock_count);	/* this is mainline (non-interrupt) code */
+		++fast_lock_count;		/* No interrupts in free/malloc across this change */
+		if (NULL != blk_uncmp_buff)
+			free(blk_uncmp_buff);
+		blk_uncmp_buff = malloc(blk_size);
+		blk_uncmp_buff_len = blk_size;
+		--fast_lock_count;
+	}
+	uncmp_len = bsiz - SIZEOF(blk_hdr);
+	rc = gtm_zlib_uncmp_blk((Bytef *)blk_uncmp_buff, &uncmp_len, (Bytef *)(cmp_hdr + 1), cmp_len);
+	if ((Z_OK != rc) || ((bsiz - SIZEOF(blk_hdr)) != uncmp_len))
+		return EIO;
+	memcpy(buff + SIZEOF(blk_hdr), blk_uncmp_buff, uncmp_len);
+	((blk_hdr_ptr_t)buff)->bver = swapped ? GTM_BYTESWAP_16(GDSVCURR) : GDSVCURR;
+	return 0;
+}
+
+/* Returns TRUE if writing "cmp_size" bytes instead of "size" bytes at "offset" leaves at least one OS page to punch out */
+boolean_t gds_blk_cmp_saves(off_t offset, int cmp_size, int size)
+{
+	return (ROUND_UP2(offset + cmp_size, OS_PAGE_SIZE) < ROUND_UP2(offset + size, OS_PAGE_SIZE));
+}
+
+/* Gives the file system back the OS pages of block slot "offset" (of "blk_size" bytes) past the "size" bytes of the compressed
+ * block just written there. Pages shared with the next block are left alone. Errors (e.g. a file system that does not support
+ * holes) are ignored: the block is still valid, it just takes up the whole slot.
+ */
+void gds_blk_punch(int fd, off_t offset, int size, int4 blk_size)
+{
+#	ifdef FALLOC_FL_PUNCH_HOLE
+	off_t	start, end;
+
+	start = ROUND_UP2(offset + size, OS_PAGE_SIZE);
+	end = ROUND_DOWN2(offset + blk_size, OS_PAGE_SIZE);
+	if (start < end)
+		fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, start, end - start);
+#	endif
+}
@@ -0,0 +1,41 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef GDS_BLK_COMPRESS_H_INCLUDED
+#define GDS_BLK_COMPRESS_H_INCLUDED
+
+/* Database blocks written with MUPIP SET -COMPRESSION (csd->blk_compress) in effect are stored zlib compressed in their usual
+ * place in the file. The block header stays in the clear except for "bver", which is set to BLK_CMP_VER, and is followed by
+ * the length of the compressed records and then the compressed records. As the first 2 bytes of a V4 block are its size,
+ * which is at least SIZEOF(v15_blk_hdr), BLK_CMP_VER can be told apart from both V4 and V6 blocks. "levl", "bsiz" and "tn"
+ * are those of the uncompressed block so code that only looks at the header of a block on disk (e.g. incremental backup)
+ * need not know about compression. Blocks are uncompressed at the IO point (dsk_read, mu_int_read, MUPIP ENDIANCVT).
+ */
+#define	BLK_CMP_VER		((unsigned short)7)
+
+typedef struct blk_cmp_hdr_struct
+{
+	blk_hdr		hdr;		/* hdr.bver is BLK_CMP_VER, other fields are those of the uncompressed block */
+	uint4		cmp_len;	/* length of the compressed records that follow */
+	uint4		filler;
+} blk_cmp_hdr;
+
+#define	IS_BLK_COMPRESSED(BP)		(BLK_CMP_VER == ((blk_hdr_ptr_t)(BP))->bver)
+#define	IS_BLK_COMPRESSED_SWAPPED(BP)	(GTM_BYTESWAP_16(BLK_CMP_VER) == ((blk_hdr_ptr_t)(BP))->bver)
+
+boolean_t	gds_blk_cmp_init(void);
+sm_uc_ptr_t	gds_blk_compress(blk_hdr_ptr_t bp, int4 blk_size, int level, int align, int *size);
+int		gds_blk_uncompress(sm_uc_ptr_t buff, int4 blk_size, boolean_t swapped);
+boolean_t	gds_blk_cmp_saves(off_t offset, int cmp_size, int size);
+void		gds_blk_punch(int fd, off_t offset, int size, int4 blk_size);
+
+#endif
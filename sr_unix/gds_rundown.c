@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -278,13 +278,8 @@ int4 gds_rundown(boolean_t cleanup_udi)
 		rel_latch(&cnl->freeze_latch);
 	if (!csa->persistent_freeze)
 		region_freeze(reg, FALSE, FALSE, FALSE, FALSE, FALSE);
-	if (!csa->lock_crit_with_db && LOCK_CRIT_HELD(csa))
-	{
-		mlk_pvtctl	pctl;
-
-		MLK_PVTCTL_INIT(pctl, reg);
-		REL_LOCK_CRIT(pctl, FALSE);
-	}
+	if (!csa->lock_crit_with_db)
+		REL_HELD_LOCK_CRIT(reg);
 	if (!was_crit)
 	{
 		rel_crit(reg);		/* get locks to known state */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -65,6 +65,7 @@
 #include "db_write_eof_block.h"
 #include "interlock.h"
 #include "warn_db_sz.h"
+#include "gds_cbt.h"
 
 #define	GDSFILEXT_CLNUP						\
 MBSTART {							\
@@ -519,6 +520,7 @@ uint4	 gdsfilext(block_id blocks, block_id filesize, boolean_t trans_in_prog)
 	assert(0 < (int)blocks || (!cs_data->defer_allocate && (0 == new_blocks)));
 	assert(0 < (int)(cs_addrs->ti->free_blocks + blocks));
 	cs_addrs->ti->free_blocks += blocks;
+	gds_cbt_extend(cs_data, old_total, new_total);
 	cs_addrs->total_blks = cs_addrs->ti->total_blks = new_total;
 	blocks = old_total;
 	if (blocks / bplmap * bplmap != blocks)
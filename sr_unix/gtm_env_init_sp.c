@@ -3,7 +3,7 @@
  * Copyright (c) 2004-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -187,6 +187,9 @@ void	gtm_env_init_sp(void)
 	ydb_zlib_cmp_level = ydb_trans_numeric(YDBENVINDX_ZLIB_CMP_LEVEL, &is_defined, IGNORE_ERRORS_TRUE, NULL);
 	if (YDB_CMPLVL_OUT_OF_RANGE(ydb_zlib_cmp_level))
 		ydb_zlib_cmp_level = ZLIB_CMPLVL_MIN;	/* no compression in this case */
+	/* Whether a compressed replication pipe keeps one zlib stream across messages (if the other side supports it) */
+	ret = ydb_logical_truth_value(YDBENVINDX_REPL_CMP_STREAM, FALSE, &is_defined);
+	ydb_repl_cmp_stream = is_defined ? ret : TRUE;
 	/* Check for and and setup gtm_hupenable if specified */
 	hup_on = ydb_logical_truth_value(YDBENVINDX_HUPENABLE, FALSE, &is_defined);
 	ydb_principal_editing_defaults = 0;
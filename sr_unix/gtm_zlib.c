@@ -3,7 +3,7 @@
  * Copyright (c) 2008-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -37,6 +37,30 @@ error_def(ERR_TEXT);
 
 GBLREF char		ydb_dist[GTM_PATH_MAX];
 
+STATICDEF zlib_deflateinit_func_t	zlib_deflateinit_fnptr;
+STATICDEF zlib_stream_func_t		zlib_deflate_fnptr;
+STATICDEF zlib_stream_reset_func_t	zlib_deflatereset_fnptr;
+STATICDEF zlib_stream_reset_func_t	zlib_deflateend_fnptr;
+STATICDEF zlib_inflateinit_func_t	zlib_inflateinit_fnptr;
+STATICDEF zlib_stream_func_t		zlib_inflate_fnptr;
+STATICDEF zlib_stream_reset_func_t	zlib_inflatereset_fnptr;
+STATICDEF zlib_stream_reset_func_t	zlib_inflateend_fnptr;
+
+/* The compression (source server) and decompression (receiver server) streams of the replication pipe. They are reset at
+ * every compression handshake so both sides start with an empty history.
+ */
+STATICDEF z_stream	zlib_cmp_stream;
+STATICDEF int		zlib_cmp_stream_level = ZLIB_CMPLVL_NONE;	/* level "zlib_cmp_stream" was set up with, if any */
+STATICDEF z_stream	zlib_uncmp_stream;
+STATICDEF boolean_t	zlib_uncmp_stream_inited;
+/* The streams used to compress and uncompress database blocks (see gds_blk_compress.c). Unlike the replication streams, each
+ * block is a stream of its own; the streams are only kept so zlib does not allocate its state for every block.
+ */
+STATICDEF z_stream	zlib_blk_cmp_stream;
+STATICDEF int		zlib_blk_cmp_level = ZLIB_CMPLVL_NONE;	/* level "zlib_blk_cmp_stream" was set up with, if any */
+STATICDEF z_stream	zlib_blk_uncmp_stream;
+STATICDEF boolean_t	zlib_blk_uncmp_inited;
+
 void gtm_zlib_init(void)
 {
 	char		err_msg[MAX_ERRSTR_LEN];
@@ -53,6 +77,26 @@ void gtm_zlib_init(void)
 				(void **)&zlib_compress_fnptr,
 				(void **)&zlib_uncompress_fnptr,
 			};
+	char		*zlib_stream_fname[] = {
+				ZLIB_DEFLATEINIT_FNAME,
+				ZLIB_DEFLATE_FNAME,
+				ZLIB_DEFLATERESET_FNAME,
+				ZLIB_DEFLATEEND_FNAME,
+				ZLIB_INFLATEINIT_FNAME,
+				ZLIB_INFLATE_FNAME,
+				ZLIB_INFLATERESET_FNAME,
+				ZLIB_INFLATEEND_FNAME,
+			};
+	void		**zlib_stream_fptr[] = {
+				(void **)&zlib_deflateinit_fnptr,
+				(void **)&zlib_deflate_fnptr,
+				(void **)&zlib_deflatereset_fnptr,
+				(void **)&zlib_deflateend_fnptr,
+				(void **)&zlib_inflateinit_fnptr,
+				(void **)&zlib_inflate_fnptr,
+				(void **)&zlib_inflatereset_fnptr,
+				(void **)&zlib_inflateend_fnptr,
+			};
 	int		findx;
 	void		*fptr;
 	char 		librarypath[GTM_PATH_MAX], *lpath = NULL;
@@ -122,5 +166,231 @@ void gtm_zlib_init(void)
 		}
 		*zlib_fptr[findx] = fptr;
 	}
+	/* The stream functions are only an optimization so do not complain if this zlib lacks them */
+	for (findx = 0; findx < ZLIB_NUM_STREAM_DLSYMS; ++findx)
+	{
+		fptr = (void *)dlsym(handle, zlib_stream_fname[findx]);
+		if (NULL == fptr)
+		{
+			for (findx = 0; findx < ZLIB_NUM_STREAM_DLSYMS; ++findx)
+				*zlib_stream_fptr[findx] = NULL;
+			ydb_repl_cmp_stream = FALSE;
+			break;
+		}
+		*zlib_stream_fptr[findx] = fptr;
+	}
 	return;
 }
+
+/* Sets up (or resets, if already set up with the same "level") the process' compression stream. Returns FALSE if the
+ * stream functions are not available or zlib fails to set up the stream.
+ */
+boolean_t gtm_zlib_cmp_stream_init(int level)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	if (NULL == zlib_deflate_fnptr)
+		return FALSE;
+	/* Defer interrupts as zlib uses the system malloc/free (see comment before ZLIB_COMPRESS) */
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (level == zlib_cmp_stream_level)
+	{
+		rc = (*zlib_deflatereset_fnptr)(&zlib_cmp_stream);
+		if (Z_OK != rc)
+			(*zlib_deflateend_fnptr)(&zlib_cmp_stream);
+	} else
+	{
+		if (ZLIB_CMPLVL_NONE != zlib_cmp_stream_level)
+			(*zlib_deflateend_fnptr)(&zlib_cmp_stream);
+		memset(&zlib_cmp_stream, 0, SIZEOF(zlib_cmp_stream));	/* Z_NULL zalloc/zfree so zlib uses malloc/free */
+		rc = (*zlib_deflateinit_fnptr)(&zlib_cmp_stream, level, ZLIB_VERSION, (int)SIZEOF(z_stream));
+	}
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	zlib_cmp_stream_level = (Z_OK == rc) ? level : ZLIB_CMPLVL_NONE;
+	return (Z_OK == rc);
+}
+
+/* Compresses "source" into "dest" as the next part of the compression stream and flushes it to a byte boundary
+ * (Z_SYNC_FLUSH) so the receiver can decompress it as soon as it arrives. Later messages can refer to data in earlier
+ * ones, which is what makes this compress the small journal records of a transaction stream much better than compressing
+ * each message on its own. On input "*destLen" is the space available in "dest", on output it is the compressed length.
+ * Returns a zlib status like compress2(). After an error the stream is no longer usable until reset.
+ */
+int gtm_zlib_cmp_stream(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	assert(ZLIB_CMPLVL_NONE != zlib_cmp_stream_level);
+	zlib_cmp_stream.next_in = (Bytef *)source;
+	zlib_cmp_stream.avail_in = (uInt)sourceLen;
+	zlib_cmp_stream.next_out = dest;
+	zlib_cmp_stream.avail_out = (uInt)*destLen;
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	rc = (*zlib_deflate_fnptr)(&zlib_cmp_stream, Z_SYNC_FLUSH);
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	/* A flush that filled the output buffer might have more output pending, so treat that as insufficient space too */
+	if ((Z_OK == rc) && ((0 != zlib_cmp_stream.avail_in) || (0 == zlib_cmp_stream.avail_out)))
+		rc = Z_BUF_ERROR;
+	*destLen -= zlib_cmp_stream.avail_out;
+	return rc;
+}
+
+/* Sets up (or resets) the process' decompression stream. Returns FALSE if that is not possible. */
+boolean_t gtm_zlib_uncmp_stream_init(void)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	if (NULL == zlib_inflate_fnptr)
+		return FALSE;
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (zlib_uncmp_stream_inited)
+	{
+		rc = (*zlib_inflatereset_fnptr)(&zlib_uncmp_stream);
+		if (Z_OK != rc)
+			(*zlib_inflateend_fnptr)(&zlib_uncmp_stream);
+	} else
+	{
+		memset(&zlib_uncmp_stream, 0, SIZEOF(zlib_uncmp_stream));
+		rc = (*zlib_inflateinit_fnptr)(&zlib_uncmp_stream, ZLIB_VERSION, (int)SIZEOF(z_stream));
+	}
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	zlib_uncmp_stream_inited = (Z_OK == rc);
+	return zlib_uncmp_stream_inited;
+}
+
+/* Decompresses one message produced by "gtm_zlib_cmp_stream" on the other side. On input "*destLen" is the space
+ * available in "dest", on output it is the decompressed length. Returns a zlib status like uncompress().
+ */
+int gtm_zlib_uncmp_stream(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+{
+	int		rc;
+	Bytef		spare;
+	uLong		avail;
+	intrpt_state_t	prev_intrpt_state;
+
+	assert(zlib_uncmp_stream_inited);
+	zlib_uncmp_stream.next_in = (Bytef *)source;
+	zlib_uncmp_stream.avail_in = (uInt)sourceLen;
+	zlib_uncmp_stream.next_out = dest;
+	zlib_uncmp_stream.avail_out = (uInt)*destLen;
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	rc = (*zlib_inflate_fnptr)(&zlib_uncmp_stream, Z_SYNC_FLUSH);
+	avail = zlib_uncmp_stream.avail_out;
+	if (((Z_OK == rc) || (Z_BUF_ERROR == rc)) && (0 != zlib_uncmp_stream.avail_in) && (0 == avail))
+	{	/* The data exactly filled "dest" but inflate stopped short of the flush marker at the end of the input. Let it
+		 * consume that with room for one more byte, which it must not need.
+		 */
+		zlib_uncmp_stream.next_out = &spare;
+		zlib_uncmp_stream.avail_out = 1;
+		rc = (*zlib_inflate_fnptr)(&zlib_uncmp_stream, Z_SYNC_FLUSH);
+		if (0 == zlib_uncmp_stream.avail_out)
+			rc = Z_BUF_ERROR;
+	}
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (Z_STREAM_END == rc)
+		rc = Z_DATA_ERROR;	/* The source server never ends the stream */
+	else if ((Z_OK == rc) && (0 != zlib_uncmp_stream.avail_in))
+		rc = Z_BUF_ERROR;
+	*destLen -= avail;
+	return rc;
+}
+
+/* Sets up the process' block compression stream with "level" (which needs zlib to allocate memory). Returns FALSE if the
+ * stream functions are not available or zlib fails to set up the stream.
+ */
+boolean_t gtm_zlib_cmp_blk_init(int level)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	if (NULL == zlib_deflate_fnptr)
+		return FALSE;
+	if (level == zlib_blk_cmp_level)
+		return TRUE;
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (ZLIB_CMPLVL_NONE != zlib_blk_cmp_level)
+		(*zlib_deflateend_fnptr)(&zlib_blk_cmp_stream);
+	memset(&zlib_blk_cmp_stream, 0, SIZEOF(zlib_blk_cmp_stream));
+	rc = (*zlib_deflateinit_fnptr)(&zlib_blk_cmp_stream, level, ZLIB_VERSION, (int)SIZEOF(z_stream));
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	zlib_blk_cmp_level = (Z_OK == rc) ? level : ZLIB_CMPLVL_NONE;
+	return (Z_OK == rc);
+}
+
+/* Compresses "source" into "dest" on its own, like compress2(), with the stream "gtm_zlib_cmp_blk_init" set up. As the
+ * stream is only reset, zlib allocates no memory so this can be used in a timer handler. On input "*destLen" is the space
+ * available in "dest", on output it is the compressed length. Returns a zlib status like compress2().
+ */
+int gtm_zlib_cmp_blk(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	assert(ZLIB_CMPLVL_NONE != zlib_blk_cmp_level);
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	rc = (*zlib_deflatereset_fnptr)(&zlib_blk_cmp_stream);
+	if (Z_OK == rc)
+	{
+		zlib_blk_cmp_stream.next_in = (Bytef *)source;
+		zlib_blk_cmp_stream.avail_in = (uInt)sourceLen;
+		zlib_blk_cmp_stream.next_out = dest;
+		zlib_blk_cmp_stream.avail_out = (uInt)*destLen;
+		rc = (*zlib_deflate_fnptr)(&zlib_blk_cmp_stream, Z_FINISH);
+	}
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (Z_STREAM_END == rc)
+		rc = Z_OK;
+	else if (Z_OK == rc)
+		rc = Z_BUF_ERROR;	/* ran out of room in "dest" before the end of the stream */
+	*destLen = zlib_blk_cmp_stream.total_out;
+	return rc;
+}
+
+/* Sets up the process' block decompression stream. Returns FALSE if that is not possible. */
+boolean_t gtm_zlib_uncmp_blk_init(void)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	if (NULL == zlib_inflate_fnptr)
+		return FALSE;
+	if (zlib_blk_uncmp_inited)
+		return TRUE;
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	memset(&zlib_blk_uncmp_stream, 0, SIZEOF(zlib_blk_uncmp_stream));
+	rc = (*zlib_inflateinit_fnptr)(&zlib_blk_uncmp_stream, ZLIB_VERSION, (int)SIZEOF(z_stream));
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	zlib_blk_uncmp_inited = (Z_OK == rc);
+	return zlib_blk_uncmp_inited;
+}
+
+/* Decompresses a block compressed by "gtm_zlib_cmp_blk". On input "*destLen" is the space available in "dest", on output it
+ * is the decompressed length. Returns a zlib status like uncompress().
+ */
+int gtm_zlib_uncmp_blk(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+{
+	int		rc;
+	intrpt_state_t	prev_intrpt_state;
+
+	assert(zlib_blk_uncmp_inited);
+	DEFER_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	rc = (*zlib_inflatereset_fnptr)(&zlib_blk_uncmp_stream);
+	if (Z_OK == rc)
+	{
+		zlib_blk_uncmp_stream.next_in = (Bytef *)source;
+		zlib_blk_uncmp_stream.avail_in = (uInt)sourceLen;
+		zlib_blk_uncmp_stream.next_out = dest;
+		zlib_blk_uncmp_stream.avail_out = (uInt)*destLen;
+		rc = (*zlib_inflate_fnptr)(&zlib_blk_uncmp_stream, Z_FINISH);
+	}
+	ENABLE_INTERRUPTS(INTRPT_IN_ZLIB_CMP_UNCMP, prev_intrpt_state);
+	if (Z_STREAM_END == rc)
+		rc = Z_OK;
+	else if (Z_OK == rc)
+		rc = Z_BUF_ERROR;
+	*destLen = zlib_blk_uncmp_stream.total_out;
+	return rc;
+}
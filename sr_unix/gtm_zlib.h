@@ -3,7 +3,7 @@
  * Copyright (c) 2008-2016 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -39,6 +39,10 @@
 typedef int	(*zlib_cmp_func_t)(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level);
 typedef	int	(*zlib_uncmp_func_t)(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
 typedef	uLong	(*zlib_cmpbound_func_t)(uLong sourceLen);
+typedef	int	(*zlib_deflateinit_func_t)(z_streamp strm, int level, const char *version, int stream_size);
+typedef	int	(*zlib_inflateinit_func_t)(z_streamp strm, const char *version, int stream_size);
+typedef	int	(*zlib_stream_func_t)(z_streamp strm, int flush);
+typedef	int	(*zlib_stream_reset_func_t)(z_streamp strm);
 
 GBLREF	zlib_cmp_func_t		zlib_compress_fnptr;
 GBLREF	zlib_uncmp_func_t	zlib_uncompress_fnptr;
@@ -64,8 +68,24 @@ GBLREF	zlib_uncmp_func_t	zlib_uncompress_fnptr;
 
 #define	ZLIB_NUM_DLSYMS		2	/* number of function names that we need to dlsym (compress2 and uncompress) */
 
+/* Functions needed to keep a compression stream across replication messages (see gtm_zlib_cmp_stream). These are optional;
+ * if any of them is missing, each message is compressed on its own as before.
+ */
+#define	ZLIB_DEFLATEINIT_FNAME		"deflateInit_"
+#define	ZLIB_DEFLATE_FNAME		"deflate"
+#define	ZLIB_DEFLATERESET_FNAME		"deflateReset"
+#define	ZLIB_DEFLATEEND_FNAME		"deflateEnd"
+#define	ZLIB_INFLATEINIT_FNAME		"inflateInit_"
+#define	ZLIB_INFLATE_FNAME		"inflate"
+#define	ZLIB_INFLATERESET_FNAME		"inflateReset"
+#define	ZLIB_INFLATEEND_FNAME		"inflateEnd"
+
+#define	ZLIB_NUM_STREAM_DLSYMS	8
+
 GBLREF	int4			ydb_zlib_cmp_level;	/* zlib compression level specified at process startup */
 GBLREF	int4			repl_zlib_cmp_level;	/* zlib compression level currently in use in replication pipe */
+GBLREF	boolean_t		ydb_repl_cmp_stream;	/* whether to negotiate stream compression of the replication pipe */
+GBLREF	boolean_t		repl_zlib_cmp_stream;	/* whether the replication pipe currently uses stream compression */
 
 #define	ZLIB_CMPLVL_MIN		0
 #define	ZLIB_CMPLVL_MAX		9	/* although currently known max zlib compression level is 9, it could be higher in
@@ -74,7 +94,15 @@ GBLREF	int4			repl_zlib_cmp_level;	/* zlib compression level currently in use in
 
 #define	YDB_CMPLVL_OUT_OF_RANGE(x)	(ZLIB_CMPLVL_MIN > x)
 
-void gtm_zlib_init(void);
+void		gtm_zlib_init(void);
+boolean_t	gtm_zlib_cmp_stream_init(int level);
+int		gtm_zlib_cmp_stream(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
+boolean_t	gtm_zlib_uncmp_stream_init(void);
+int		gtm_zlib_uncmp_stream(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
+boolean_t	gtm_zlib_cmp_blk_init(int level);
+int		gtm_zlib_cmp_blk(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
+boolean_t	gtm_zlib_uncmp_blk_init(void);
+int		gtm_zlib_uncmp_blk(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
 
 /* Macros for zlib compress2 and uncompress function calls. Since 'malloc' or 'free' inside zlib library does NOT go
  * through gtm_malloc or gtm_free respectively, defer signals (MUPIP STOP for instance) until the corresponding zlib
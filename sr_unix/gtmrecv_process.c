@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -782,6 +782,7 @@ STATICFNDEF int gtmrecv_est_conn(void)
 	remote_side->jnl_ver = 0;
 	/* re-determine compression level on the replication pipe after every connection establishment */
 	repl_zlib_cmp_level = ZLIB_CMPLVL_NONE;
+	repl_zlib_cmp_stream = FALSE;
 	/* Reset prior connection related state variables (see <C9J02_003091_receiver_server_assert_due_to_lingering_XOFF>) */
 	xoff_sent = FALSE;
 	xoff_msg_log_cnt = 0;
@@ -1641,7 +1642,11 @@ STATICFNDEF void process_tr_buff(int msg_type)
 			uncmpfail = TRUE;
 		} else
 		{
-			ZLIB_UNCOMPRESS(gtmrecv_uncmpmsgp, destlen, gtmrecv_cmpmsgp, gtmrecv_repl_cmpmsglen, cmpret);
+			if (repl_zlib_cmp_stream)
+				cmpret = gtm_zlib_uncmp_stream((Bytef *)gtmrecv_uncmpmsgp, &destlen, (Bytef *)gtmrecv_cmpmsgp,
+								gtmrecv_repl_cmpmsglen);
+			else
+				ZLIB_UNCOMPRESS(gtmrecv_uncmpmsgp, destlen, gtmrecv_cmpmsgp, gtmrecv_repl_cmpmsglen, cmpret);
 			GTM_WHITE_BOX_TEST(WBTEST_REPL_TR_UNCMP_ERROR, cmpret, Z_DATA_ERROR);
 			recv_jnl_seqno = recvpool_ctl->jnl_seqno;
 			switch(cmpret)
@@ -3215,6 +3220,8 @@ STATICFNDEF void do_main_loop(boolean_t crash_restart)
 					{
 						repl_log(gtmrecv_log_fp, TRUE, TRUE, "Received REPL_CMP_TEST message\n");
 						uncmpfail = FALSE;
+						repl_zlib_cmp_stream = FALSE;
+						cmpsolve_msg.cmp_stream = FALSE;
 						if (ZLIB_CMPLVL_NONE == ydb_zlib_cmp_level)
 						{	/* Receiver does not have compression enabled in the first place.
 							 * Send dummy REPL_CMP_SOLVE response message.
@@ -3296,6 +3303,15 @@ STATICFNDEF void do_main_loop(boolean_t crash_restart)
 						{
 							cmpsolve_msg.datalen = REPL_RCVR_CMP_TEST_FAIL;
 							repl_log(gtmrecv_log_fp, TRUE, TRUE, GTM_ZLIB_UNCMPTRANSITION_STR);
+						} else if (ydb_repl_cmp_stream && cmptest_msg->cmp_stream
+								&& (REPL_PROTO_VER_STREAM_CMP <= cmptest_msg->proto_ver))
+						{	/* The source server wants to compress the pipe as one stream. Agree to it
+							 * if we can start a fresh decompression stream to match its fresh one.
+							 */
+							cmpsolve_msg.cmp_stream = gtm_zlib_uncmp_stream_init();
+							if (cmpsolve_msg.cmp_stream)
+								repl_log(gtmrecv_log_fp, TRUE, TRUE, "Decompressing the "
+									"replication pipe as one stream\n");
 						}
 						if (remote_side->cross_endian)
 							cmpsolve_msg.datalen = GTM_BYTESWAP_32(cmpsolve_msg.datalen);
@@ -3313,7 +3329,10 @@ STATICFNDEF void do_main_loop(boolean_t crash_restart)
 						if (repl_connection_reset || gtmrecv_wait_for_jnl_seqno)
 							return;
 						if (!uncmpfail)
+						{
 							repl_zlib_cmp_level = ydb_zlib_cmp_level;
+							repl_zlib_cmp_stream = cmpsolve_msg.cmp_stream;
+						}
 					}
 					break;
 
@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -1354,6 +1354,7 @@ int gtmsource_process(void)
 		 * previously sent a REPL_CMP2UNCMP message.
 		 */
 		gtmsource_local->repl_zlib_cmp_level = repl_zlib_cmp_level = ZLIB_CMPLVL_NONE;	/* no compression by default */
+		repl_zlib_cmp_stream = FALSE;
 		if (!gtmsource_received_cmp2uncmp_msg && (ZLIB_CMPLVL_NONE != ydb_zlib_cmp_level))
 		{
 			if (REPL_PROTO_VER_MULTISITE_CMP <= remote_side->proto_ver)
@@ -1684,8 +1685,12 @@ int gtmsource_process(void)
 									? REPL_MSG_HDRLEN : REPL_MSG_HDRLEN2;
 						cmpbuflen = gtmsource_cmpmsgbufsiz - msghdrlen;
 						cmpbufptr = ((Bytef *)gtmsource_cmpmsgp) + msghdrlen;
-						ZLIB_COMPRESS(cmpbufptr, cmpbuflen, send_msgp, send_tr_len,
-								repl_zlib_cmp_level, cmpret);
+						if (repl_zlib_cmp_stream)
+							cmpret = gtm_zlib_cmp_stream(cmpbufptr, &cmpbuflen, (Bytef *)send_msgp,
+											send_tr_len);
+						else
+							ZLIB_COMPRESS(cmpbufptr, cmpbuflen, send_msgp, send_tr_len,
+									repl_zlib_cmp_level, cmpret);
 						BREAK_IF_CMP_ERROR(cmpret, send_tr_len); /* Note: break stmt. inside the macro */
 						if (Z_OK == cmpret)
 						{	/* Send compressed buffer */
@@ -1701,6 +1706,7 @@ int gtmsource_process(void)
 						{	/* Send normal buffer */
 							repl_log(gtmsource_log_fp, TRUE, FALSE, "Defaulting to NO compression\n");
 							repl_zlib_cmp_level = ZLIB_CMPLVL_NONE;	/* no compression */
+							repl_zlib_cmp_stream = FALSE;
 							gtmsource_local->repl_zlib_cmp_level = repl_zlib_cmp_level;
 						}
 
@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -349,6 +349,7 @@ int gtmsource_est_conn()
 	repl_log_conn_info(gtmsource_sock_fd, gtmsource_log_fp, FALSE);
 	/* re-determine compression level on the replication pipe after every connection establishment */
 	gtmsource_local->repl_zlib_cmp_level = repl_zlib_cmp_level = ZLIB_CMPLVL_NONE;
+	repl_zlib_cmp_stream = FALSE;
 	/* reset any CMP2UNCMP messages received in prior connections. Once a connection encounters a REPL_CMP2UNCMP message
 	 * all further replication on that connection will be uncompressed.
 	 */
@@ -1265,7 +1266,9 @@ static	boolean_t	gtmsource_repl_recv(repl_msg_ptr_t msg, int4 msglen, int4 msgty
 /* Given that the source server was started with compression enabled, this function checks if the receiver server was
  * also started with the decompression enabled and if so sends a compressed test message. The receiver server responds back
  * whether it is successfully able to decompress that or not. If yes, compression is enabled on the replication pipe and
- * the input parameter "*repl_zlib_cmp_level_ptr" is set to the compression level used.
+ * the input parameter "*repl_zlib_cmp_level_ptr" is set to the compression level used. The test message also asks the
+ * receiver server whether it can decompress the pipe as one stream; if both sides can, "repl_zlib_cmp_stream" is set
+ * to TRUE and both sides start with a freshly reset stream.
  */
 boolean_t	gtmsource_get_cmp_info(int4 *repl_zlib_cmp_level_ptr)
 {
@@ -1283,6 +1286,8 @@ boolean_t	gtmsource_get_cmp_info(int4 *repl_zlib_cmp_level_ptr)
 	test_msg.type = REPL_CMP_TEST;
 	test_msg.len = REPL_MSG_CMPINFOLEN;
 	test_msg.proto_ver = REPL_PROTO_VER_THIS;
+	repl_zlib_cmp_stream = FALSE;
+	test_msg.cmp_stream = ydb_repl_cmp_stream && gtm_zlib_cmp_stream_init(ydb_zlib_cmp_level);
 	/* Fill in test data with random data. The data will be a sequence of bytes from 0 to 255. The start point though
 	 * is randomly chosen using the process_id. If it is 253, the resulting sequence would be 253, 254, 255, 0, 1, 2, ...
 	 */
@@ -1372,6 +1377,11 @@ boolean_t	gtmsource_get_cmp_info(int4 *repl_zlib_cmp_level_ptr)
 		repl_log(gtmsource_log_fp, TRUE, FALSE, "Receiver server was able to decompress successfully\n");
 		*repl_zlib_cmp_level_ptr = ydb_zlib_cmp_level;
 		repl_log(gtmsource_log_fp, TRUE, FALSE, "Using zlib compression level %d for replication\n", ydb_zlib_cmp_level);
+		/* An older receiver server does not know about (and does not initialize) solve_msg.cmp_stream */
+		repl_zlib_cmp_stream = test_msg.cmp_stream && (REPL_PROTO_VER_STREAM_CMP <= solve_msg.proto_ver)
+						&& solve_msg.cmp_stream;
+		if (repl_zlib_cmp_stream)
+			repl_log(gtmsource_log_fp, TRUE, FALSE, "Compressing the replication pipe as one stream\n");
 	} else
 	{
 		repl_log(gtmsource_log_fp, TRUE, FALSE, "Receiver server could not decompress successfully\n");
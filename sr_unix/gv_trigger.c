@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -117,6 +117,11 @@ STATICFNDCL	uint4		gvtr_process_pattern(char *ptr, uint4 len, gvtr_subs_t *subsd
 STATICFNDCL	uint4		gvtr_process_gvsubs(char *start, char *end, gvtr_subs_t *subsdsc,
 						    boolean_t colon_imbalance, gv_namehead *gvt);
 STATICFNDCL	boolean_t	gvtr_is_key_a_match(char *keysub_start[], gv_trigger_t *trigdsc, mval *lvvalarray[]);
+STATICFNDCL	int		gvtr_dispatch_subs_cmp(char *key1, uint4 len1, char *key2, uint4 len2);
+STATICFNDCL	int		gvtr_dispatch_ent_cmp(const void *ent1, const void *ent2);
+STATICFNDCL	gvtr_dispatch_t	*gvtr_dispatch_build(gvt_trigger_t *gvt_trigger, gv_trigger_t *trigstart, int trig_list_offset);
+STATICFNDCL	int		gvtr_dispatch_candidates(gvtr_dispatch_t *dispatch, char *thissub, uint4 thissublen,
+							 gv_trigger_t **cands);
 
 #define TRIGGER_SUBSDEF(SUBSTYPE, SUBSNAME, LITMVALNAME, TRIGFILEQUAL, PARTOFHASH)	LITREF mval LITMVALNAME;
 #include "trigger_subs_def.h"
@@ -777,6 +782,7 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 	gvt_trigger->gv_trigger_cycle = 0;
 	gvt_trigger->gv_trig_array = NULL;
 	gvt_trigger->gv_trig_list = NULL;
+	gvt_trigger->set_dispatch = gvt_trigger->kill_dispatch = gvt_trigger->ztrig_dispatch = NULL;
 	/* Set gvt->gvt_trigger to this malloced memory (after gv_trig_array has been initialized to NULL to avoid garbage
 	 * values). If we encounter an error below, we will remember to free this up the next time we are in this function
 	 */
@@ -1152,6 +1158,14 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 		}
 	}
 	gvt_trigger->gv_trig_top = trigdsc;	/* Very top of the array */
+	/* Build a dispatch index for each queue that has enough triggers to make a scan of the entire queue on every update
+	 * expensive. The index lives in the gv_trig_list buddy list so gvtr_free() releases it along with everything else.
+	 */
+	gvt_trigger->set_dispatch = gvtr_dispatch_build(gvt_trigger, gvt_trigger->set_triglist, OFFSETOF(gv_trigger_t, next_set));
+	gvt_trigger->kill_dispatch = gvtr_dispatch_build(gvt_trigger, gvt_trigger->kill_triglist,
+								OFFSETOF(gv_trigger_t, next_kill));
+	gvt_trigger->ztrig_dispatch = gvtr_dispatch_build(gvt_trigger, gvt_trigger->ztrig_triglist,
+								OFFSETOF(gv_trigger_t, next_ztrig));
 #	ifdef DEBUG	/* Verify that the queues are well built */
 	{
 		cntset = cntkill = cntztrig = 0;
@@ -1295,6 +1309,184 @@ STATICFNDEF	boolean_t	gvtr_is_key_a_match(char *keysub_start[], gv_trigger_t *tr
 	return TRUE;
 }
 
+/* Compares two subscripts in internal format the same way gvtr_is_key_a_match() does (memcmp, then length) */
+STATICFNDEF	int	gvtr_dispatch_subs_cmp(char *key1, uint4 len1, char *key2, uint4 len2)
+{
+	int	cmpres;
+
+	cmpres = memcmp(key1, key2, MIN(len1, len2));
+	if (0 != cmpres)
+		return cmpres;
+	return (len1 < len2) ? -1 : ((len1 > len2) ? 1 : 0);
+}
+
+/* qsort() callback to order dispatch entries by lower bound. An open lower bound sorts before everything else. */
+STATICFNDEF	int	gvtr_dispatch_ent_cmp(const void *ent1, const void *ent2)
+{
+	gvtr_dispatch_ent_t	*e1, *e2;
+
+	e1 = (gvtr_dispatch_ent_t *)ent1;
+	e2 = (gvtr_dispatch_ent_t *)ent2;
+	if (GVTR_RANGE_OPEN_LEN == e1->len1)
+		return (GVTR_RANGE_OPEN_LEN == e2->len1) ? 0 : -1;
+	if (GVTR_RANGE_OPEN_LEN == e2->len1)
+		return 1;
+	return gvtr_dispatch_subs_cmp(e1->key1, e1->len1, e2->key1, e2->len1);
+}
+
+/* Builds the dispatch index for one command type queue (circular list starting at "trigstart" and linked at offset
+ * "trig_list_offset"). Every POINT or RANGE element of the first subscript of a trigger becomes one interval entry.
+ * Triggers whose first subscript includes a "*" or a pattern go into the "general" list. Triggers with no subscripts
+ * are left out since they only match the unsubscripted node and gvtr_match_n_invoke() scans the queue for that.
+ * Returns NULL if the queue is too short or has nothing that can be indexed.
+ */
+STATICFNDEF	gvtr_dispatch_t	*gvtr_dispatch_build(gvt_trigger_t *gvt_trigger, gv_trigger_t *trigstart, int trig_list_offset)
+{
+	gv_trigger_t		*trigdsc, *trigstop, **general;
+	gvtr_subs_t		*subsdsc;
+	gvtr_dispatch_t		*dispatch;
+	gvtr_dispatch_ent_t	*ents, *ent, *maxhi_ent;
+	uint4			numtrigs, num_general, num_ents, numelems, idx, maxhi_idx;
+	boolean_t		is_general;
+	size_t			size;
+
+	/* First pass : count the triggers on the queue and the entries needed to index them */
+	numtrigs = num_general = num_ents = 0;
+	trigstop = NULL;
+	for (trigdsc = trigstart; (NULL != trigdsc) && (trigdsc != trigstop);
+	     trigdsc = *(gv_trigger_t **)((char *)trigdsc + trig_list_offset))
+	{
+		trigstop = trigstart;
+		numtrigs++;
+		if (!trigdsc->numsubs)
+			continue;
+		is_general = FALSE;
+		for (numelems = 0, subsdsc = trigdsc->subsarray; NULL != subsdsc; subsdsc = subsdsc->gvtr_subs_range.next_range)
+		{
+			if ((GVTR_SUBS_POINT != subsdsc->gvtr_subs_type) && (GVTR_SUBS_RANGE != subsdsc->gvtr_subs_type))
+			{
+				is_general = TRUE;
+				break;
+			}
+			numelems++;
+		}
+		if (is_general)
+			num_general++;
+		else
+			num_ents += numelems;
+	}
+	if ((GVTR_DISPATCH_MIN_TRIGGERS > numtrigs) || !num_ents)
+		return NULL;
+	size = SIZEOF(gvtr_dispatch_t) + (num_general * SIZEOF(gv_trigger_t *)) + (num_ents * SIZEOF(gvtr_dispatch_ent_t));
+	dispatch = (gvtr_dispatch_t *)get_new_element(gvt_trigger->gv_trig_list, DIVIDE_ROUND_UP(size, GVTR_LIST_ELE_SIZE));
+	general = (gv_trigger_t **)(dispatch + 1);
+	ents = (gvtr_dispatch_ent_t *)(general + num_general);
+	dispatch->num_general = num_general;
+	dispatch->num_ents = num_ents;
+	dispatch->rotate = 0;
+	dispatch->general = general;
+	dispatch->ents = ents;
+	/* Second pass : fill in the entries */
+	ent = ents;
+	trigstop = NULL;
+	for (trigdsc = trigstart; (NULL != trigdsc) && (trigdsc != trigstop);
+	     trigdsc = *(gv_trigger_t **)((char *)trigdsc + trig_list_offset))
+	{
+		trigstop = trigstart;
+		if (!trigdsc->numsubs)
+			continue;
+		for (subsdsc = trigdsc->subsarray; NULL != subsdsc; subsdsc = subsdsc->gvtr_subs_range.next_range)
+		{
+			if ((GVTR_SUBS_POINT != subsdsc->gvtr_subs_type) && (GVTR_SUBS_RANGE != subsdsc->gvtr_subs_type))
+				break;
+		}
+		if (NULL != subsdsc)
+		{
+			*general++ = trigdsc;
+			continue;
+		}
+		for (subsdsc = trigdsc->subsarray; NULL != subsdsc; subsdsc = subsdsc->gvtr_subs_range.next_range, ent++)
+		{
+			if (GVTR_SUBS_POINT == subsdsc->gvtr_subs_type)
+			{
+				ent->key1 = ent->key2 = subsdsc->gvtr_subs_point.subs_key;
+				ent->len1 = ent->len2 = subsdsc->gvtr_subs_point.len;
+			} else
+			{
+				ent->key1 = subsdsc->gvtr_subs_range.subs_key1;
+				ent->len1 = subsdsc->gvtr_subs_range.len1;
+				ent->key2 = subsdsc->gvtr_subs_range.subs_key2;
+				ent->len2 = subsdsc->gvtr_subs_range.len2;
+			}
+			ent->trigdsc = trigdsc;
+		}
+	}
+	assert(ent == ents + num_ents);
+	assert(general == dispatch->general + num_general);
+	qsort(ents, num_ents, SIZEOF(gvtr_dispatch_ent_t), gvtr_dispatch_ent_cmp);
+	/* Note down, for each entry, which entry at or before it reaches the highest. This lets a lookup stop walking
+	 * backwards from the last entry whose lower bound is <= the key as soon as no earlier entry can reach the key.
+	 */
+	for (idx = 0, maxhi_idx = 0; idx < num_ents; idx++)
+	{
+		ent = &ents[idx];
+		maxhi_ent = &ents[maxhi_idx];
+		if ((GVTR_RANGE_OPEN_LEN != maxhi_ent->len2) && ((GVTR_RANGE_OPEN_LEN == ent->len2)
+				|| (0 < gvtr_dispatch_subs_cmp(ent->key2, ent->len2, maxhi_ent->key2, maxhi_ent->len2))))
+			maxhi_idx = idx;
+		ent->maxhi_idx = maxhi_idx;
+	}
+	return dispatch;
+}
+
+/* Fills "cands" with the triggers from "dispatch" whose first subscript could match "thissub". Each trigger appears at most
+ * once. Candidates still need to go through gvtr_is_key_a_match(). Returns the # of candidates or -1 if there are more than
+ * GVTR_DISPATCH_MAX_CANDIDATES, in which case the caller scans the entire queue instead.
+ */
+STATICFNDEF	int	gvtr_dispatch_candidates(gvtr_dispatch_t *dispatch, char *thissub, uint4 thissublen, gv_trigger_t **cands)
+{
+	gvtr_dispatch_ent_t	*ents, *ent;
+	gv_trigger_t		*trigdsc;
+	uint4			lo, hi, mid;
+	int			idx, cand, numcands;
+
+	ents = dispatch->ents;
+	/* Binary search for the # of entries whose lower bound is <= thissub */
+	lo = 0;
+	hi = dispatch->num_ents;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		ent = &ents[mid];
+		if ((GVTR_RANGE_OPEN_LEN == ent->len1) || (0 >= gvtr_dispatch_subs_cmp(ent->key1, ent->len1, thissub, thissublen)))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	numcands = 0;
+	for (idx = (int)lo - 1; 0 <= idx; idx--)
+	{
+		ent = &ents[ents[idx].maxhi_idx];
+		if ((GVTR_RANGE_OPEN_LEN != ent->len2) && (0 > gvtr_dispatch_subs_cmp(ent->key2, ent->len2, thissub, thissublen)))
+			break;	/* no entry at or before this one reaches thissub */
+		ent = &ents[idx];
+		if ((GVTR_RANGE_OPEN_LEN != ent->len2) && (0 > gvtr_dispatch_subs_cmp(ent->key2, ent->len2, thissub, thissublen)))
+			continue;
+		trigdsc = ent->trigdsc;
+		for (cand = 0; (cand < numcands) && (cands[cand] != trigdsc); cand++)
+			;
+		if (cand < numcands)
+			continue;	/* another element of the same trigger already matched */
+		if (GVTR_DISPATCH_MAX_CANDIDATES <= numcands)
+			return -1;
+		cands[numcands++] = trigdsc;
+	}
+	if ((GVTR_DISPATCH_MAX_CANDIDATES - numcands) < dispatch->num_general)
+		return -1;
+	memcpy(&cands[numcands], dispatch->general, dispatch->num_general * SIZEOF(gv_trigger_t *));
+	return numcands + dispatch->num_general;
+}
+
 void	gvtr_free(gv_namehead *gvt)
 {
 	gvt_trigger_t		*gvt_trigger;
@@ -1490,15 +1682,18 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 	mval			tmpmval;
 	unsigned char		util_buff[MAX_TRIG_UTIL_LEN];
 	int4			util_len;
-#	ifdef DEBUG
+	gvtr_dispatch_t		*dispatch;
+	gv_trigger_t		*cands[GVTR_DISPATCH_MAX_CANDIDATES];
+	int			numcands, candidx, candstart;
 	sgmnt_addrs		*csa;
+#	ifdef DEBUG
 	sgmnt_data_ptr_t	csd;
 	sgm_info		*si;
 	gv_namehead		*save_targ;
 	int			lcl_gtm_trigger_depth;
 #	endif
 
-	DEBUG_ONLY(csa = cs_addrs);
+	csa = cs_addrs;
 	DEBUG_ONLY(csd = cs_data);
 	DEBUG_ONLY(si = sgm_info_ptr);
 	DEBUG_ONLY(save_targ = gv_target);
@@ -1581,12 +1776,30 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 	{	/* Chose the kill command list to process */
 		SELECT_AND_RANDOMIZE_TRIGGER_CHAIN(gvt_trigger, trigstart, trig_list_offset, kill);
 	}
-
+	/* If the chosen list has a dispatch index, only look at the triggers whose first subscript could match this key.
+	 * Start at a different candidate each time to keep the invocation order unpredictable like the list rotation above.
+	 */
+	dispatch = is_set_trigger ? gvt_trigger->set_dispatch
+		: (is_ztrig_trigger ? gvt_trigger->ztrig_dispatch : gvt_trigger->kill_dispatch);
+	numcands = -1;
+	candidx = candstart = 0;
+	if ((NULL != dispatch) && keysubs)
+	{
+		numcands = gvtr_dispatch_candidates(dispatch, keysub_start[0], UINTCAST(keysub_start[1] - keysub_start[0]), cands);
+		if (0 < numcands)
+		{
+			candstart = dispatch->rotate++ % numcands;
+			trigstart = cands[candstart];
+		} else if (0 == numcands)
+			trigstart = NULL;
+	}
 	trigmax = gvt_trigger->num_gv_triggers;
 	trigstop = NULL;			/* So we can get through the first iteration */
 	for (trigdsc = trigstart;
 	     (NULL != trigdsc) && (trigdsc != trigstop);
-	     --trigmax, trigdsc = *(gv_trigger_t **)((char *)trigdsc + trig_list_offset))	/* Follow the designated list */
+	     --trigmax, trigdsc = (0 > numcands)
+		? *(gv_trigger_t **)((char *)trigdsc + trig_list_offset)		/* Follow the designated list */
+		: ((++candidx < numcands) ? cands[(candstart + candidx) % numcands] : NULL))	/* or the candidates */
 	{
 		DBGTRIGR((stderr, "gvtr_match_n_invoke: top of trigr scan loop (%d)\n", trigmax));
 		trigstop = trigstart;		/* Stop when we get back to where we started */
@@ -1602,6 +1815,7 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 		 * gvcst_put/gvcst_kill to be reset by the nested invocation.
 		 */
 		assert(INVALID_GV_TARGET == reset_gv_target);
+		INCR_GVSTATS_COUNTER(csa, csa->nl, n_trig_eval, 1);
 		if ((keysubs == trigdsc->numsubs) && (!keysubs || gvtr_is_key_a_match(keysub_start, trigdsc, lvvalarray)))
 		{
 			/* Note: lvvalarray could be updated above in case any trigger patterns
@@ -1686,6 +1900,7 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 				/* note: the above call may update trigparms->ztvalue_new for SET type triggers */
 				assert(lcl_gtm_trigger_depth == gtm_trigger_depth);
 				num_triggers_invoked++;
+				INCR_GVSTATS_COUNTER(csa, csa->nl, n_trig_fired, 1);
 				ztupd_mval->mvtype = 0;	/* so stp_gcol -if invoked somehow - can free up any space
 							 * currently occupied by this no-longer-necessary mval */
 				assert((0 == gtm_trig_status) || (ERR_TPRETRY == gtm_trig_status));
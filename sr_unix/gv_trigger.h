@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -47,6 +47,9 @@ typedef enum
 #define	GVTR_LIST_ELE_SIZE	8	/* size of each element in gv_trig_list buddy list (see comment in gv_trigger.c) */
 #define	GV_TRIG_LIST_INIT_ALLOC	256	/* we anticipate 256 bytes to be used by each trigger so start the buddy list there */
 
+#define	GVTR_DISPATCH_MIN_TRIGGERS	8	/* a command type queue needs at least this many triggers to get a dispatch index */
+#define	GVTR_DISPATCH_MAX_CANDIDATES	64	/* if a key maps to more candidates than this, scan the whole queue instead */
+
 #define MAX_TRIG_UTIL_LEN 	40	/* needed for storing the trigger index and the property (CMD, TRIGNAME.. etc.)
 					 * in util_buff to be passed as the last parameter for TRIGDEFBAD error message.
 					 * Both the index and the property name are guaranteed to be less than 20
@@ -140,6 +143,34 @@ typedef struct gv_trigger_struct
 					 * additional lookup */
 } gv_trigger_t;
 
+/* One entry in a dispatch index. Describes one POINT or RANGE element of the first-subscript specification of a trigger.
+ * A POINT is stored as the closed interval [subs_key, subs_key]. An open side of a RANGE has length GVTR_RANGE_OPEN_LEN.
+ */
+typedef struct gvtr_dispatch_ent_struct
+{
+	char		*key1;		/* lower bound of the first subscript (in internal subscript format) */
+	char		*key2;		/* upper bound of the first subscript (in internal subscript format) */
+	uint4		len1;		/* length of key1 or GVTR_RANGE_OPEN_LEN if the interval has no lower bound */
+	uint4		len2;		/* length of key2 or GVTR_RANGE_OPEN_LEN if the interval has no upper bound */
+	uint4		maxhi_idx;	/* index of the entry with the highest upper bound among entries 0 thru this one */
+	uint4		filler_8byte_align;
+	gv_trigger_t	*trigdsc;	/* trigger this entry belongs to */
+} gvtr_dispatch_ent_t;
+
+/* Dispatch index for one command type queue of a global. Built by gvtr_db_read_hasht() when the queue is long enough and
+ * used by gvtr_match_n_invoke() to check only those triggers whose first subscript could match the updated key. Triggers
+ * whose first subscript specification includes a "*" or a pattern cannot be indexed and are always candidates.
+ */
+typedef struct gvtr_dispatch_struct
+{
+	uint4			num_general;	/* # of triggers in "general" */
+	uint4			num_ents;	/* # of entries in "ents" */
+	uint4			rotate;		/* bumped on every lookup to randomize the order in which candidates are invoked */
+	uint4			filler_8byte_align;
+	gv_trigger_t		**general;	/* triggers that are candidates for every subscripted key */
+	gvtr_dispatch_ent_t	*ents;		/* POINT and RANGE entries sorted by lower bound */
+} gvtr_dispatch_t;
+
 /* Structure describing ALL triggers for a given global variable name */
 typedef struct gvt_trigger_struct
 {
@@ -152,6 +183,9 @@ typedef struct gvt_trigger_struct
 	gv_trigger_t			*gv_trig_top;		/* top of the array of triggers */
 	struct buddy_list_struct	*gv_trig_list;		/* buddy list that maintains mallocs done inside gv_trig_array */
 	gv_trigger_t			*gv_trig_array;		/* array of triggers read in from ^#t(<gbl>,...) */
+	gvtr_dispatch_t			*set_dispatch;		/* dispatch index for set_triglist (NULL if none) */
+	gvtr_dispatch_t			*kill_dispatch;		/* dispatch index for kill_triglist (NULL if none) */
+	gvtr_dispatch_t			*ztrig_dispatch;	/* dispatch index for ztrig_triglist (NULL if none) */
 } gvt_trigger_t;
 
 /* Structure describing parameters passed (from gvcst_put/gvcst_kill) to trigger invocation routine */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -101,6 +101,7 @@
 #include "tp_change_reg.h"
 #include "mu_gv_cur_reg_init.h"
 #include "mlkdef.h"
+#include "gds_cbt.h"
 
 #define REQRUNDOWN_TEXT		"semid is invalid but shmid is valid or at least one of sem_ctime or shm_ctime are non-zero"
 #define MAX_ACCESS_SEM_RETRIES	2	/* see comment below where this macro is used for why it needs to be 2 */
@@ -1428,6 +1429,7 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 				PRINT_CRASH_MESSAGE(0, csd, ERR_TEXT, 2,
 					LEN_AND_LIT("machine name in file header is non-null implying possible crash"));
 			}
+			CBT_INVALIDATE(csd);	/* blocks on disk may have been updated after the maps were last flushed */
 		}
 		if (is_bg)
 		{
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -16,6 +16,7 @@
 #include "mdef.h"
 
 #include "gtm_unistd.h"
+#include "gtm_fcntl.h"
 #include "gtm_stat.h"
 #include "gtm_stdio.h"
 #include "gtm_string.h"
@@ -231,6 +232,11 @@ short	iorm_open(io_log_name *dev_name, mval *pp, int fd, mval *mspace, uint8 tim
 			/* Note that for /proc files, statbuf.st_size is 0. We should not incorrectly set $ZEOF=1 in that case. */
 			if ((size == statbuf.st_size) && size)
 				iod->dollar.zeof = TRUE;
+			/* READs of a regular file are mostly front to back; let the OS read ahead more aggressively. A failure
+			 * only loses the hint.
+			 */
+			if (S_ISREG(statbuf.st_mode))
+				posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
 		} else
 		{
 			pipe_buff_size = fpathconf(fd, _PC_PIPE_BUF);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -133,7 +133,7 @@ void iorm_readfl_badchar(mval *vmvalptr, int datalen, int delimlen, unsigned cha
 int	iorm_readfl (mval *v, int4 width, uint8 nsec_timeout) /* timeout in nanoseconds */
 {
 	boolean_t	ret, timed, utf_active, line_term_seen = FALSE, rdone = FALSE, zint_restart;
-	char		inchar, *temp, *temp_start;
+	char		inchar, *temp, *temp_start, *chunk_ptr, *chunk_nl;
 	unsigned char	*nextmb, *char_ptr, *char_start, *buffer_start;
 	int		flags = 0;
 	int		len;
@@ -159,6 +159,7 @@ int	iorm_readfl (mval *v, int4 width, uint8 nsec_timeout) /* timeout in nanoseco
 	int		do_clearerr = FALSE;
 	int		saved_lastop;
 	int             min_bytes_to_copy;
+	int4		chunk_span;
 	ABS_TIME	cur_time, end_time, current_time, time_left;
 	pipe_interrupt	*pipeintr;
 	mv_stent	*mv_zintdev;
@@ -773,6 +774,28 @@ int	iorm_readfl (mval *v, int4 width, uint8 nsec_timeout) /* timeout in nanoseco
 						  "rm_ptr->tot_bytes_in_buffer: %d\n",
 						  status, bytes2read, rm_ptr->start_pos,
 						  rm_ptr->tot_bytes_in_buffer); DEBUGPIPEFLUSH);
+				if (!rdone && (0 <= status) && (rm_ptr->start_pos < rm_ptr->tot_bytes_in_buffer))
+				{	/* Move the bytes before the next terminator in one go rather than a byte per pass.
+					 * The terminator itself, if any, is handled below.
+					 */
+					chunk_ptr = rm_ptr->tmp_buffer + rm_ptr->start_pos;
+					chunk_span = MIN(rm_ptr->tot_bytes_in_buffer - rm_ptr->start_pos, width - bytes_count);
+					if (NULL != (chunk_nl = memchr(chunk_ptr, NATIVE_NL, chunk_span)))
+						chunk_span = (int4)(chunk_nl - chunk_ptr);
+					if (0 < chunk_span)
+					{
+						memcpy(temp, chunk_ptr, chunk_span);
+						temp += chunk_span;
+						rm_ptr->start_pos += chunk_span;
+						rm_ptr->file_pos += chunk_span;
+						bytes_read += chunk_span;
+						tot_bytes_read += chunk_span;
+						bytes_count += chunk_span;
+						status = 1;	/* as if the last byte went through the loop below */
+						if (bytes_count >= width)
+							break;
+					}
+				}
 				/* If it is a pipe and at least one character is read, a timer with timer_id
 				   will be started.  It is canceled later in this routine if not expired
 				   prior to return */
@@ -3,7 +3,7 @@
  * Copyright (c) 2014-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -174,6 +174,17 @@ void	iosocket_tls(mval *optionmval, int4 msec_timeout, mval *tlsid, mval *passwo
 				LEN_AND_LIT("but TLS already enabled"));
 			return;
 		}
+		if (0 < socketptr->obuffer_length)
+		{	/* plain text buffered ($ydb_socket_wbuffer) before the handshake goes out first */
+			iosocket_flush(iod);
+			if (0 < socketptr->obuffer_length)
+			{	/* flush failed and set $DEVICE */
+				if (NO_M_TIMEOUT != (msec_timeout * (uint8)NANOSECS_IN_MSEC))
+					dollar_truth = FALSE;
+				REVERT_GTMIO_CH(&iod->pair, ch_set);
+				return;
+			}
+		}
 		assertpro((0 >= socketptr->buffered_length) && (0 >= socketptr->obuffer_length));
 		if (NULL == tls_ctx)
 		{	/* first use of TLS in process */
@@ -340,12 +351,7 @@ void	iosocket_tls(mval *optionmval, int4 msec_timeout, mval *tlsid, mval *passwo
 			}
 		} while ((GTMTLS_WANT_READ == status) || (GTMTLS_WANT_WRITE == status));
 		/* turn on output buffering */
-		if (0 == socketptr->obuffer_size)
-			socketptr->obuffer_size = socketptr->buffer_size;
-		socketptr->obuffer_length = socketptr->obuffer_offset = 0;
-		socketptr->obuffer_wait_time = DEFAULT_WRITE_WAIT;
-		socketptr->obuffer_flush_time = DEFAULT_WRITE_WAIT * 2;	/* until add device parameter */
-		socketptr->obuffer = malloc(socketptr->obuffer_size);
+		SOCKET_OBUFFER_INIT(socketptr, socketptr->buffer_size);
 	} else if (tlsopt_renegotiate == option)
 	{
 		if (!socketptr->tlsenabled)
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -16,6 +16,11 @@
 #include "mdef.h"
 
 #include "gtm_unistd.h"
+#include "gtm_time.h"
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
 
 #include "gdsroot.h"
 #include "gtm_facility.h"
@@ -39,6 +44,8 @@
 #include "gtmsecshr.h"		/* for continue_proc */
 #include "anticipatory_freeze.h"
 #include "wbox_test_init.h"
+#include "sleep.h"
+#include "min_max.h"
 #ifdef DEBUG
 #include "gt_timer.h"
 #include "gtm_stdio.h"
@@ -52,6 +59,17 @@ error_def(ERR_JNLFSYNCERR);
 error_def(ERR_JNLFSYNCLSTCK);
 error_def(ERR_TEXT);
 
+#define	JNL_FSYNC_DELAY_STEP	100	/* usecs between two checks of jb->dskaddr while the fsync leader waits for more data */
+
+STATICFNDCL void jnl_fsync_wait(jnl_buffer_ptr_t jb, uint4 fsync_addr, uint4 lcnt);
+STATICFNDCL void jnl_fsync_wake(jnl_buffer_ptr_t jb);
+
+/* Journal fsyncs are group commits. The process that gets jb->fsync_in_prog_latch (the leader) syncs the journal file up to
+ * jb->dskaddr which covers every record written so far, not just its own. Processes that find the latch held (followers)
+ * sleep on jb->fsync_dskaddr (a futex on Linux) and are woken as soon as the leader advances it instead of polling at
+ * millisecond granularity. Most followers then find their records already synced and return without doing an fsync.
+ */
+
 void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 {
 	jnl_private_control	*jpc;
@@ -62,7 +80,12 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 	int4			lck_state;
 	int			fsync_ret, save_errno;
 	intrpt_state_t		prev_intrpt_state;
+	uint4			delay, waited;
+	gtm_uint64_t		fsync_start;
 	DEBUG_ONLY(uint4	onln_rlbk_pid;)
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
 
 	csa = &FILE_INFO(reg)->s_addrs;
 	jpc = csa->jnl;
@@ -71,6 +94,17 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 	if ((NOJNL != jpc->channel) && !JNL_FILE_SWITCHED(jpc))
 	{
 		csd = csa->hdr;
+		if ((delay = TREF(jnl_fsync_delay)) && !jpc->sync_io && !csa->now_crit && !CURRENT_JNL_FSYNC_WRITER(jb))
+		{	/* No fsync is in progress. Give concurrent committers whose records are being written a chance to be
+			 * covered by the fsync we are about to do. Stop waiting as soon as everything reserved so far is on disk
+			 * or somebody else did our fsync. Wait before getting jb->fsync_in_prog_latch so the wait neither holds
+			 * up other fsyncs nor runs with interrupts deferred. Never wait while holding crit as that would hold up
+			 * all updates to the region.
+			 */
+			for (waited = 0; (waited < delay) && (fsync_addr > jb->fsync_dskaddr) && (jb->dskaddr < jb->rsrv_freeaddr)
+					&& !JNL_FILE_SWITCHED(jpc); waited += JNL_FSYNC_DELAY_STEP)
+				SLEEP_USEC(JNL_FSYNC_DELAY_STEP, FALSE);
+		}
 		for (lcnt = 1; fsync_addr > jb->fsync_dskaddr && !JNL_FILE_SWITCHED(jpc); lcnt++)
 		{	/* should use a mutex */
 			if (0 == (lcnt % FSYNC_WAIT_HALF_TIME))
@@ -101,7 +135,7 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 				DEFER_INTERRUPTS(INTRPT_IN_JNL_FSYNC, prev_intrpt_state);
 				break;
 			}
-			wcs_sleep(lcnt);
+			jnl_fsync_wait(jb, fsync_addr, lcnt);
 			/* trying to wake up the lock holder one iteration before calling c_script */
 			if ((lcnt % FSYNC_WAIT_HALF_TIME) == (FSYNC_WAIT_HALF_TIME - 1))
 				performCASLatchCheck(&jb->fsync_in_prog_latch, TRUE);
@@ -135,6 +169,7 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 				DEBUG_ONLY(onln_rlbk_pid = csa->nl->onln_rlbk_pid);
 				assert(jgbl.onlnrlbk || !onln_rlbk_pid || !is_proc_alive(onln_rlbk_pid, 0)
 						|| (onln_rlbk_pid != csa->nl->in_crit));
+				fsync_start = GVSTATS_HIST_START(csa);
 				GTM_JNL_FSYNC(csa, jpc->channel, fsync_ret);
 				GTM_WHITE_BOX_TEST(WBTEST_FSYNC_SYSCALL_FAIL, fsync_ret, -1);
 				WBTEST_ASSIGN_ONLY(WBTEST_FSYNC_SYSCALL_FAIL, errno, EIO);
@@ -143,6 +178,7 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 					save_errno = errno;
 					assert(WBTEST_ENABLED(WBTEST_FSYNC_SYSCALL_FAIL));
 					RELEASE_SWAPLOCK(&jb->fsync_in_prog_latch);
+					jnl_fsync_wake(jb);
 					ENABLE_INTERRUPTS(INTRPT_IN_JNL_FSYNC, prev_intrpt_state);
 					send_msg_csa(CSA_ARG(csa) VARLSTCNT(9) ERR_JNLFSYNCERR, 2, JNL_LEN_STR(csd),
 						ERR_TEXT, 2, RTS_ERROR_TEXT("Error with fsync"), save_errno);
@@ -152,15 +188,59 @@ void jnl_fsync(gd_region *reg, uint4 fsync_addr)
 				{
 					jb->fsync_dskaddr = saved_dsk_addr;
 					BG_TRACE_PRO_ANY(csa, n_jnl_fsyncs);
+					GVSTATS_HIST_ADD(csa, csa->nl, h_jnl_fsync, fsync_start);
 				}
 			}
 		}
 		if (process_id == CURRENT_JNL_FSYNC_WRITER(jb))
 		{
 			RELEASE_SWAPLOCK(&jb->fsync_in_prog_latch);
+			jnl_fsync_wake(jb);
 			ENABLE_INTERRUPTS(INTRPT_IN_JNL_FSYNC, prev_intrpt_state);
 		}
 	}
 	assert(process_id != CURRENT_JNL_FSYNC_WRITER(jb));
 	return;
 }
+
+/* Waits for the current fsync leader to advance jb->fsync_dskaddr (or release jb->fsync_in_prog_latch). The wait is bounded
+ * by the same MIN(lcnt, MAXSLPTIME) milliseconds "wcs_sleep" would have slept so a leader that dies (or a lost wakeup)
+ * only costs what polling did.
+ */
+STATICFNDEF void jnl_fsync_wait(jnl_buffer_ptr_t jb, uint4 fsync_addr, uint4 lcnt)
+{
+#	if defined(__linux__) && defined(SYS_futex)
+	struct timespec		ts;
+	uint4			dskaddr, msec;
+
+	msec = MIN(lcnt, MAXSLPTIME);
+	ts.tv_sec = 0;
+	ts.tv_nsec = msec * NANOSECS_IN_MSEC;
+	INTERLOCK_ADD(&jb->fsync_waiters, 1);
+	dskaddr = jb->fsync_dskaddr;
+	SHM_READ_MEMORY_BARRIER;
+	/* Sleep only if the leader has not done our fsync yet. The kernel rechecks that jb->fsync_dskaddr is still "dskaddr"
+	 * before sleeping so a wakeup issued after the above read is not lost.
+	 */
+	if ((fsync_addr > dskaddr) && CURRENT_JNL_FSYNC_WRITER(jb))
+		syscall(SYS_futex, &jb->fsync_dskaddr, FUTEX_WAIT, dskaddr, &ts, NULL, 0);
+	INTERLOCK_ADD(&jb->fsync_waiters, -1);
+#	else
+	wcs_sleep(lcnt);
+#	endif
+}
+
+/* Called by the fsync leader after it releases jb->fsync_in_prog_latch to wake up all followers. The leader has already
+ * advanced jb->fsync_dskaddr (unless the fsync failed) so they either return or compete for the latch to do the next fsync.
+ */
+STATICFNDEF void jnl_fsync_wake(jnl_buffer_ptr_t jb)
+{
+#	if defined(__linux__) && defined(SYS_futex)
+	/* The interlocked read of jb->fsync_waiters is a full barrier between the caller's store of jb->fsync_dskaddr and
+	 * the read of jb->fsync_waiters. Without it the read could be done first and miss a follower that registered and
+	 * saw the old jb->fsync_dskaddr in between, leaving that follower asleep until its timeout.
+	 */
+	if (0 < INTERLOCK_ADD(&jb->fsync_waiters, 0))
+		syscall(SYS_futex, &jb->fsync_dskaddr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#	endif
+}
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -58,6 +58,12 @@ enum
 					 */
 };
 
+/* Flags that can be passed to ydb_cursor_open_s()/ydb_cursor_open_st() */
+enum
+{
+	YDB_CURSOR_SNAPSHOT = 1,	/* Cursor reads are part of (and validated with) the TP transaction it is opened in */
+};
+
 /* Enumerated languages - Used in ydb_lang_init() so we know what language our main routine is in (and which wrapper in use) */
 enum
 {	/* Note these need to be specifically enumerated so they have correct values when pulled into the Go wrapper's
@@ -297,6 +303,19 @@ typedef struct
 	char		*buf_addr;
 } ydb_buffer_t;
 
+/* Structure describing one node for the batched simple API calls (ydb_get_many_s()/ydb_set_many_s() and their
+ * SimpleThreadAPI counterparts). "value" is where ydb_get_many_s() returns the value of the node and where
+ * ydb_set_many_s() takes the value to set. "status" is set to YDB_OK or the error code for this node.
+ */
+typedef struct
+{
+	ydb_buffer_t	varname;
+	int		subs_used;
+	ydb_buffer_t	*subsarray;
+	ydb_buffer_t	value;
+	int		status;
+} ydb_node_t;
+
 typedef intptr_t	ydb_tid_t;		/* Timer id */
 typedef void		*ydb_fileid_ptr_t;
 
@@ -394,9 +413,14 @@ int	ydb_timer_start_t(uint64_t tptoken, ydb_buffer_t *errstr, intptr_t timer_id,
 					ydb_funcptr_retvoid_t handler, unsigned int hdata_len, void *hdata);
 
 /* Simple API routine declarations */
+int	ydb_cursor_close_s(uint64_t cursor);
+int	ydb_cursor_next_s(uint64_t cursor, int *ret_count, ydb_node_t *ret_nodes);
+int	ydb_cursor_open_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, unsigned int flags,
+			uint64_t *ret_cursor);
 int	ydb_data_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, unsigned int *ret_value);
 int	ydb_delete_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int deltype);
 int	ydb_delete_excl_s(int namecount, const ydb_buffer_t *varnames);
+int	ydb_get_many_s(int count, ydb_node_t *nodes);
 int	ydb_get_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
 int	ydb_incr_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *increment, ydb_buffer_t *ret_value);
 int	ydb_lock_s(unsigned long long timeout_nsec, int namecount, ...);
@@ -407,6 +431,7 @@ int	ydb_node_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer
 			ydb_buffer_t *ret_subsarray);
 int	ydb_node_previous_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int *ret_subs_used,
 			ydb_buffer_t *ret_subsarray);
+int	ydb_set_many_s(int count, ydb_node_t *nodes);
 int	ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value);
 int	ydb_str2zwr_s(const ydb_buffer_t *str, ydb_buffer_t *zwr);
 int	ydb_subscript_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
@@ -417,11 +442,16 @@ int	ydb_zwr2str_s(const ydb_buffer_t *zwr, ydb_buffer_t *str);
 /* SimpleAPI via thread interface (aka threaded Simple API).
  * Currently only one main thread runs the YottaDB engine. Once YottaDB itself is multi-threaded, we can support more threads.
  */
+int	ydb_cursor_close_st(uint64_t tptoken, ydb_buffer_t *errstr, uint64_t cursor);
+int	ydb_cursor_next_st(uint64_t tptoken, ydb_buffer_t *errstr, uint64_t cursor, int *ret_count, ydb_node_t *ret_nodes);
+int	ydb_cursor_open_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used,
+			const ydb_buffer_t *subsarray, unsigned int flags, uint64_t *ret_cursor);
 int	ydb_data_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			unsigned int *ret_value);
 int	ydb_delete_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			int deltype);
 int	ydb_delete_excl_st(uint64_t tptoken, ydb_buffer_t *errstr, int namecount, const ydb_buffer_t *varnames);
+int	ydb_get_many_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, ydb_node_t *nodes);
 int	ydb_get_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			ydb_buffer_t *ret_value);
 int	ydb_incr_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
@@ -435,6 +465,7 @@ int	ydb_node_next_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
 int	ydb_node_previous_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
+int	ydb_set_many_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, ydb_node_t *nodes);
 int	ydb_set_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			const ydb_buffer_t *value);
 int	ydb_str2zwr_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *str, ydb_buffer_t *zwr);
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -392,8 +392,11 @@ MBSTART {														\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_INVSVN);					\
 			if (UPDATE && !svn_data[iNDX].can_set)								\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_SVNOSET);					\
-			/* ISV usages are valid only if caller is "ydb_get_s" or "ydb_set_s". Else issue error. */	\
-			if ((LYDB_RTN_GET != LYDB_RTN_NAME) && (LYDB_RTN_SET != LYDB_RTN_NAME))				\
+			/* ISV usages are valid only if caller is "ydb_get_s"/"ydb_set_s" or their "_many" variants.	\
+			 * Else issue error.										\
+			 */												\
+			if ((LYDB_RTN_GET != LYDB_RTN_NAME) && (LYDB_RTN_SET != LYDB_RTN_NAME)				\
+				&& (LYDB_RTN_GET_MANY != LYDB_RTN_NAME) && (LYDB_RTN_SET_MANY != LYDB_RTN_NAME))	\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_ISVUNSUPPORTED, 4,				\
 					(VARNAMEP)->len_used, (VARNAMEP)->buf_addr,					\
 					LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NAME)));					\
@@ -637,6 +640,22 @@ MBSTART	{													\
 		TAREF1(sapi_mstrs_for_gc_ary, (TREF(sapi_mstrs_for_gc_indx))++) = MSTRP;			\
 } MBEND
 
+/* Macro to compute the hash of the global name in VARNAME (for "op_gvname_fast") if VARTYPE is LYDB_VARREF_GLOBAL.
+ * Requires hashtab_mname.h.
+ */
+#define SAPI_GVNAME_HASH(VARNAME, VARTYPE, HASH_CODE)								\
+MBSTART	{													\
+	mstr	gvnamestr;											\
+														\
+	HASH_CODE = 0;												\
+	if (LYDB_VARREF_GLOBAL == (VARTYPE))									\
+	{													\
+		gvnamestr.addr = (VARNAME)->buf_addr + 1;	/* Point past '^' to var name */			\
+		gvnamestr.len = (VARNAME)->len_used - 1;							\
+		COMPUTE_HASH_MSTR(gvnamestr, HASH_CODE);							\
+	}													\
+} MBEND
+
 /* Macro to determine if the simple API environment is active. The check is to see if the top stack frame is
  * a call-in base frame. This is the normal state for the simple API while the normal state (while in the
  * runtime) for call-ins will have an executable frame on top. Care must be taken in the use of this macro
@@ -917,9 +936,33 @@ MBSTART	{														\
 	}														\
 } MBEND
 
+/* A cursor opened by "ydb_cursor_open_s". It walks the nodes of a global (or a subtree of it) in collation order and
+ * remembers its position as the database key of the last node returned so "ydb_cursor_next_s" resumes from there
+ * without the caller having to pass (and the runtime having to rebuild) the previous node.
+ */
+typedef struct sapi_cursor_struct
+{
+	struct sapi_cursor_struct	*next;		/* next cursor in TREF(sapi_cursor_list) */
+	gtm_uint64_t			id;		/* handle returned to the caller */
+	char				name[MAX_MIDENT_LEN];	/* global name (without the '^') */
+	int				name_len;
+	int				hash_code;	/* hash of "name" for "op_gvname_fast" */
+	int				prefix_len;	/* # of leading bytes of "key" all nodes of the cursor share */
+	boolean_t			started;	/* TRUE once a node has been returned (so "key" has been returned) */
+	boolean_t			at_end;		/* TRUE once all nodes have been returned */
+	boolean_t			snapshot;	/* TRUE if opened with YDB_CURSOR_SNAPSHOT */
+	gtm_uint64_t			tstart_tn;	/* "tstart_local_tn" of the TP transaction a snapshot cursor is bound to */
+	uint4				trestart;	/* "dollar_trestart" of the TP transaction a snapshot cursor is bound to */
+	struct gv_key_struct		*key;		/* start key (if !started) or key of the last node returned */
+	struct sapi_cursor_hist_struct	*hist;		/* search history of the last node returned (see "ydb_cursor_next_s")
+							 * or NULL if none was saved.
+							 */
+} sapi_cursor;
+
 /* Define routines before get to inline routine definitions */
 int	sapi_return_subscr_nodes(int *ret_subs_used, ydb_buffer_t *ret_subsarray, char *ydb_caller_fn);
 void	sapi_save_targ_key_subscr_nodes(void);
+sapi_cursor	*sapi_cursor_find(gtm_uint64_t id, libyottadb_routines lydbrtn, sapi_cursor **ret_prev);
 void	*ydb_stm_thread(void *parm);
 int	ydb_tp_s_common(libyottadb_routines lydbrtn,
 			ydb_basicfnptr_t tpfn, void *tpfnparm, const char *transid, int namecount, const ydb_buffer_t *varnames);
@@ -935,6 +978,11 @@ void	ydb_stm_atfork_parent(void);
 void	ydb_stm_atfork_child(void);
 
 void	ydb_issue_invvarname_error(const ydb_buffer_t *varname);
+void	sapi_get_node(libyottadb_routines lydbrtn, ydb_var_types get_type, int get_svn_index, int hash_code,
+			const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
+void	sapi_set_node(libyottadb_routines lydbrtn, ydb_var_types set_type, int set_svn_index, int hash_code,
+			const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value);
+int	ydb_many_s_common(libyottadb_routines lydbrtn, int count, ydb_node_t *nodes);
 
 /* Use NO_THREADGBL_DEFTYPES here to keep these inline routines from expanding in gtm_threadgbl_deftypes.c where they are
  * unnecessary and cause build issues of the gtm_threadgbl_deftypes executable that builds gtm_threadgbl_deftypes.h.
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -68,6 +68,7 @@
 #include "gtm_reservedDB.h"
 #include "min_max.h"
 #include "gtm_common_defs.h"
+#include "gtm_multi_proc.h"
 
 GBLREF	int			(*op_open_ptr)(mval *v, mval *p, mval *t, mval *mspace);
 GBLREF	bool			mu_ctrlc_occurred;
@@ -89,6 +90,7 @@ error_def(ERR_EXTRACTCTRLY);
 error_def(ERR_EXTRACTFILERR);
 error_def(ERR_ENCRYPTCONFLT);
 error_def(ERR_EXTRFILEXISTS);
+error_def(ERR_FILENAMETOOLONG);
 error_def(ERR_EXTRINTEGRITY);
 error_def(ERR_ICUNOTENABLED);
 error_def(ERR_MUNOACTION);
@@ -132,6 +134,45 @@ STATICDEF readonly unsigned char	no_param = (unsigned char)iop_eol;
 STATICDEF boolean_t 			is_binary_format;
 STATICDEF gd_region			**opened_regions;
 STATICDEF uint4				opened_region_count;
+STATICDEF int				format, reg_max_rec, reg_max_key, reg_max_blk, reg_std_null_coll;
+STATICDEF boolean_t			any_file_encrypted, any_file_uses_non_null_iv;
+STATICDEF unsigned short		hash_array_len, null_iv_array_len;
+STATICDEF unsigned char			*hash_array_ptr, *null_iv_array_ptr;
+STATICDEF uint4				*hash2_index_array_ptr;
+
+/* MUPIP EXTRACT -PARALLEL state in the "gtm_multi_proc" shared memory. Each stream picks the next global to extract from
+ * "next_gbl" so a stream that got a small global moves on to the next one instead of waiting for its turn.
+ */
+typedef struct
+{
+	mu_extr_stats	stats;
+	int		stream;		/* stream (0-based) the global went to */
+	boolean_t	success;
+	boolean_t	done;
+} extr_mp_gbl;
+
+typedef struct
+{
+	int		next_gbl;	/* index into "extr_mp_gbls" of the next global to extract (protected by the latch) */
+	extr_mp_gbl	gbl[1];		/* "extr_mp_ngbls" entries */
+} extr_mp_shm_t;
+
+STATICDEF glist				**extr_mp_gbls;		/* MUPIP EXTRACT -PARALLEL : globals in extract order */
+STATICDEF int				extr_mp_ngbls;
+STATICDEF size_t			extr_mp_shm_size;
+STATICDEF extr_mp_shm_t			*extr_mp_shm;		/* state shared by the streams */
+STATICDEF extr_mp_shm_t			*extr_mp_results;	/* private copy of "extr_mp_shm" */
+STATICDEF char				extr_mp_stream_name[MAX_FN_LEN + 1];
+
+STATICFNDCL void mu_extract_label(void);
+STATICFNDCL boolean_t mu_extract_gbl(glist *gl_ptr, mu_extr_stats *global_total);
+STATICFNDCL void mu_extract_gbl_log(glist *gl_ptr, mu_extr_stats *global_total, mu_extr_stats *spangbl_total,
+					gvnh_spanreg_t **gvspan, boolean_t logqualifier);
+STATICFNDCL boolean_t mu_extract_parallel(glist *gl_head, int nstreams, boolean_t logqualifier, mu_extr_stats *grand_total);
+STATICFNDCL void mu_extract_stream_name(int stream, char *buff, int buff_len);
+STATICFNDCL uint4 mu_extract_multi_proc_init(int *stream);
+STATICFNDCL uint4 mu_extract_multi_proc(int *stream);
+STATICFNDCL uint4 mu_extract_multi_proc_finish(int *stream);
 
 #define BINARY_FORMAT_STRING		"BINARY"
 #define ZWR_FORMAT_STRING		"ZWR"
@@ -199,41 +240,42 @@ CONDITION_HANDLER(mu_extract_handler2)
 	NEXTCH;
 }
 
+CONDITION_HANDLER(mu_extract_stream_handler)
+{
+	boolean_t	release_latch;
+
+	START_CH(TRUE);
+	GRAB_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+	util_out_print("!/WARNING!!!!!! Extract file !AZ is incomplete!!!/", TRUE, extr_mp_stream_name);
+	REL_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+	NEXTCH;
+}
+
 void mu_extract(void)
 {
-	int				stat_res, truncate_res, index, index2;
-	int				reg_max_rec, reg_max_key, reg_max_blk, reg_std_null_coll;
-	int				iter, format, local_errno, int_nlen, str_len, max_label_len;
-	boolean_t			freeze, override, logqualifier, success, success2;
-	char				format_buffer[FORMAT_STR_MAX_SIZE],  ch_set_name[MAX_CHSET_NAME + 1], cli_buff[MAX_LINE],
-					bin_label_buff[BIN_LABEL_STR_MAX_SIZE], zwr_go_label_buff[ZWR_GO_LABEL_MAX_SIZE],
-					**cli_argv, *realpath_val ;
+	int				index, max_procs;
+	int				local_errno, int_nlen;
+	boolean_t			freeze, override, logqualifier, parallel, success, success2;
+	char				format_buffer[FORMAT_STR_MAX_SIZE],  ch_set_name[MAX_CHSET_NAME + 1], cli_buff[MAX_LINE];
+	char				stream_name[MAX_FN_LEN + 1];
 	glist				gl_head, *gl_ptr, *next_gl_ptr;
 	gd_region			*reg, *region_top;
 	mu_extr_stats			global_total, grand_total, spangbl_total;
-	uint4				item_code, devbufsiz, maxfield;
-	unsigned short			label_len, n_len, ch_set_len, buflen;
-	unsigned char			*outbuf, *outptr, *chptr, *leadptr;
+	unsigned short			n_len, ch_set_len;
 	struct stat                     statbuf;
-	mval				val, curr_gbl_name, op_val, op_pars;
+	mval				op_val, op_pars;
 	mstr				chset_mstr;
-	mname_entry			gvname;
-	coll_hdr			extr_collhdr;
-	int				bin_header_size;
-	boolean_t			any_file_encrypted, any_file_uses_non_null_iv, null_iv;
-	gvnh_reg_t			*gvnh_reg;
-	gvnh_spanreg_t			*gvspan, *last_gvspan;
+	gvnh_spanreg_t			*gvspan;
 	boolean_t 			region;
-	unsigned short			hash_array_len, hash2_index_array_len, null_iv_array_len;
-	uint4				*curr_hash2_index_ptr, *hash2_index_array_ptr;
-	unsigned char			*curr_hash_ptr, *hash_array_ptr, *null_iv_array_ptr;
+	unsigned short			hash2_index_array_len;
+	uint4				*curr_hash2_index_ptr;
+	unsigned char			*curr_hash_ptr;
 	sgmnt_data_ptr_t		csd;
 	sgmnt_addrs			*csa;
 	node_local_ptr_t		cnl;
 	int				use_null_iv;
 	tp_region			*rptr;
 	uint4				pid;
-	char *				value_str[2];	/* holds realpath_val & cli_lex_in_ptr->in_str for copying to label buff */
 	boolean_t			is_extract_stdout;
 	DCL_THREADGBL_ACCESS;
 
@@ -244,7 +286,6 @@ void mu_extract(void)
 	/* Initialize all local character arrays to zero before using */
 	memset(cli_buff, 0, SIZEOF(cli_buff));
 	memset(outfilename, 0, SIZEOF(outfilename));
-	memset(bin_label_buff, 0, SIZEOF(bin_label_buff));
 	memset(format_buffer, 0, SIZEOF(format_buffer));
 	active_device = io_curr_device.out;
 	mu_outofband_setup();
@@ -292,6 +333,9 @@ void mu_extract(void)
 		freeze = TRUE;
 	if (CLI_PRESENT == cli_present("OVERRIDE"))
 		override = TRUE;
+	parallel = (CLI_PRESENT == cli_present("PARALLEL"));
+	if (parallel && !cli_get_int("PARALLEL", &max_procs))
+		max_procs = 0;	/* Treat -PARALLEL without any value as one stream per global */
 	if (CLI_PRESENT == cli_present("NULL_IV"))
 		use_null_iv = 1;
 	else if (CLI_NEGATED == cli_present("NULL_IV"))
@@ -446,28 +490,126 @@ void mu_extract(void)
 		assert(MV_STR == op_val.mvtype);
 		op_val.str.len = filename_len = n_len;
 		op_val.str.addr = (char *)outfilename;
-		assert(MV_STR == op_pars.mvtype);
-		op_pars.str.len = SIZEOF(open_params_list);
-		op_pars.str.addr = (char *)open_params_list;
-		(*op_open_ptr)(&op_val, &op_pars, (mval *)&literal_zero, 0);
+		if (parallel)
+		{	/* The -FILE names the manifest. The stream files are named after it. Create none unless all are new. */
+			for (gl_ptr = gl_head.next, index = 0; gl_ptr; gl_ptr = gl_ptr->next)
+				index++;
+			if (!max_procs || (max_procs > index))
+				max_procs = index;	/* one stream per global at most */
+			max_procs = MIN(max_procs, MULTI_PROC_MAX_PROCS - 1);
+			for (index = 0; index < max_procs; index++)
+			{
+				mu_extract_stream_name(index, stream_name, SIZEOF(stream_name));
+				if ((SIZEOF(stream_name) - 1) <= STRLEN(stream_name))
+				{
+					gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_FILENAMETOOLONG);
+					mupip_exit(ERR_MUNOACTION);
+				}
+				if (-1 != Stat(stream_name, &statbuf))
+				{
+					gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_EXTRFILEXISTS, 2, LEN_AND_STR(stream_name));
+					mupip_exit(ERR_MUNOACTION);
+				}
+			}
+		} else
+		{
+			assert(MV_STR == op_pars.mvtype);
+			op_pars.str.len = SIZEOF(open_params_list);
+			op_pars.str.addr = (char *)open_params_list;
+			(*op_open_ptr)(&op_val, &op_pars, (mval *)&literal_zero, 0);
+		}
 		is_extract_stdout = FALSE;
 	} else
 	{
 		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_EXTRFILEXISTS, 2, LEN_AND_STR(outfilename));
 		mupip_exit(ERR_MUNOACTION);
 	}
-	ESTABLISH(mu_extract_handler1);
-	assert(MV_STR == op_pars.mvtype);
-	op_pars.str.len = SIZEOF(use_params);
-	op_pars.str.addr = (char *)&use_params;
-	if (!is_extract_stdout)
-		op_use(&op_val, &op_pars);
+	if (parallel)
+		success = mu_extract_parallel(&gl_head, max_procs, logqualifier, &grand_total);
 	else
-	{	/* Switch to io_std_device.out */
-		active_device = io_std_device.out;
-		io_curr_device = io_std_device.out->pair;
-		(active_device->disp_ptr->use)(active_device, &op_pars);
+	{
+		ESTABLISH(mu_extract_handler1);
+		assert(MV_STR == op_pars.mvtype);
+		op_pars.str.len = SIZEOF(use_params);
+		op_pars.str.addr = (char *)&use_params;
+		if (!is_extract_stdout)
+			op_use(&op_val, &op_pars);
+		else
+		{	/* Switch to io_std_device.out */
+			active_device = io_std_device.out;
+			io_curr_device = io_std_device.out->pair;
+			(active_device->disp_ptr->use)(active_device, &op_pars);
+		}
+		mu_extract_label();
+		REVERT;
+		ESTABLISH(mu_extract_handler2);
+		success = TRUE;
+		gvspan = NULL;
+		for (gl_ptr = gl_head.next; gl_ptr; gl_ptr = next_gl_ptr)
+		{
+			if (mu_ctrly_occurred)
+				break;
+			success2 = mu_extract_gbl(gl_ptr, &global_total);
+			success = success2 && success;
+			next_gl_ptr = gl_ptr->next;
+			mu_extract_gbl_log(gl_ptr, &global_total, &spangbl_total, &gvspan, logqualifier);
+			MU_EXTR_STATS_ADD(grand_total, global_total);	/* add global_total to grand_total */
+		}
+		assert(MV_STR == op_val.mvtype);
+		op_val.str.addr = (char *)outfilename;
+		op_val.str.len = filename_len;
+		assert(MV_STR == op_pars.mvtype);
+		op_pars.str.len = SIZEOF(no_param);
+		op_pars.str.addr = (char *)&no_param;
+		op_close(&op_val, &op_pars);
+		REVERT;
+		REVERT;
+	}
+	if (MU_FMT_BINARY == format)
+	{
+		assert(NULL != hash_array_ptr);
+		assert(NULL != null_iv_array_ptr);
+		assert(NULL != hash2_index_array_ptr);
+		free(hash_array_ptr);
+		free(null_iv_array_ptr);
+		free(hash2_index_array_ptr);
+	}
+	if (mu_ctrly_occurred)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_EXTRACTCTRLY);
+		mupip_exit(ERR_MUNOFINISH);
+	}
+	if (0 != grand_total.recknt)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(8) ERR_RECORDSTAT, 6, LEN_AND_LIT("TOTAL"),
+				&grand_total.recknt, grand_total.keylen, grand_total.datalen, grand_total.reclen);
+	} else
+	{
+                gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_NOSELECT);
+		UNLINK(outfilename);
+		for (index = 0; parallel && (index < max_procs); index++)
+		{
+			mu_extract_stream_name(index, stream_name, SIZEOF(stream_name));
+			UNLINK(stream_name);
+		}
+                mupip_exit(ERR_NOSELECT);
 	}
+	mupip_exit(success ? SS_NORMAL : ERR_MUNOFINISH);
+}
+
+/* Writes the header label of the extract file to the current device */
+STATICFNDEF void mu_extract_label(void)
+{
+	unsigned char			*outbuf, *outptr, *chptr, *leadptr;
+	char				bin_label_buff[BIN_LABEL_STR_MAX_SIZE], zwr_go_label_buff[ZWR_GO_LABEL_MAX_SIZE],
+					**cli_argv, *realpath_val;
+	char *				value_str[2];	/* holds realpath_val & cli_lex_in_ptr->in_str for copying to label buff */
+	unsigned short			label_len, buflen;
+	int				iter, max_label_len, str_len;
+	mval				val, op_val;
+
+	memset(bin_label_buff, 0, SIZEOF(bin_label_buff));
+	op_val.mvtype = MV_STR;
 	if (MU_FMT_BINARY == format)
 	{	/* binary header label format:
 		 * fixed length text, fixed length date & time,
@@ -634,104 +776,265 @@ void mu_extract(void)
 		}
 		op_wteol(1);
 	}
-	REVERT;
-	ESTABLISH(mu_extract_handler2);
-	success = TRUE;
-	gvspan = NULL;
-	for (gl_ptr = gl_head.next; gl_ptr; gl_ptr = next_gl_ptr)
+}
+
+/* Extracts one global to the current device. "global_total" returns the record statistics of the global. */
+STATICFNDEF boolean_t mu_extract_gbl(glist *gl_ptr, mu_extr_stats *global_total)
+{
+	boolean_t			null_iv, success;
+	coll_hdr			extr_collhdr;
+	int				index, index2;
+	unsigned short			label_len;
+	mval				op_val;
+	tp_region			*rptr;
+
+	op_val.mvtype = MV_STR;
+	/* Sets gv_target/gv_currkey/gv_cur_region/cs_addrs/cs_data to correspond to <globalname,reg> in gl_ptr. */
+	DO_OP_GVNAME(gl_ptr);
+	if (MU_FMT_BINARY == format)
 	{
-		if (mu_ctrly_occurred)
-			break;
-		/* Sets gv_target/gv_currkey/gv_cur_region/cs_addrs/cs_data to correspond to <globalname,reg> in gl_ptr. */
-		DO_OP_GVNAME(gl_ptr);
-		if (MU_FMT_BINARY == format)
+		label_len = SIZEOF(extr_collhdr);
+		assert(MV_STR == op_val.mvtype);
+		op_val.str.addr = (char *)(&label_len);
+		op_val.str.len = SIZEOF(label_len);
+		op_write(&op_val);
+		extr_collhdr.act = gv_target->act;
+		extr_collhdr.nct = gv_target->nct;
+		extr_collhdr.ver = gv_target->ver;
+		extr_collhdr.pad = 0;	/* Initialize unused padding field to avoid random/garbage values */
+		op_val.str.addr = (char *)(&extr_collhdr);
+		op_val.str.len = SIZEOF(extr_collhdr);
+		op_write(&op_val);
+	}
+	if ((MU_FMT_BINARY == format) && any_file_encrypted && USES_ANY_KEY(cs_data))
+	{	/* The index variable should still be set properly. */
+		for (rptr = grlist, index = 0; ; rptr = rptr->fPtr, index++)
 		{
-			label_len = SIZEOF(extr_collhdr);
-			assert(MV_STR == op_val.mvtype);
-			op_val.str.addr = (char *)(&label_len);
-			op_val.str.len = SIZEOF(label_len);
-			op_write(&op_val);
-			extr_collhdr.act = gv_target->act;
-			extr_collhdr.nct = gv_target->nct;
-			extr_collhdr.ver = gv_target->ver;
-			extr_collhdr.pad = 0;	/* Initialize unused padding field to avoid random/garbage values */
-			op_val.str.addr = (char *)(&extr_collhdr);
-			op_val.str.len = SIZEOF(extr_collhdr);
-			op_write(&op_val);
+			assert(NULL != rptr);
+			if (&FILE_INFO(gv_cur_region)->fileid == &FILE_INFO(rptr->reg)->fileid)
+				break;
 		}
-		if ((MU_FMT_BINARY == format) && any_file_encrypted && USES_ANY_KEY(cs_data))
-		{	/* The index variable should still be set properly. */
-			for (rptr = grlist, index = 0; ; rptr = rptr->fPtr, index++)
-			{
-				assert(NULL != rptr);
-				if (&FILE_INFO(gv_cur_region)->fileid == &FILE_INFO(rptr->reg)->fileid)
-					break;
-			}
-			index2 = *(hash2_index_array_ptr + index);
-			null_iv = *(null_iv_array_ptr + index) == '1';
-			if (!IS_ENCRYPTED(cs_data->is_encrypted))
-				index = -1;
-			if (!USES_NEW_KEY(cs_data))
-				index2 = -1;
-			success2 = mu_extr_gblout(gl_ptr, &global_total, format, TRUE,
-					any_file_uses_non_null_iv, index, index2, null_iv);
-		} else
-			success2 = mu_extr_gblout(gl_ptr, &global_total, format, any_file_encrypted,
-					any_file_uses_non_null_iv, -1, -1, FALSE);
-		success = success2 && success;
-		gvnh_reg = gl_ptr->gvnh_reg;
-		last_gvspan = gvspan;
-		gvspan = gvnh_reg->gvspan;
-		if (NULL != gvspan)
-		{	/* this global spans more than one region. aggregate stats across all regions */
-			if (last_gvspan != gvspan)
-				MU_EXTR_STATS_INIT(spangbl_total); /* this is the FIRST spanned region. initialize spangbl_total */
-			MU_EXTR_STATS_ADD(spangbl_total, global_total);	/* add global_total to grand_total */
+		index2 = *(hash2_index_array_ptr + index);
+		null_iv = *(null_iv_array_ptr + index) == '1';
+		if (!IS_ENCRYPTED(cs_data->is_encrypted))
+			index = -1;
+		if (!USES_NEW_KEY(cs_data))
+			index2 = -1;
+		success = mu_extr_gblout(gl_ptr, global_total, format, TRUE,
+				any_file_uses_non_null_iv, index, index2, null_iv);
+	} else
+		success = mu_extr_gblout(gl_ptr, global_total, format, any_file_encrypted,
+				any_file_uses_non_null_iv, -1, -1, FALSE);
+	return success;
+}
+
+/* Reports the record statistics of one global (and those of the global across all regions it spans after its last region) */
+STATICFNDEF void mu_extract_gbl_log(glist *gl_ptr, mu_extr_stats *global_total, mu_extr_stats *spangbl_total,
+					gvnh_spanreg_t **gvspan, boolean_t logqualifier)
+{
+	glist				*next_gl_ptr;
+	gvnh_reg_t			*gvnh_reg;
+	gvnh_spanreg_t			*last_gvspan;
+
+	gvnh_reg = gl_ptr->gvnh_reg;
+	last_gvspan = *gvspan;
+	*gvspan = gvnh_reg->gvspan;
+	if (NULL != *gvspan)
+	{	/* this global spans more than one region. aggregate stats across all regions */
+		if (last_gvspan != *gvspan)
+			MU_EXTR_STATS_INIT(*spangbl_total); /* this is the FIRST spanned region. initialize spangbl_total */
+		MU_EXTR_STATS_ADD((*spangbl_total), (*global_total));	/* add global_total to spangbl_total */
+	}
+	next_gl_ptr = gl_ptr->next;
+	if ((logqualifier || mu_ctrlc_occurred) && (0 < global_total->recknt))
+	{
+		ISSUE_RECORDSTAT_MSG(gl_ptr, (*global_total), PRINT_REG_TRUE);
+		if ((NULL != *gvspan) && ((NULL == next_gl_ptr) || (next_gl_ptr->gvnh_reg != gvnh_reg)))
+		{	/* this is the LAST spanned region. Display summary line across all spanned regions */
+			ISSUE_RECORDSTAT_MSG(gl_ptr, (*spangbl_total), PRINT_REG_FALSE);
 		}
-		next_gl_ptr = gl_ptr->next;
-		if ((logqualifier || mu_ctrlc_occurred) && (0 < global_total.recknt))
+		mu_ctrlc_occurred = FALSE;
+	}
+}
+
+/* MUPIP EXTRACT -PARALLEL : extracts the globals in "gl_head" into "nstreams" stream files, each written by its own process,
+ * and then writes the names of the stream files to the manifest (the -FILE). Returns FALSE if any global did not make it
+ * completely to a stream file. "grand_total" returns the record statistics across all globals.
+ */
+STATICFNDEF boolean_t mu_extract_parallel(glist *gl_head, int nstreams, boolean_t logqualifier, mu_extr_stats *grand_total)
+{
+	boolean_t		success;
+	char			stream_name[MAX_FN_LEN + 1], *base;
+	glist			*gl_ptr;
+	gvnh_spanreg_t		*gvspan;
+	extr_mp_gbl		*res;
+	int			idx, rc, *streams;
+	mu_extr_stats		spangbl_total;
+	mval			op_val, op_pars;
+	void			**ret_array;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	for (extr_mp_ngbls = 0, gl_ptr = gl_head->next; gl_ptr; gl_ptr = gl_ptr->next)
+		extr_mp_ngbls++;
+	assert((0 < nstreams) && (nstreams <= extr_mp_ngbls));
+	extr_mp_gbls = (glist **)malloc(SIZEOF(glist *) * extr_mp_ngbls);
+	for (idx = 0, gl_ptr = gl_head->next; gl_ptr; gl_ptr = gl_ptr->next)
+		extr_mp_gbls[idx++] = gl_ptr;
+	extr_mp_shm_size = SIZEOF(extr_mp_shm_t) + (SIZEOF(extr_mp_gbl) * extr_mp_ngbls);
+	extr_mp_results = (extr_mp_shm_t *)malloc(extr_mp_shm_size);
+	memset(extr_mp_results, 0, extr_mp_shm_size);
+	extr_mp_shm = extr_mp_results;	/* switched to shared memory by "mu_extract_multi_proc_init" if there are 2+ streams */
+	streams = (int *)malloc(SIZEOF(int) * nstreams);
+	for (idx = 0; idx < nstreams; idx++)
+		streams[idx] = idx;
+	ret_array = (void **)malloc(SIZEOF(void *) * nstreams);
+	/* Any error in setting up the processes has been reported by "gtm_multi_proc". Globals that did not get extracted as
+	 * a result show up as not "done" below.
+	 */
+	rc = gtm_multi_proc((gtm_multi_proc_fnptr_t)&mu_extract_multi_proc, nstreams, nstreams, ret_array, (void *)streams,
+			SIZEOF(int), extr_mp_shm_size, (gtm_multi_proc_fnptr_t)&mu_extract_multi_proc_init,
+			(gtm_multi_proc_fnptr_t)&mu_extract_multi_proc_finish);
+	success = (0 == rc);
+	gvspan = NULL;
+	for (idx = 0; idx < extr_mp_ngbls; idx++)
+	{
+		res = &extr_mp_results->gbl[idx];
+		if (!res->done)
 		{
-			ISSUE_RECORDSTAT_MSG(gl_ptr, global_total, PRINT_REG_TRUE);
-			if ((NULL != gvspan) && ((NULL == next_gl_ptr) || (next_gl_ptr->gvnh_reg != gvnh_reg)))
-			{	/* this is the LAST spanned region. Display summary line across all spanned regions */
-				ISSUE_RECORDSTAT_MSG(gl_ptr, spangbl_total, PRINT_REG_FALSE);
-			}
-			mu_ctrlc_occurred = FALSE;
+			success = FALSE;
+			continue;
 		}
-		MU_EXTR_STATS_ADD(grand_total, global_total);	/* add global_total to grand_total */
+		success = res->success && success;
+		mu_extract_gbl_log(extr_mp_gbls[idx], &res->stats, &spangbl_total, &gvspan, logqualifier);
+		MU_EXTR_STATS_ADD((*grand_total), res->stats);	/* add global_total to grand_total */
+	}
+	free(ret_array);
+	free(streams);
+	free(extr_mp_results);
+	free(extr_mp_gbls);
+	extr_mp_shm = extr_mp_results = NULL;
+	extr_mp_gbls = NULL;
+	if (!success || mu_ctrly_occurred || !grand_total->recknt)
+		return success;
+	/* Write the manifest : a label line followed by the names of the stream files relative to the directory of the
+	 * manifest, so the extract can be moved as a whole.
+	 */
+	ESTABLISH_RET(mu_extract_handler1, FALSE);
+	op_val.mvtype = op_pars.mvtype = MV_STR;
+	op_val.str.addr = (char *)outfilename;
+	op_val.str.len = filename_len;
+	op_pars.str.len = SIZEOF(open_params_list);
+	op_pars.str.addr = (char *)open_params_list;
+	(*op_open_ptr)(&op_val, &op_pars, (mval *)&literal_zero, 0);
+	op_pars.str.len = SIZEOF(use_params);
+	op_pars.str.addr = (char *)&use_params;
+	op_use(&op_val, &op_pars);
+	op_val.str.addr = EXTR_MANIFEST_LABEL;
+	op_val.str.len = STR_LIT_LEN(EXTR_MANIFEST_LABEL);
+	op_write(&op_val);
+	op_wteol(1);
+	for (idx = 0; idx < nstreams; idx++)
+	{
+		mu_extract_stream_name(idx, stream_name, SIZEOF(stream_name));
+		base = strrchr(stream_name, '/');
+		base = (NULL == base) ? stream_name : base + 1;
+		op_val.str.addr = base;
+		op_val.str.len = STRLEN(base);
+		op_write(&op_val);
+		op_wteol(1);
 	}
-	assert(MV_STR == op_val.mvtype);
 	op_val.str.addr = (char *)outfilename;
 	op_val.str.len = filename_len;
-	assert(MV_STR == op_pars.mvtype);
 	op_pars.str.len = SIZEOF(no_param);
 	op_pars.str.addr = (char *)&no_param;
 	op_close(&op_val, &op_pars);
 	REVERT;
-	REVERT;
-	if (MU_FMT_BINARY == format)
-	{
-		assert(NULL != hash_array_ptr);
-		assert(NULL != null_iv_array_ptr);
-		assert(NULL != hash2_index_array_ptr);
-		free(hash_array_ptr);
-		free(null_iv_array_ptr);
-		free(hash2_index_array_ptr);
-	}
-	if (mu_ctrly_occurred)
+	return success;
+}
+
+/* Returns the name of the stream file "stream" (0-based) of a MUPIP EXTRACT -PARALLEL : the -FILE name suffixed by
+ * "_<stream + 1>".
+ */
+STATICFNDEF void mu_extract_stream_name(int stream, char *buff, int buff_len)
+{
+	SNPRINTF(buff, buff_len, "%.*s_%d", filename_len, outfilename, stream + 1);
+}
+
+/* This initialization function is called by gtm_multi_proc after shared memory creation */
+STATICFNDEF uint4 mu_extract_multi_proc_init(int *stream)
+{
+	multi_proc_shm_hdr_t	*mp_hdr;	/* Pointer to "multi_proc_shm_hdr_t" structure in shared memory */
+
+	assert(multi_proc_in_use);
+	mp_hdr = multi_proc_shm_hdr;
+	extr_mp_shm = (extr_mp_shm_t *)((sm_uc_ptr_t)mp_hdr->shm_ret_array + (SIZEOF(void *) * mp_hdr->ntasks));
+	memcpy(extr_mp_shm, extr_mp_results, extr_mp_shm_size);
+	return SS_NORMAL;
+}
+
+/* Writes one stream file of a MUPIP EXTRACT -PARALLEL (in a process forked off by gtm_multi_proc if there is more than one
+ * stream). Extracts globals, picking the next one not yet taken by another stream, until there are none left. The outcome
+ * of each global is passed back to the parent in "extr_mp_shm".
+ */
+STATICFNDEF uint4 mu_extract_multi_proc(int *stream)
+{
+	boolean_t		release_latch, success;
+	extr_mp_gbl		*res;
+	int			gbl;
+	mu_extr_stats		global_total;
+	mval			op_val, op_pars;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	mu_extract_stream_name(*stream, extr_mp_stream_name, SIZEOF(extr_mp_stream_name));
+	if (multi_proc_in_use)
 	{
-		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_EXTRACTCTRLY);
-		mupip_exit(ERR_MUNOFINISH);
+		multi_proc_key = (unsigned char *)extr_mp_stream_name;
+		opened_region_count = 0;	/* the parent takes care of "mupip_extract_count" in case of errors */
 	}
-	if (0 != grand_total.recknt)
-	{
-		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(8) ERR_RECORDSTAT, 6, LEN_AND_LIT("TOTAL"),
-				&grand_total.recknt, grand_total.keylen, grand_total.datalen, grand_total.reclen);
-	} else
+	ESTABLISH_RET(mu_extract_stream_handler, ERR_MUNOFINISH);
+	op_val.mvtype = op_pars.mvtype = MV_STR;
+	op_val.str.addr = extr_mp_stream_name;
+	op_val.str.len = STRLEN(extr_mp_stream_name);
+	op_pars.str.len = SIZEOF(open_params_list);
+	op_pars.str.addr = (char *)open_params_list;
+	(*op_open_ptr)(&op_val, &op_pars, (mval *)&literal_zero, 0);
+	op_pars.str.len = SIZEOF(use_params);
+	op_pars.str.addr = (char *)&use_params;
+	op_use(&op_val, &op_pars);
+	mu_extract_label();
+	while (!mu_ctrly_occurred)
 	{
-                gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_NOSELECT);
-		UNLINK(outfilename);
-                mupip_exit(ERR_NOSELECT);
+		GRAB_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+		gbl = extr_mp_shm->next_gbl;
+		if (gbl < extr_mp_ngbls)
+			extr_mp_shm->next_gbl = gbl + 1;
+		REL_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+		if ((gbl >= extr_mp_ngbls) || (multi_proc_in_use && IS_FORCED_MULTI_PROC_EXIT(multi_proc_shm_hdr)))
+			break;
+		res = &extr_mp_shm->gbl[gbl];
+		success = mu_extract_gbl(extr_mp_gbls[gbl], &global_total);
+		res->stats = global_total;
+		res->stream = *stream;
+		res->success = success;
+		res->done = TRUE;
 	}
-	mupip_exit(success ? SS_NORMAL : ERR_MUNOFINISH);
+	op_val.str.addr = extr_mp_stream_name;
+	op_val.str.len = STRLEN(extr_mp_stream_name);
+	op_pars.str.len = SIZEOF(no_param);
+	op_pars.str.addr = (char *)&no_param;
+	op_close(&op_val, &op_pars);
+	REVERT;
+	return SS_NORMAL;
+}
+
+/* This function is called by gtm_multi_proc once all the streams are done */
+STATICFNDEF uint4 mu_extract_multi_proc_finish(int *stream)
+{
+	/* The shared memory goes away on return so keep a private copy of the results */
+	if (extr_mp_shm != extr_mp_results)
+		memcpy(extr_mp_results, extr_mp_shm, extr_mp_shm_size);
+	extr_mp_shm = extr_mp_results;
+	return SS_NORMAL;
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -83,6 +83,7 @@
 #include "aio_shim.h"
 #include "mu_gv_cur_reg_init.h"
 #include "mlkdef.h"
+#include "gds_cbt.h"
 
 GBLREF	sgmnt_addrs		*cs_addrs;
 GBLREF	gd_region		*gv_cur_region;
@@ -832,6 +833,7 @@ boolean_t mu_rndwn_file(gd_region *reg, boolean_t standalone)
 				{
 					if (mupip_jnl_recover)
 						memset(tsd->machine_name, 0, MAX_MCNAMELEN);
+					CBT_INVALIDATE(tsd);	/* changes in the lost shared memory never made it to disk */
 					ALIGN_BUFF_IF_NEEDED_FOR_DIO(udi, buff, tsd, tsd_size);	/* sets "buff" */
 					DB_LSEEKWRITE(csa, udi, udi->fn, udi->fd, (off_t)0, buff, tsd_size, status);
 					if (0 != status)
@@ -914,6 +916,7 @@ boolean_t mu_rndwn_file(gd_region *reg, boolean_t standalone)
 				/* Reset IPC fields in the file header and exit */
 				memset(tsd->machine_name, 0, MAX_MCNAMELEN);
 				RESET_IPC_FIELDS(tsd);
+				CBT_INVALIDATE(tsd);
 			}
 		}
 		assert(!standalone);
@@ -1526,6 +1529,7 @@ boolean_t mu_rndwn_file(gd_region *reg, boolean_t standalone)
 		RESET_SHMID_CTIME(tsd);
 		if (mupip_jnl_recover)
 			memset(tsd->machine_name, 0, MAX_MCNAMELEN);
+		CBT_INVALIDATE(tsd);
 		ALIGN_BUFF_IF_NEEDED_FOR_DIO(udi, buff, tsd, tsd_size);	/* sets "buff" */
 		DB_LSEEKWRITE(csa, udi, udi->fn, udi->fd, (off_t)0, buff, tsd_size, status);
 		if (0 != status)
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -51,6 +51,7 @@
 #include "wbox_test_init.h"
 #include "db_write_eof_block.h"
 #include "mupip_exit.h"
+#include "min_max.h"
 
 #define	TMPDIR_ACCESS_MODE	R_OK | W_OK | X_OK
 #define	TMPDIR_CREATE_MODE	S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH
@@ -136,6 +137,84 @@ error_def(ERR_ERRCALL);
 error_def(ERR_TEXT);
 error_def(ERR_TMPFILENOCRE);
 
+/* Copies the database file "src" to the new file "dst" with copy_file_range(), which lets the file system clone the data
+ * (reflink) or copy it within the kernel instead of through a cp process. Only the data regions of the source are copied,
+ * so the copy is as sparse as one "cp --sparse=always" makes. Returns 0 on success, -1 if copy_file_range() cannot copy
+ * between these files (the caller then uses cp) and the errno of the failure otherwise. "dst" is removed on any failure.
+ */
+static int mubfilcpy_copy(char *src, char *dst)
+{
+	int		src_fd, dst_fd, save_errno, rc;
+	off_t		size, data, hole, in_off, out_off;
+	ssize_t		copied;
+	struct stat	stat_buf;
+	boolean_t	any_copied;
+
+	OPENFILE(src, O_RDONLY, src_fd);
+	if (FD_INVALID == src_fd)
+		return -1;
+	FSTAT_FILE(src_fd, &stat_buf, rc);
+	if (-1 == rc)
+	{
+		CLOSEFILE_RESET(src_fd, rc);	/* resets "src_fd" to FD_INVALID */
+		return -1;
+	}
+	OPENFILE3(dst, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR, dst_fd);
+	if (FD_INVALID == dst_fd)
+	{
+		CLOSEFILE_RESET(src_fd, rc);	/* resets "src_fd" to FD_INVALID */
+		return -1;
+	}
+	size = stat_buf.st_size;
+	save_errno = 0;
+	any_copied = FALSE;
+	for (data = 0; data < size; data = hole)
+	{
+		if (-1 == (data = lseek(src_fd, data, SEEK_DATA)))
+		{
+			if (ENXIO != errno)
+				save_errno = errno;
+			break;			/* ENXIO: the rest of the file is a hole */
+		}
+		if (-1 == (hole = lseek(src_fd, data, SEEK_HOLE)))
+		{
+			save_errno = errno;
+			break;
+		}
+		hole = MIN(hole, size);
+		for (in_off = out_off = data; in_off < hole; )
+		{
+			copied = copy_file_range(src_fd, &in_off, dst_fd, &out_off, (size_t)(hole - in_off), 0);
+			if (0 < copied)
+				any_copied = TRUE;
+			else if (0 == copied)
+				break;		/* end of file */
+			else if (EINTR != errno)
+			{
+				save_errno = errno;
+				break;
+			}
+		}
+		if (save_errno)
+			break;
+	}
+	if (!save_errno)
+	{
+		FTRUNCATE(dst_fd, size, rc);	/* extends the copy over a hole at the end of the source */
+		if (-1 == rc)
+			save_errno = errno;
+	}
+	CLOSEFILE_RESET(src_fd, rc);	/* resets "src_fd" to FD_INVALID */
+	CLOSEFILE_RESET(dst_fd, rc);	/* resets "dst_fd" to FD_INVALID */
+	if (!save_errno)
+		return 0;
+	UNLINK(dst);	/* remove the partial copy so neither cp nor a later backup finds it */
+	if (!any_copied && ((ENOSYS == save_errno) || (EXDEV == save_errno) || (EOPNOTSUPP == save_errno)
+			|| (EINVAL == save_errno)))
+		return -1;	/* Not supported by the kernel or these file systems */
+	return save_errno;
+}
+
 bool	mubfilcpy (backup_reg_list *list)
 {
 	mstr			*file, tempfile;
@@ -158,6 +237,7 @@ bool	mubfilcpy (backup_reg_list *list)
 									 */
 	char			tempdir[MAX_FN_LEN], prefix[MAX_FN_LEN];
 	char			tmpsrcfname[MAX_FN_LEN], tmpsrcdirname[MAX_FN_LEN], realpathname[PATH_MAX];
+	char			dstfname[PATH_MAX + MAX_FN_LEN + 1];
 	int			fstat_res, i, cmdpathlen;
 	uint4			ustatus, size;
 	muinc_blk_hdr_ptr_t	sblkh_p;
@@ -283,61 +363,78 @@ bool	mubfilcpy (backup_reg_list *list)
 		CLEANUP_AND_RETURN_FALSE;
 	}
 	realpathlen = STRLEN(realpathname);
-	/* Calculate total line length for commands to execute (pushd + cp). *
-	 * If cannot fit in local variable array, malloc space *
-	 * commands to be executed :
-		pushd sourcedir && CP_CMD fname tempfilename
-	*/
 	for (i = 0; i < NUM_CMD; i++)
 	{
 		rv = CONFSTR(fulpathcmd[i], MAX_FN_LEN);
 		if (0 != rv)
 			CLEANUP_AND_RETURN_FALSE;
 	}
-	cmdlen = STR_LIT_LEN(UNALIAS) + STR_LIT_LEN(CD_CMD) + sourcedirlen + STR_LIT_LEN(CMD_SEPARATOR);
-	cmdlen += STR_LIT_LEN(fulpathcmd[0]) + STR_LIT_LEN(CP_OPT) + sourcefilelen + 1 /* space */
-								+ realpathlen + 1 /* terminating NULL byte */;
-	if (cmdlen > SIZEOF(cmdarray))
-		command = malloc(cmdlen);	/* allocate memory and use that instead of local array "cmdarray" */
-	/* cd */
-	MEMCPY_LIT(command, UNALIAS);
-	cmdlen = STR_LIT_LEN(UNALIAS);
-	MEMCPY_LIT(&command[cmdlen], CD_CMD);
-	cmdlen += STR_LIT_LEN(CD_CMD);
-	memcpy(&command[cmdlen], sourcedirname, sourcedirlen);
-	cmdlen += sourcedirlen;
-	MEMCPY_LIT(&command[cmdlen], CMD_SEPARATOR);
-	cmdlen += STR_LIT_LEN(CMD_SEPARATOR);
-	/* cp */
-	cmdpathlen = STRLEN(fulpathcmd[0]);
-	memcpy(&command[cmdlen], fulpathcmd[0], cmdpathlen);
-	cmdlen += cmdpathlen;
-	MEMCPY_LIT(&command[cmdlen], CP_OPT);
-	cmdlen += STR_LIT_LEN(CP_OPT);
-	memcpy(&command[cmdlen], sourcefilename, sourcefilelen);
-	cmdlen += sourcefilelen;
-	command[cmdlen++] = ' ';
-	memcpy(&command[cmdlen], realpathname, realpathlen);
-	cmdlen += realpathlen;
-	command[cmdlen] = 0;
+	/* Copy the database file into the temporary directory. Use copy_file_range() if possible and cp if not. */
+	SNPRINTF(dstfname, SIZEOF(dstfname), "%s/%s", realpathname, sourcefilename);
 	if (debug_mupip)
-		util_out_print("!/MUPIP INFO:   !AD", TRUE, cmdlen, command);
-	rv = SYSTEM((char *)command);
-	if (0 != rv)
+		util_out_print("!/MUPIP INFO:   copy_file_range !AZ !AZ", TRUE, FILE_INFO(gv_cur_region)->fn, dstfname);
+	rv = mubfilcpy_copy(FILE_INFO(gv_cur_region)->fn, dstfname);
+	if (0 < rv)
 	{
-		if (-1 == rv)
-		{
-			save_errno = errno;
-			errptr = (char *)STRERROR(save_errno);
-			util_out_print("system : !AZ", TRUE, errptr);
-		}
+		errptr = (char *)STRERROR(rv);
+		util_out_print("copy_file_range : !AZ", TRUE, errptr);
 		if (online)
 			cs_addrs->nl->nbb = BACKUP_NOT_IN_PROGRESS;
-		util_out_print("Error doing !AD", TRUE, cmdlen, command);
-		FREE_COMMAND_STR_IF_NEEDED;
+		util_out_print("Error copying !AZ to !AZ", TRUE, FILE_INFO(gv_cur_region)->fn, dstfname);
 		CLEANUP_AND_RETURN_FALSE;
 	}
-	FREE_COMMAND_STR_IF_NEEDED;
+	if (0 > rv)
+	{
+		/* Calculate total line length for commands to execute (pushd + cp). *
+		 * If cannot fit in local variable array, malloc space *
+		 * commands to be executed :
+			pushd sourcedir && CP_CMD fname tempfilename
+		*/
+		cmdlen = STR_LIT_LEN(UNALIAS) + STR_LIT_LEN(CD_CMD) + sourcedirlen + STR_LIT_LEN(CMD_SEPARATOR);
+		cmdlen += STR_LIT_LEN(fulpathcmd[0]) + STR_LIT_LEN(CP_OPT) + sourcefilelen + 1 /* space */
+									+ realpathlen + 1 /* terminating NULL byte */;
+		if (cmdlen > SIZEOF(cmdarray))
+			command = malloc(cmdlen);	/* allocate memory and use that instead of local array "cmdarray" */
+		/* cd */
+		MEMCPY_LIT(command, UNALIAS);
+		cmdlen = STR_LIT_LEN(UNALIAS);
+		MEMCPY_LIT(&command[cmdlen], CD_CMD);
+		cmdlen += STR_LIT_LEN(CD_CMD);
+		memcpy(&command[cmdlen], sourcedirname, sourcedirlen);
+		cmdlen += sourcedirlen;
+		MEMCPY_LIT(&command[cmdlen], CMD_SEPARATOR);
+		cmdlen += STR_LIT_LEN(CMD_SEPARATOR);
+		/* cp */
+		cmdpathlen = STRLEN(fulpathcmd[0]);
+		memcpy(&command[cmdlen], fulpathcmd[0], cmdpathlen);
+		cmdlen += cmdpathlen;
+		MEMCPY_LIT(&command[cmdlen], CP_OPT);
+		cmdlen += STR_LIT_LEN(CP_OPT);
+		memcpy(&command[cmdlen], sourcefilename, sourcefilelen);
+		cmdlen += sourcefilelen;
+		command[cmdlen++] = ' ';
+		memcpy(&command[cmdlen], realpathname, realpathlen);
+		cmdlen += realpathlen;
+		command[cmdlen] = 0;
+		if (debug_mupip)
+			util_out_print("!/MUPIP INFO:   !AD", TRUE, cmdlen, command);
+		rv = SYSTEM((char *)command);
+		if (0 != rv)
+		{
+			if (-1 == rv)
+			{
+				save_errno = errno;
+				errptr = (char *)STRERROR(save_errno);
+				util_out_print("system : !AZ", TRUE, errptr);
+			}
+			if (online)
+				cs_addrs->nl->nbb = BACKUP_NOT_IN_PROGRESS;
+			util_out_print("Error doing !AD", TRUE, cmdlen, command);
+			FREE_COMMAND_STR_IF_NEEDED;
+			CLEANUP_AND_RETURN_FALSE;
+		}
+		FREE_COMMAND_STR_IF_NEEDED;
+	}
 	assert(command == &cmdarray[0]);
 
 	/* tempfilename currently contains the name of temporary directory created.  *
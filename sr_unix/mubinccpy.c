@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -68,6 +68,7 @@
 #include "wcs_phase2_commit_wait.h"
 #include "gtm_permissions.h"
 #include "gtmcrypt.h"
+#include "gds_cbt.h"
 
 GBLREF	bool			record;
 GBLREF	bool			online;
@@ -135,7 +136,7 @@ error_def(ERR_IOEOF);
 bool	mubinccpy (backup_reg_list *list)
 {
 	mstr			*file;
-	uchar_ptr_t		bm_blk_buff, ptr1, ptr1_top;
+	uchar_ptr_t		bm_blk_buff, ptr1, ptr1_top, cbt_map;
 	char_ptr_t		outptr, data_ptr;
 	char			*c, addr[SA_MAXLEN + 1];
 	sgmnt_data_ptr_t	header;
@@ -155,7 +156,7 @@ bool	mubinccpy (backup_reg_list *list)
 	muinc_blk_hdr_ptr_t	sblkh_p;
 	trans_num		blk_tn;
 	int4			blk_bsiz;
-	block_id		blk_num_base, blk_num;
+	block_id		blk_num_base, blk_num, next_blk;
 	boolean_t		is_bitmap_blk, backup_this_blk;
 	enum db_ver		dummy_odbv;
 	int			rc;
@@ -329,11 +330,28 @@ bool	mubinccpy (backup_reg_list *list)
 		free(bm_blk_buff);
 		CLEANUP_AND_RETURN_FALSE;
 	}
+	/* If a changed block map covers the transactions being backed up, only the block groups it has set need to be read */
+	cbt_map = gds_cbt_map(header, list->tn);
+	if (debug_mupip && (NULL != cbt_map))
+		util_out_print("MUPIP INFO:   Reading only block groups of 0x!XL blocks updated since 0x!16@XQ", TRUE,
+			BLKS_PER_LMAP << header->cbt_shift, &header->cbt_tn[(cbt_map == header->cbt_map[0]) ? 0 : 1]);
 	read_offset = (off_t)BLK_ZERO_OFF(header->start_vbn);
 	for (blk_num_base = 0;  blk_num_base < header->trans_hist.total_blks;  blk_num_base += blks_per_buff)
 	{
 		if (online && (0 != cs_addrs->shmpool_buffer->failed))
 			break;
+		if ((NULL != cbt_map) && blk_num_base && !CBT_CHANGED(header, cbt_map, blk_num_base))
+		{	/* Nothing in this group was updated since the map started, so skip to the start of the next group.
+			 * That is a local bitmap block, which gets "bm_blk_buff" set up for the blocks after it. The first
+			 * buffer is always read as blocks 0, 1 and 2 are always backed up (see below).
+			 */
+			next_blk = MIN(CBT_NEXT_GROUP(header, blk_num_base), header->trans_hist.total_blks);
+			read_offset += (off_t)(next_blk - blk_num_base) * bsize;
+			blk_num_base = next_blk - blks_per_buff;	/* the loop adds "blks_per_buff" back */
+			if (online)
+				cs_addrs->nl->nbb = next_blk - 1;
+			continue;
+		}
 		if ((header->trans_hist.total_blks - blk_num_base) < blks_per_buff)
 		{
 			/* (header->trans_hist.total_blks - blk_num_base) can be cast because it should fit in an int4 */
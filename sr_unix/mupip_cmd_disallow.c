@@ -3,7 +3,7 @@
  * Copyright (c) 2002-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -64,6 +64,9 @@ boolean_t cli_disallow_mupip_extract(void)
 	*cli_err_str_ptr = 0;
 	disallow_return_value = d_c_cli_present("NULL_IV") && !d_c_cli_present("BINARY");
 	CLI_DIS_CHECK_N_RESET;
+	/* PARALLEL writes a stream file per process so it needs a FILE to name them after */
+	disallow_return_value = d_c_cli_present("PARALLEL") && d_c_cli_present("STDOUT");
+	CLI_DIS_CHECK_N_RESET;
 	return FALSE;
 }
 
@@ -121,6 +124,9 @@ boolean_t cli_disallow_mupip_integ(void)
 	disallow_return_value = !d_c_cli_present("REGION")
 					&& (d_c_cli_present("STATS") || d_c_cli_negated("STATS"));
 	CLI_DIS_CHECK_N_RESET;
+	/* PARALLEL is supported only with REGION */
+	disallow_return_value = !d_c_cli_present("REGION") && d_c_cli_present("PARALLEL");
+	CLI_DIS_CHECK_N_RESET;
 	return FALSE;
 }
 
@@ -211,6 +217,19 @@ boolean_t cli_disallow_mupip_journal(void)
 	return FALSE;
 }
 
+boolean_t cli_disallow_mupip_load(void)
+{
+	int disallow_return_value = 0;
+
+	*cli_err_str_ptr = 0;
+	/* PARALLEL loads the stream files named in a manifest, so record ranges and standard input do not apply */
+	disallow_return_value = d_c_cli_present("PARALLEL") && (d_c_cli_present("STDIN")
+								|| d_c_cli_present("BEGIN")
+								|| d_c_cli_present("END"));
+	CLI_DIS_CHECK_N_RESET;
+	return FALSE;
+}
+
 boolean_t cli_disallow_mupip_reorg(void)
 {
 	int disallow_return_value = 0;
@@ -3,6 +3,9 @@
  * Copyright (c) 2002-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -20,6 +23,7 @@ boolean_t cli_disallow_mupip_extract(void);
 boolean_t cli_disallow_mupip_freeze(void);
 boolean_t cli_disallow_mupip_integ(void);
 boolean_t cli_disallow_mupip_journal(void);
+boolean_t cli_disallow_mupip_load(void);
 boolean_t cli_disallow_mupip_reorg(void);
 boolean_t cli_disallow_mupip_replicate(void);
 boolean_t cli_disallow_mupip_replic_editinst(void);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -39,27 +39,46 @@
 #include <regex.h>
 #include "op.h"
 #include "min_max.h"
+#include "gtm_stdio.h"
+#include "eintr_wrappers.h"
+#include "gtm_multi_proc.h"
 
 GBLREF	int		gv_fillfactor;
 GBLREF	bool		mupip_error_occurred;
 GBLREF	boolean_t	is_replicator;
 GBLREF	boolean_t	skip_dbtriggers;
 GBLREF	mstr		sys_input;
+GBLREF	boolean_t	skip_exit_handler;
 GBLDEF	int		onerror;
 
+error_def(ERR_FILENAMETOOLONG);
+error_def(ERR_LOADFILERR);
+
 #define CHAR_TO_READ_LINE1_BIN	STR_LIT_LEN("d0GDS BINARY")  /* read first 12 characters to check file is binary [d\0GDS BINARY] */
 #define	MAX_ONERROR_VALUE_LEN	STR_LIT_LEN("INTERACTIVE") /* PROCEED, STOP, INTERACTIVE are the choices with INTERACTIVE as max */
 #define	MAX_FORMAT_VALUE_LEN	STR_LIT_LEN("BINARY") /* ZWR, BINARY, GO, GOQ are the choices with BINARY being the longest */
 
+/* One entry per stream file of a MUPIP LOAD -PARALLEL */
+typedef struct
+{
+	char		fn[MAX_FN_LEN + 1];
+	unsigned short	fn_len;
+	boolean_t	ignore_chset;
+} cvtgbl_mp_task;
+
+STATICFNDCL void mupip_cvtgbl_file(gtm_uint64_t begin, gtm_uint64_t end, boolean_t ignore_chset);
+STATICFNDCL void mupip_cvtgbl_parallel(char *fn, unsigned short fn_len, int max_procs, boolean_t ignore_chset);
+STATICFNDCL uint4 mupip_cvtgbl_multi_proc_init(cvtgbl_mp_task *task);
+STATICFNDCL uint4 mupip_cvtgbl_multi_proc(cvtgbl_mp_task *task);
+
 void mupip_cvtgbl(void)
 {
-	char		fn[MAX_FN_LEN + 1], *line1_ptr, *line3_ptr;
+	char		fn[MAX_FN_LEN + 1];
 	gtm_uint64_t	begin, end;
-	int		dos, i, file_format, line1_len, line3_len, utf8;
-	uint4	        max_rec_size;
+	int		max_procs;
 	unsigned char	buff[MAX_ONERROR_VALUE_LEN];
 	unsigned short	fn_len, len;
-	boolean_t	ignore_chset;
+	boolean_t	ignore_chset, parallel;
 
 	DCL_THREADGBL_ACCESS;
 	SETUP_THREADGBL_ACCESS;
@@ -91,9 +110,15 @@ void mupip_cvtgbl(void)
 		assert(-1 != fcntl(fileno(stdin), F_GETFD));
 	} else if (!cli_get_str("FILE", fn, &fn_len))  /* User wants to read from a file. */
 		mupip_exit(ERR_MUPCLIERR); /* Neither -STDIN nor file name specified. */
-	file_input_init(fn, fn_len, IOP_EOL);
-	if (mupip_error_occurred)
-		EXIT(-1);
+	parallel = (CLI_PRESENT == cli_present("PARALLEL"));
+	if (parallel && !cli_get_int("PARALLEL", &max_procs))
+		max_procs = 0;	/* Treat -PARALLEL without any value as one process per stream file */
+	if (!parallel)
+	{	/* With -PARALLEL, the stream files are opened by the processes that load them */
+		file_input_init(fn, fn_len, IOP_EOL);
+		if (mupip_error_occurred)
+			EXIT(-1);
+	}
 	mu_outofband_setup();
 	if (cli_present("BEGIN") == CLI_PRESENT)
 	{
@@ -157,6 +182,22 @@ void mupip_cvtgbl(void)
 
 	if (cli_present("IGNORECHSET") == CLI_PRESENT)
 		ignore_chset = TRUE;
+	if (parallel)
+		mupip_cvtgbl_parallel(fn, fn_len, max_procs, ignore_chset);
+	else
+		mupip_cvtgbl_file(begin, end, ignore_chset);
+	mupip_exit(mupip_error_occurred ? ERR_MUNOFINISH : SS_NORMAL);
+}
+
+/* Loads the file set up by "file_input_init" : discovers its format and hands it to the loader for that format */
+STATICFNDEF void mupip_cvtgbl_file(gtm_uint64_t begin, gtm_uint64_t end, boolean_t ignore_chset)
+{
+	char		*line1_ptr, *line3_ptr;
+	int		dos, file_format, line1_len, line3_len, utf8;
+	uint4	        max_rec_size;
+	unsigned char	buff[MAX_ONERROR_VALUE_LEN];
+	unsigned short	len;
+
 	file_format = get_load_format(&line1_ptr, &line3_ptr, &line1_len, &line3_len, &max_rec_size, &utf8, &dos, ignore_chset); /* from header */
 	if (MU_FMT_GOQ == file_format)
 		mupip_exit(ERR_LDBINFMT);
@@ -220,7 +261,126 @@ void mupip_cvtgbl(void)
 			mupip_exit(ERR_LDBINFMT);
 		}
 	}
-	mupip_exit(mupip_error_occurred ? ERR_MUNOFINISH : SS_NORMAL);
+}
+
+/* MUPIP LOAD -PARALLEL : loads the stream files named in the manifest "fn" written by MUPIP EXTRACT -PARALLEL, each in its own
+ * process with up to "max_procs" (0 means one per stream file) processes running at the same time. The streams hold disjoint
+ * sets of globals so the processes do not update the same blocks except for the directory tree.
+ */
+STATICFNDEF void mupip_cvtgbl_parallel(char *fn, unsigned short fn_len, int max_procs, boolean_t ignore_chset)
+{
+	FILE		*manifest;
+	char		line[MAX_FN_LEN + 1], *fgets_res, *slash;
+	cvtgbl_mp_task	*tasks, *task;
+	int		dir_len, len, ntasks, alloc_tasks, rc, save_errno;
+	void		**ret_array;
+
+	fn[fn_len] = '\0';
+	Fopen(manifest, fn, "r");
+	if (NULL == manifest)
+	{
+		save_errno = errno;
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(5) ERR_LOADFILERR, 2, fn_len, fn, save_errno);
+		mupip_exit(ERR_MUNOFINISH);
+	}
+	FGETS_FILE(line, SIZEOF(line), manifest, fgets_res);
+	if ((NULL == fgets_res) || STRNCMP_LIT(line, EXTR_MANIFEST_LABEL)
+			|| (('\n' != line[STR_LIT_LEN(EXTR_MANIFEST_LABEL)]) && ('\0' != line[STR_LIT_LEN(EXTR_MANIFEST_LABEL)])))
+	{
+		FCLOSE(manifest, rc);
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_LDBINFMT);
+		mupip_exit(ERR_LDBINFMT);
+	}
+	/* Stream file names are relative to the directory of the manifest */
+	slash = strrchr(fn, '/');
+	dir_len = (NULL == slash) ? 0 : (int)(slash - fn + 1);
+	alloc_tasks = 16;
+	tasks = (cvtgbl_mp_task *)malloc(SIZEOF(cvtgbl_mp_task) * alloc_tasks);
+	for (ntasks = 0; ; )
+	{
+		FGETS_FILE(line, SIZEOF(line), manifest, fgets_res);
+		if (NULL == fgets_res)
+			break;
+		len = STRLEN(line);
+		while (len && (('\n' == line[len - 1]) || ('\r' == line[len - 1])))
+			line[--len] = '\0';
+		if (!len)
+			continue;
+		if (ntasks == alloc_tasks)
+		{
+			task = tasks;
+			tasks = (cvtgbl_mp_task *)malloc(SIZEOF(cvtgbl_mp_task) * alloc_tasks * 2);
+			memcpy(tasks, task, SIZEOF(cvtgbl_mp_task) * alloc_tasks);
+			free(task);
+			alloc_tasks *= 2;
+		}
+		task = &tasks[ntasks++];
+		if ('/' == line[0])
+			dir_len = 0;
+		if ((SIZEOF(task->fn) - 1) < (dir_len + len))
+		{
+			FCLOSE(manifest, rc);
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_FILENAMETOOLONG);
+			mupip_exit(ERR_MUNOFINISH);
+		}
+		memcpy(task->fn, fn, dir_len);
+		memcpy(task->fn + dir_len, line, len + 1);
+		task->fn_len = dir_len + len;
+		task->ignore_chset = ignore_chset;
+		dir_len = (NULL == slash) ? 0 : (int)(slash - fn + 1);
+	}
+	FCLOSE(manifest, rc);
+	if (!ntasks)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_LDBINFMT);
+		mupip_exit(ERR_LDBINFMT);
+	}
+	if (!max_procs || (max_procs > ntasks))
+		max_procs = ntasks;
+	max_procs = MIN(max_procs, MULTI_PROC_MAX_PROCS - 1);
+	ret_array = (void **)malloc(SIZEOF(void *) * ntasks);
+	/* Errors in setting up the processes have been reported by "gtm_multi_proc" and those in loading a stream by the process
+	 * that loaded it.
+	 */
+	rc = gtm_multi_proc((gtm_multi_proc_fnptr_t)&mupip_cvtgbl_multi_proc, ntasks, max_procs, ret_array, (void *)tasks,
+			SIZEOF(cvtgbl_mp_task), 0, (gtm_multi_proc_fnptr_t)&mupip_cvtgbl_multi_proc_init, NULL);
+	if (rc)
+		mupip_error_occurred = TRUE;
+	free(ret_array);
+	free(tasks);
+}
+
+/* This initialization function is called by gtm_multi_proc after shared memory creation. The processes share nothing but
+ * the task list.
+ */
+STATICFNDEF uint4 mupip_cvtgbl_multi_proc_init(cvtgbl_mp_task *task)
+{
+	assert(multi_proc_in_use);
+	return SS_NORMAL;
+}
+
+/* Loads one stream file of a MUPIP LOAD -PARALLEL (in a process forked off by gtm_multi_proc if there is more than one
+ * process). Returns ERR_MUNOFINISH if some records did not load.
+ */
+STATICFNDEF uint4 mupip_cvtgbl_multi_proc(cvtgbl_mp_task *task)
+{
+	boolean_t	save_multi_proc_in_use;
+
+	/* Unlike the usual gtm_multi_proc task, this process opens the database itself (the parent has not opened it)
+	 * so let the exit handler run it down.
+	 */
+	skip_exit_handler = FALSE;
+	/* The loaders report with "util_out_print" which otherwise expects the multi-process latch to be held. Each report
+	 * line goes out in one write so let the processes write them without it.
+	 */
+	save_multi_proc_in_use = multi_proc_in_use;
+	multi_proc_in_use = FALSE;
+	mupip_error_occurred = FALSE;
+	file_input_init(task->fn, task->fn_len, IOP_EOL);
+	if (!mupip_error_occurred)
+		mupip_cvtgbl_file(1, MAXUINT8, task->ignore_chset);
+	multi_proc_in_use = save_multi_proc_in_use;
+	return mupip_error_occurred ? ERR_MUNOFINISH : SS_NORMAL;
 }
 
 /* Make an attempt to discover the input file format based on its content principally the label */
@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -70,6 +70,7 @@
 #include "gtmcrypt.h"
 #include "db_ipcs_reset.h"
 #include "db_write_eof_block.h"
+#include "gds_blk_compress.h"
 
 GBLREF	gd_region		*gv_cur_region;
 GBLREF	mstr			pvt_crypt_buf;
@@ -870,6 +871,11 @@ void endian_header(sgmnt_data *new, sgmnt_data *old, boolean_t new_is_native)
 #	include "tab_gvstats_rec.h"
 #	undef IS_CSD_STATS
 #	undef TAB_GVSTATS_REC
+#	define TAB_GVSTATS_HIST(HIST,TEXT1,TEXT2)			\
+		for (idx = 0; idx < GVSTATS_HIST_BUCKETS; idx++)	\
+			SWAP_SD8(gvstats_hist.HIST[idx]);
+#	include "tab_gvstats_hist.h"
+#	undef TAB_GVSTATS_HIST
 	/************* INTERRUPTED RECOVERY RELATED FIELDS continued ****************/
 	for (idx = 0; idx < MAX_SUPPL_STRMS; idx++)
 		SWAP_SD8(intrpt_recov_resync_strm_seqno[idx]);
@@ -879,6 +885,12 @@ void endian_header(sgmnt_data *new, sgmnt_data *old, boolean_t new_is_native)
 	SWAP_SD4_CAST(certified_for_upgrade_to, enum db_ver);
 	/************* SECSHR_DB_CLNUP RELATED FIELDS (now moved to node_local) ***********/
 	/* "secshr_ops_index_filler" and "secshr_ops_array_filler" need not be converted (they are fillers) */
+	SWAP_SD4(blk_compress);
+	SWAP_SD4(blk_compress_used);
+	for (idx = 0; idx < CBT_GENS; idx++)
+		SWAP_SD8(cbt_tn[idx]);
+	SWAP_SD4(cbt_shift);
+	/* "cbt_map" is a byte array and needs no conversion */
 	/********************************************************/
 	/* "next_upgrd_warn" isn't valid since the database is fully_upgraded and the latch values differ by platform
 	 * and since we don't know where the db will be used, we will ignore it.
@@ -1026,6 +1038,23 @@ int4	endian_process(endian_info *info, sgmnt_data *new_data, sgmnt_data *old_dat
 					util_out_print("Error reading block !UL : !AZ", TRUE, blk_num, errptr);
 					return save_errno;
 				}
+				/* A block written compressed (MUPIP SET -COMPRESSION) is uncompressed before anything else as its
+				 * header is not that of a V6 block. The converted database gets all blocks uncompressed.
+				 */
+				if (new_is_native ? IS_BLK_COMPRESSED_SWAPPED(blk_buff[buff_old])
+						: IS_BLK_COMPRESSED(blk_buff[buff_old]))
+				{
+					save_errno = gds_blk_uncompress((sm_uc_ptr_t)blk_buff[buff_old], bsize, new_is_native);
+					if (0 != save_errno)
+					{
+						free(blk_buff[0]);
+						free(lbmap_buff[0]);
+						free(blk_buff[1]);
+						free(lbmap_buff[1]);
+						util_out_print("Error uncompressing block !UL", TRUE, blk_num);
+						return save_errno;
+					}
+				}
 				memcpy(blk_buff[buff_new], blk_buff[buff_old], bsize);
 				bp_new = (blk_hdr_ptr_t)blk_buff[buff_new];
 				bp_old = (blk_hdr_ptr_t)blk_buff[buff_old];
@@ -1239,6 +1268,9 @@ char *endian_read_dbblk(endian_info *info, block_id blk_to_get)
 		blk_is_native = !info->endian_native;	/* already converted */
 	else
 		blk_is_native = info->endian_native;	/* still original endian */
+	if ((blk_is_native ? IS_BLK_COMPRESSED(buff) : IS_BLK_COMPRESSED_SWAPPED(buff))
+			&& (0 != gds_blk_uncompress((sm_uc_ptr_t)buff, info->bsize, !blk_is_native)))
+		return NULL;
 	/* We need to save a copy of the block header before it is endian-converted because after the conversion it will become
 	 * incompatible with the encrypted data.
 	 */
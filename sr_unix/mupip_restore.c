@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2019-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2019-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -74,6 +74,7 @@
 #include "jnl.h"
 #include "anticipatory_freeze.h"
 #include "db_write_eof_block.h"
+#include "gds_cbt.h"
 
 GBLDEF	inc_list_struct		in_files;
 GBLREF	uint4			pipe_child;
@@ -644,6 +645,7 @@ void mupip_restore(void)
 		csd->gt_sem_ctime.ctime = old_data.gt_sem_ctime.ctime;
 		csd->shmid = old_data.shmid;
 		csd->gt_shm_ctime.ctime = old_data.gt_shm_ctime.ctime;
+		CBT_INVALIDATE(csd);	/* the blocks restored above were not marked in the changed block maps */
 		if (udi->fd_opened_with_o_direct)
 		{	/* Align buffers for O_DIRECT */
 			DIO_BUFF_EXPAND_IF_NEEDED(udi, SGMNT_HDR_LEN, &(TREF(dio_buff)));
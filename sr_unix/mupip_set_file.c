@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -64,6 +64,8 @@
 #include "anticipatory_freeze.h"
 #include "get_fs_block_size.h"
 #include "interlock.h"
+#include "gtm_zlib.h"
+#include "gds_blk_compress.h"
 
 GBLREF	bool			in_backup;
 GBLREF	bool			region;
@@ -124,16 +126,17 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 	uint4                   fbwsize;
 	int4			dblksize;
 	gd_region		*temp_cur_region;
-	int			asyncio_status, defer_allocate_status, defer_status, disk_wait_status, encryptable_status,
-				encryption_complete_status, epoch_taper_status, extn_count_status, fd, fn_len, glbl_buff_status,
-				gtmcrypt_errno, hard_spin_status, inst_freeze_on_error_status, key_size_status, locksharesdbcrit,
-				lock_space_status, mutex_space_status, null_subs_status, qdbrundown_status, read_only_status,
-				rec_size_status, reg_exit_stat, reorg_sleep_nsec_status, rc, rsrvd_bytes_status, save_errno,
-				sleep_cnt_status, spin_sleep_status, stats_status, status, status1, stdnullcoll_status,
-				trigger_flush_limit_status, wrt_per_flu_status, full_blkwrt_status;
-	int4			defer_time, new_cache_size, new_disk_wait, new_extn_count, new_flush_trigger, new_hard_spin,
-				new_key_size, new_lock_space, new_mutex_space, new_null_subs, new_rec_size, new_sleep_cnt,
-				new_spin_sleep, new_stdnullcoll, new_wrt_per_flu, reserved_bytes, new_full_blkwrt;
+	int			asyncio_status, blk_compress_status, crit_queue_status, defer_allocate_status, defer_status,
+				disk_wait_status, encryptable_status, encryption_complete_status, epoch_taper_status,
+				extn_count_status, fd, fn_len, glbl_buff_status, gtmcrypt_errno, hard_spin_status,
+				inst_freeze_on_error_status, io_uring_status, key_size_status, locksharesdbcrit, lock_space_status,
+				mutex_space_status, null_subs_status, qdbrundown_status, read_only_status, rec_size_status,
+				reg_exit_stat, reorg_sleep_nsec_status, rc, rsrvd_bytes_status, save_errno, sleep_cnt_status,
+				spin_sleep_status, stats_status, status, status1, stdnullcoll_status, trigger_flush_limit_status,
+				wrt_per_flu_status, full_blkwrt_status;
+	int4			defer_time, new_blk_compress, new_cache_size, new_disk_wait, new_extn_count, new_flush_trigger,
+				new_hard_spin, new_key_size, new_lock_space, new_mutex_space, new_null_subs, new_rec_size,
+				new_sleep_cnt, new_spin_sleep, new_stdnullcoll, new_wrt_per_flu, reserved_bytes, new_full_blkwrt;
 	sgmnt_data_ptr_t	csd, pvt_csd;
 	tp_region		*rptr, single;
 	unsigned short		acc_spec_len = MAX_ACC_METH_LEN, ver_spec_len = MAX_DB_VER_LEN;
@@ -173,6 +176,8 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 					    which has not yet been read */
 	if (asyncio_status = cli_present("ASYNCIO"))
 		need_standalone = TRUE;
+	if (io_uring_status = cli_present("IO_URING"))
+		need_standalone = TRUE;
 	if (defer_allocate_status = cli_present("DEFER_ALLOCATE"))
 		flush_buffers = TRUE;
 	if (encryptable_status = cli_present("ENCRYPTABLE"))
@@ -201,6 +206,32 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 		need_standalone = TRUE;
 	encryption_complete_status = cli_present("ENCRYPTIONCOMPLETE");
 	epoch_taper_status = cli_present("EPOCHTAPER");
+	crit_queue_status = cli_present("CRIT_QUEUE");
+	/* COMPRESSION does not require standalone access. Processes pick up a new level with their next block write. */
+	if (blk_compress_status = cli_present("COMPRESSION"))
+	{
+		if (CLI_NEGATED == blk_compress_status)
+			new_blk_compress = 0;
+		else if (!cli_get_int("COMPRESSION", &new_blk_compress))
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SETQUALPROB, 2, LEN_AND_LIT("COMPRESSION"));
+			exit_stat |= EXIT_ERR;
+		} else if (ZLIB_CMPLVL_MAX < new_blk_compress)
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUPIPSET2BIG, 4, new_blk_compress,
+				LEN_AND_LIT("COMPRESSION"), ZLIB_CMPLVL_MAX);
+			exit_stat |= EXIT_ERR;
+		} else if (1 > new_blk_compress)
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUPIPSET2SML, 4, new_blk_compress,
+				LEN_AND_LIT("COMPRESSION"), 1);
+			exit_stat |= EXIT_ERR;
+		} else if (!gds_blk_cmp_init())
+		{	/* zlib could not be loaded; "gtm_zlib_init" has said why */
+			util_out_print("COMPRESSION needs the zlib library", TRUE);
+			exit_stat |= EXIT_ERR;
+		}
+	}
 	/* EXTENSION_COUNT does not require standalone access and hence need_standalone will not be set to TRUE for this. */
 	if (extn_count_status = cli_present("EXTENSION_COUNT"))
 	{
@@ -864,6 +895,35 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 				reg_exit_stat |= EXIT_WRN;
 			}
 		}
+		if (CLI_PRESENT == blk_compress_status)
+		{	/* Compressed blocks are only written and read through BG and are never encrypted (see gds_blk_compress.h) */
+			if (dba_bg != access_new)
+			{
+				util_out_print("COMPRESSION cannot be specified with MM access method", TRUE);
+				util_out_print("Database file !AD not changed", TRUE, fn_len, fn);
+				reg_exit_stat |= EXIT_WRN;
+			}
+			if (USES_ENCRYPTION(csd->is_encrypted))
+			{
+				util_out_print("COMPRESSION cannot be specified for an encrypted or encryptable database", TRUE);
+				util_out_print("Database file !AD not changed", TRUE, fn_len, fn);
+				reg_exit_stat |= EXIT_WRN;
+			}
+		} else if (csd->blk_compress_used)
+		{	/* Blocks already written compressed stay so until they are next written, so keep the file BG/unencrypted */
+			if (acc_meth_changing && (dba_mm == access_new))
+			{
+				util_out_print("MM access method cannot be set on a database that has used COMPRESSION", TRUE);
+				util_out_print("Database file !AD not changed", TRUE, fn_len, fn);
+				reg_exit_stat |= EXIT_WRN;
+			}
+			if (CLI_PRESENT == encryptable_status)
+			{
+				util_out_print("ENCRYPTABLE cannot be set on a database that has used COMPRESSION", TRUE);
+				util_out_print("Database file !AD not changed", TRUE, fn_len, fn);
+				reg_exit_stat |= EXIT_WRN;
+			}
+		}
 		if (wrt_per_flu_status = (CLI_PRESENT == cli_present("WRITES_PER_FLUSH")))
 		{
 			if (cli_get_int("WRITES_PER_FLUSH", &new_wrt_per_flu))
@@ -932,6 +992,16 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 				csd->epoch_taper = (CLI_PRESENT == epoch_taper_status);
 			if (asyncio_status)
 				csd->asyncio = (CLI_PRESENT == asyncio_status);
+			if (io_uring_status)
+				csd->asyncio_uring = (CLI_PRESENT == io_uring_status);
+			if (crit_queue_status)
+				csd->crit_queue = (CLI_PRESENT == crit_queue_status);
+			if (blk_compress_status)
+			{
+				csd->blk_compress = new_blk_compress;
+				if (new_blk_compress)
+					csd->blk_compress_used = TRUE;
+			}
 			if (extn_count_status)
 				csd->extension_size = (uint4)new_extn_count;
 			change_fhead_timer_ns("FLUSH_TIME", &csd->flush_time,
@@ -963,6 +1033,15 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 					util_out_print("Database file !AD now has asyncio !AD", TRUE,
 						       fn_len, fn, LEN_AND_LIT("disabled"));
 			}
+			if (io_uring_status)
+				util_out_print("Database file !AD now has io_uring !AD", TRUE, fn_len, fn,
+					       LEN_AND_STR(csd->asyncio_uring ? "enabled" : "disabled"));
+			if (crit_queue_status)
+				util_out_print("Database file !AD now has crit queue !AD", TRUE, fn_len, fn,
+					       LEN_AND_STR(csd->crit_queue ? "enabled" : "disabled"));
+			if (blk_compress_status)
+				util_out_print("Database file !AD now has block compression level !UL", TRUE, fn_len, fn,
+					       csd->blk_compress);
 			if (CLI_NEGATED == read_only_status)
 				util_out_print("Database file !AD is no longer read-only",
 					TRUE, fn_len, fn);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -27,6 +27,9 @@
 #include "gtm_un.h"
 
 #include <errno.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #if defined(__MVS__) || defined(__linux__) || defined(__CYGWIN__)
 #include "gtm_limits.h"
 #else
@@ -110,6 +113,7 @@ MBSTART {															\
 		}														\
 		STATUS = cdb_sc_normal;												\
 		INCR_GVSTATS_COUNTER((CSA), CNL, n_crit_success, 1);								\
+		GVSTATS_HIST_ADD((CSA), CNL, h_crit, crit_start);								\
 	} else															\
 		STATUS = cdb_sc_nolock;												\
 	if ((cdb_sc_normal == STATUS) || (MUTEX_LOCK_WRITE_IMMEDIATE == (LOCK_TYPE)) || (cdb_sc_critreset == STATUS))		\
@@ -175,7 +179,13 @@ static	unsigned short	next_rand[3];
 static	int		optimistic_attempts;
 static	int		mutex_expected_wake_instance = 0;
 
-#ifndef CRIT_USE_PTHREAD_MUTEX
+#ifdef CRIT_USE_PTHREAD_MUTEX
+STATICFNDCL int4		mutex_numa_node(void);
+STATICFNDCL int			mutex_spin_slot_wait(sgmnt_addrs *csa, mutex_spin_parms_ptr_t mutex_spin_parms,
+						gtm_uint64_t *yields);
+STATICFNDCL mutex_spin_slot	*mutex_spin_slot_pick(pth_mutex_struct_ptr_t addr, uint4 *ticket);
+STATICFNDCL void		mutex_spin_slot_reap(pth_mutex_struct_ptr_t addr, mutex_spin_slot *slot, uint4 pid);
+#else
 static	enum cdb_sc	mutex_wakeup(mutex_struct_ptr_t addr, mutex_spin_parms_ptr_t mutex_spin_parms);
 #endif
 void			mutex_salvage(gd_region *reg);
@@ -642,6 +652,147 @@ static	enum cdb_sc mutex_wakeup(mutex_struct_ptr_t addr, mutex_spin_parms_ptr_t
 	} while (quant_retry_counter_remq);
 	return (cdb_sc_dbccerr); /* This will never get executed, added to make compiler happy */
 }
+#else
+/* Returns the NUMA node of the CPU this process is running on (0 if that cannot be determined) */
+STATICFNDEF int4 mutex_numa_node(void)
+{
+#	ifdef SYS_getcpu
+	unsigned int	cpu, node;
+
+	if (0 == syscall(SYS_getcpu, &cpu, &node, NULL))
+		return (int4)node;
+#	endif
+	return 0;
+}
+
+/* Waits for crit in a spin slot of the NUMA crit queue. The waiter polls its own slot until the process releasing crit hands
+ * crit to it and then tries to lock the mutex. A process that did not queue can lock the mutex between the release and the
+ * handoff, in which case the waiter goes back to polling for the next handoff. After every "mutex_hard_spin_count" polls the
+ * waiter also tries to lock the mutex if nobody holds crit, so a handoff that is lost (e.g. the releasing process died before it
+ * got to it) only delays it. Returns the status of the last "pthread_mutex_trylock": 0 or EOWNERDEAD if the mutex is now
+ * locked, EBUSY if no slot was free or the mutex could not be locked within "mutex_sleep_spin_count" rounds of polls, in which
+ * case the caller waits in "pthread_mutex_timedlock".
+ */
+STATICFNDEF int mutex_spin_slot_wait(sgmnt_addrs *csa, mutex_spin_parms_ptr_t mutex_spin_parms, gtm_uint64_t *yields)
+{
+	pth_mutex_struct_ptr_t	addr;
+	mutex_spin_slot		*slot, *slot_top;
+	int			hard_spin_cnt, sleep_spin_cnt, status;
+	uint4			ticket;
+
+	addr = csa->critical;
+	slot = &addr->spinslots[process_id % MUTEX_NUM_SPIN_SLOTS];
+	slot_top = &addr->spinslots[MUTEX_NUM_SPIN_SLOTS];
+	for (hard_spin_cnt = MUTEX_NUM_SPIN_SLOTS; !GET_SWAPLOCK(&slot->owner); )
+	{
+		if (!--hard_spin_cnt)
+			return EBUSY;		/* all slots are in use */
+		if (++slot == slot_top)
+			slot = &addr->spinslots[0];
+	}
+	/* "spin_waiters" is incremented before the slot is published and decremented after it is withdrawn so a process that
+	 * dies in between can only leave it too high, which costs the releasing process a scan of the slots but nothing else.
+	 */
+	INTERLOCK_ADD(&addr->spin_waiters, 1);
+	slot->numa_node = mutex_numa_node();
+	slot->handoff = 0;
+	do
+	{
+		ticket = INTERLOCK_ADD(&addr->spin_ticket, 1);
+	} while (!ticket);
+	SHM_WRITE_MEMORY_BARRIER;
+	slot->ticket = ticket;
+	status = EBUSY;
+	for (sleep_spin_cnt = MAX(mutex_spin_parms->mutex_sleep_spin_count, 1); ; )
+	{
+		for (hard_spin_cnt = MAX(mutex_spin_parms->mutex_hard_spin_count, 1); hard_spin_cnt; hard_spin_cnt--)
+		{
+			if (ticket != slot->handoff)
+				continue;
+			status = pthread_mutex_trylock(&addr->mutex);
+			if (EBUSY != status)
+				break;
+			slot->handoff = 0;	/* lost the handoff; wait for the next one */
+		}
+		if ((EBUSY == status) && (0 == csa->nl->in_crit))
+			status = pthread_mutex_trylock(&addr->mutex);
+		if ((EBUSY != status) || !--sleep_spin_cnt)
+			break;
+		(*yields)++;
+		GTM_REL_QUANT(mutex_spin_parms->mutex_spin_sleep_mask);
+	}
+	if (slot->owner.u.parts.latch_pid == process_id)
+	{	/* Not taken away from us by a reinitialization ("gtm_mutex_init") */
+		slot->ticket = 0;
+		INTERLOCK_ADD(&addr->spin_waiters, -1);
+		RELEASE_SWAPLOCK(&slot->owner);
+	}
+	return status;
+}
+
+/* Called by the crit holder just before it releases crit to pick the waiter in the NUMA crit queue to hand crit to.
+ * The oldest waiter on the NUMA node of this process is preferred over older waiters on other nodes, but only
+ * MUTEX_NUMA_FAIRNESS_WINDOW times in a row. A waiter that was handed crit before but did not take it is skipped and its
+ * slot is freed if its process is gone. Returns NULL if nobody waits in the queue.
+ */
+STATICFNDEF mutex_spin_slot *mutex_spin_slot_pick(pth_mutex_struct_ptr_t addr, uint4 *ticket)
+{
+	mutex_spin_slot	*local, *oldest, *slot, *slot_top;
+	int4		node;
+	uint4		local_ticket, oldest_ticket, pid, slot_ticket;
+
+	node = mutex_numa_node();
+	local = oldest = NULL;
+	local_ticket = oldest_ticket = 0;
+	for (slot = &addr->spinslots[0], slot_top = &addr->spinslots[MUTEX_NUM_SPIN_SLOTS]; slot < slot_top; slot++)
+	{
+		if (0 == (slot_ticket = slot->ticket))
+			continue;
+		if (slot_ticket == slot->handoff)
+		{	/* Already handed crit. Either it is on its way or its process is gone. */
+			pid = slot->owner.u.parts.latch_pid;
+			if ((LOCK_AVAILABLE != pid) && !is_proc_alive(pid, 0))
+				mutex_spin_slot_reap(addr, slot, pid);
+			continue;
+		}
+		/* Tickets wrap so compare their difference */
+		if ((NULL == oldest) || (0 > (int4)(slot_ticket - oldest_ticket)))
+		{
+			oldest = slot;
+			oldest_ticket = slot_ticket;
+		}
+		if ((node == slot->numa_node) && ((NULL == local) || (0 > (int4)(slot_ticket - local_ticket))))
+		{
+			local = slot;
+			local_ticket = slot_ticket;
+		}
+	}
+	if (NULL == oldest)
+		return NULL;
+	if ((NULL != local) && (local != oldest) && (MUTEX_NUMA_FAIRNESS_WINDOW > addr->handoff_streak))
+	{
+		addr->handoff_streak++;
+		*ticket = local_ticket;
+		return local;
+	}
+	addr->handoff_streak = 0;
+	*ticket = oldest_ticket;
+	return oldest;
+}
+
+/* Frees the spin slot of a process "pid" that died while waiting in the NUMA crit queue */
+STATICFNDEF void mutex_spin_slot_reap(pth_mutex_struct_ptr_t addr, mutex_spin_slot *slot, uint4 pid)
+{
+	if (!COMPSWAP_LOCK(&slot->owner, pid, process_id))
+		return;		/* somebody else reaped it */
+	if (slot->ticket)
+	{
+		slot->ticket = 0;
+		INTERLOCK_ADD(&addr->spin_waiters, -1);
+	}
+	RELEASE_SWAPLOCK(&slot->owner);
+	MUTEX_DPRINT3("%d: reaped spin slot of dead process %d\n", process_id, pid);
+}
 #endif
 
 void	gtm_mutex_init(gd_region *reg, int n, bool crash)
@@ -649,9 +800,16 @@ void	gtm_mutex_init(gd_region *reg, int n, bool crash)
 #	ifdef CRIT_USE_PTHREAD_MUTEX
 	sgmnt_addrs		*csa;
 	int4			status;
+	int			i;
 	pthread_mutexattr_t	crit_attr;
 
 	csa = &FILE_INFO(reg)->s_addrs;
+	/* Forget all processes waiting in the NUMA crit queue. They see that their slot was taken away and leave it alone. */
+	memset(&csa->critical->spinslots[0], 0, SIZEOF(csa->critical->spinslots));
+	for (i = 0; i < MUTEX_NUM_SPIN_SLOTS; i++)
+		SET_LATCH_GLOBAL(&csa->critical->spinslots[i].owner, LOCK_AVAILABLE);
+	csa->critical->spin_waiters = 0;
+	csa->critical->handoff_streak = 0;
 	if (crash)
 	{
 		pthread_mutex_unlock(&csa->critical->mutex);		/* We may not have it locked, so ignore errors. */
@@ -715,10 +873,12 @@ enum cdb_sc gtm_mutex_lock(gd_region *reg,
 	latch_t			local_crit_cycle = 0;
 	int4			local_stuck_cycle = 0;
 	uint4			timeout_count = 0;
+	gtm_uint64_t		crit_start;
 #	ifdef CRIT_USE_PTHREAD_MUTEX
 	int			status;
 	ABS_TIME 		atend;
 	struct timespec		timeout;
+	gtm_uint64_t		yields;
 #	else
 	enum cdb_sc		status;
 	boolean_t		epoch_count, try_recovery;
@@ -749,6 +909,7 @@ enum cdb_sc gtm_mutex_lock(gd_region *reg,
 	assert((MUTEX_LOCK_WRITE_IMMEDIATE == mutex_lock_type) || (MUTEX_LOCK_WRITE == mutex_lock_type));
 	assert((mutex_per_process_init_pid == process_id) || ((0 == mutex_per_process_init_pid) && in_mu_rndwn_file));
 	MUTEX_TRACE_CNTR((MUTEX_LOCK_WRITE == mutex_lock_type) ? mutex_trc_lockw : mutex_trc_lockwim);
+	crit_start = GVSTATS_HIST_START(csa);	/* start time for the h_crit latency histogram */
 #	ifdef CRIT_USE_PTHREAD_MUTEX
 	if (csa->crit_probe)
 	{
@@ -760,6 +921,23 @@ enum cdb_sc gtm_mutex_lock(gd_region *reg,
 	 */
 	UPDATE_PROC_WAIT_STATE(csa, state, 1);
 	status = pthread_mutex_trylock(&csa->critical->mutex);
+	if ((EBUSY == status) && (MUTEX_LOCK_WRITE == mutex_lock_type) && (NULL != csa->hdr) && csa->hdr->crit_queue
+		&& num_additional_processors)
+	{	/* NUMA crit queue: rather than block in the mutex, wait in a spin slot of our own for crit to be handed to us.
+		 * If that does not work out, status is still EBUSY and we do the timed lock below.
+		 */
+		INCR_GVSTATS_COUNTER(csa, cnl, n_crit_failed, 1);
+		INCR_GVSTATS_COUNTER(csa, cnl, sq_crit_failed, 1);
+		if (cnl->doing_epoch)
+			INCR_GVSTATS_COUNTER(csa, cnl, n_crits_in_epch, 1);
+		yields = 0;
+		status = mutex_spin_slot_wait(csa, mutex_spin_parms, &yields);
+		if (yields)
+		{
+			INCR_GVSTATS_COUNTER(csa, cnl, n_crit_yields, yields);
+			INCR_GVSTATS_COUNTER(csa, cnl, sq_crit_yields, yields * yields);
+		}
+	}
 	do
 	{
 		if (((EBUSY == status) && (MUTEX_LOCK_WRITE == mutex_lock_type)) || (ETIMEDOUT == status))
@@ -816,6 +994,7 @@ enum cdb_sc gtm_mutex_lock(gd_region *reg,
 					csa->probecrit_rec.p_crit_que_slps = 0;
 				}
 				INCR_GVSTATS_COUNTER(csa, cnl, n_crit_success, 1);
+				GVSTATS_HIST_ADD(csa, cnl, h_crit, crit_start);
 				csa->critical->crit_cycle++;
 				UPDATE_PROC_WAIT_STATE(csa, state, -1);
 				return cdb_sc_normal;
@@ -1130,13 +1309,25 @@ enum cdb_sc mutex_unlockw(gd_region *reg, int crash_count)
 
 	uint4		already_clear;
 	sgmnt_addrs	*csa;
+#	ifdef CRIT_USE_PTHREAD_MUTEX
+	mutex_spin_slot	*handoff_slot;
+	uint4		ticket;
+#	endif
         DCL_THREADGBL_ACCESS;
 
         SETUP_THREADGBL_ACCESS;
 	csa = &FILE_INFO(reg)->s_addrs;
 #	ifdef CRIT_USE_PTHREAD_MUTEX
+	/* With the NUMA crit queue, pick the waiter to hand crit to while still holding crit as "handoff_streak" needs that */
+	handoff_slot = ((NULL != csa->hdr) && csa->hdr->crit_queue && (0 < csa->critical->spin_waiters))
+		? mutex_spin_slot_pick(csa->critical, &ticket) : NULL;
 	pthread_mutex_unlock(&csa->critical->mutex);
 	SET_CSA_NOW_CRIT_FALSE(csa);
+	if (NULL != handoff_slot)
+	{	/* The waiter tries to lock the mutex as soon as it sees the handoff so make sure the unlock is visible first */
+		SHM_WRITE_MEMORY_BARRIER;
+		handoff_slot->handoff = ticket;
+	}
 	return cdb_sc_normal;
 #	else
 	if (crash_count != csa->critical->crashcnt)
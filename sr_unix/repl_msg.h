@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -74,7 +74,8 @@ enum
 #define	REPL_PROTO_VER_REMOTE_LOGPATH	(char)0x4	/* Versions >= V6.0-003 that send remote $CWD as part of handshake */
 #define REPL_PROTO_VER_TLS_SUPPORT	(char)0x5	/* Versions >= V6.1-000 that supports SSL/TLS communication. */
 #define REPL_PROTO_VER_XENDIANFIXES	(char)0x6	/* Versions >= V6.2-001 support cross-endian replication (GTM-8205) */
-#define	REPL_PROTO_VER_THIS		REPL_PROTO_VER_XENDIANFIXES
+#define REPL_PROTO_VER_STREAM_CMP	(char)0x7	/* Versions that can compress the replication pipe as one zlib stream */
+#define	REPL_PROTO_VER_THIS		REPL_PROTO_VER_STREAM_CMP
 							/* The current/latest version of the communication protocol between the
 							 * primary (source server) and secondary (receiver server or rollback)
 							 */
@@ -272,7 +273,11 @@ typedef struct	/* used to send messages of type REPL_CMP_TEST or REPL_CMP_SOLVE
 	int4		len;
 	int4		datalen;		   /* length of compressed or uncompressed data */
 	char		proto_ver;
-	char		filler_16[3];
+	char		cmp_stream;		   /* TRUE if the sender wants (REPL_CMP_TEST) or agrees to (REPL_CMP_SOLVE)
+						    * compress the replication pipe as one stream (see gtm_zlib_cmp_stream).
+						    * Only meaningful if proto_ver is at least REPL_PROTO_VER_STREAM_CMP.
+						    */
+	char		filler_16[2];
 	char		data[REPL_MSG_CMPDATALEN]; /* compressed (if REPL_CMP_TEST) or uncompressed (if REPL_CMP_SOLVE) data */
 	char		overflowdata[(MAX_CMP_EXPAND_FACTOR - 1) * REPL_MSG_CMPDATALEN];
 					/* buffer to hold overflow in case compression expands data */
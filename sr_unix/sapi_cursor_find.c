@@ -0,0 +1,48 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gdsroot.h"
+#include "libyottadb_int.h"
+
+GBLREF	uint4		dollar_tlevel;
+GBLREF	uint4		dollar_trestart;
+GBLREF	trans_num	tstart_local_tn;
+
+/* Routine to locate the cursor with handle "id" in TREF(sapi_cursor_list). Issues a CURSORINVALID error if there is no
+ * such cursor and a CURSORSNAPSHOT error if it is a snapshot cursor used outside the TP transaction (or TP restart) it
+ * was opened in.
+ *
+ * Parameters:
+ *   id		- Cursor handle returned by "ydb_cursor_open_s"
+ *   lydbrtn	- Routine the cursor is used by (for error messages)
+ *   ret_prev	- If non-NULL, the cursor preceding the returned one in the list (NULL if it is the first) is returned here
+ */
+sapi_cursor *sapi_cursor_find(gtm_uint64_t id, libyottadb_routines lydbrtn, sapi_cursor **ret_prev)
+{
+	sapi_cursor	*cur, *prev;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	for (prev = NULL, cur = TREF(sapi_cursor_list); (NULL != cur) && (cur->id != id); prev = cur, cur = cur->next)
+		;
+	if (NULL == cur)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(5) ERR_CURSORINVALID, 3, &id, LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
+	if (NULL != ret_prev)
+		*ret_prev = prev;
+	/* A snapshot cursor can be closed anywhere but used only inside the TP transaction it was opened in */
+	if (cur->snapshot && (LYDB_RTN_CURSOR_CLOSE != lydbrtn)
+			&& (!dollar_tlevel || (cur->tstart_tn != tstart_local_tn) || (cur->trestart != dollar_trestart)))
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_CURSORSNAPSHOT, 2, LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
+	return cur;
+}
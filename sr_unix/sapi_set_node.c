@@ -0,0 +1,128 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "lv_val.h"
+#include "hashtab_mname.h"
+#include "callg.h"
+#include "op.h"
+#include "error.h"
+#include "nametabtyp.h"
+#include "compiler.h"
+#include "namelook.h"
+#include "stringpool.h"
+#include "libyottadb_int.h"
+
+/* Sets the value of one local, global or ISV node for "ydb_set_s" and "ydb_set_many_s". Errors are issued through
+ * "rts_error_csa" so the caller must have established "ydb_simpleapi_ch". Any mstrs recorded with RECORD_MSTR_FOR_GC
+ * are released by the caller once the node has been set.
+ *
+ * Parameters:
+ *   lydbrtn	- LYDB_RTN_SET or LYDB_RTN_SET_MANY (used in error messages)
+ *   set_type	- Type of "varname" as determined by VALIDATE_VARNAME
+ *   set_svn_index - ISV opcode (if "set_type" is LYDB_VARREF_ISV)
+ *   hash_code	- Hash of the global name (if "set_type" is LYDB_VARREF_GLOBAL)
+ *   varname	- Gives name of local, global or ISV variable
+ *   subs_used	- Count of subscripts (if any else 0)
+ *   subsarray  - an array of "subs_used" subscripts (not looked at if "subs_used" is 0)
+ *   value	- Value to be set into local/global/ISV (NULL is treated as the null string)
+ */
+void sapi_set_node(libyottadb_routines lydbrtn, ydb_var_types set_type, int set_svn_index, int hash_code,
+			const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value)
+{
+	gparam_list	plist;
+	ht_ent_mname	*tabent;
+	lv_val		*lvvalp, *dst_lv;
+	mname_entry	var_mname;
+	mval		set_value, gvname, plist_mvals[YDB_MAX_SUBS + 1];
+	ydb_buffer_t	null_ydb_buff;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	if (NULL == value)
+	{	/* Treat it as the null string */
+		null_ydb_buff.len_used = 0;
+		null_ydb_buff.len_alloc = 0;
+		null_ydb_buff.buf_addr = NULL;
+		value = &null_ydb_buff;
+	} else
+	{
+		if (IS_INVALID_YDB_BUFF_T(value))
+			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+				      LEN_AND_LIT("Invalid value"), LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
+		CHECK_MAX_STR_LEN(value);		/* Generates error is value is too long */
+	}
+	/* Separate actions depending on the type of SET being done */
+	switch(set_type)
+	{
+		case LYDB_VARREF_LOCAL:
+			/* Set the given local variable with the given value.
+			 *
+			 * Note need to rebuffer EVERYTHING - the varname, subscripts and of course value are all potentially
+			 * copied via saving name and address.
+			 */
+			FIND_BASE_VAR_UPD(varname, &var_mname, tabent, lvvalp);	/* Locate the base var lv_val in curr_symval */
+			if (0 == subs_used)
+				/* If no subscripts, this is where to store the value */
+				dst_lv = lvvalp;
+			else
+			{	/* We have some subscripts - load the varname lv_val and the subscripts into our array for callg
+				 * so we can drive "op_putindx" to locate the mval associated with those subscripts that need to
+				 * be set.
+				 */
+				plist.arg[0] = lvvalp;				/* First arg is lv_val of the base var */
+				/* Setup plist (which would point to plist_mvals[] array) for callg invocation of op_putindx */
+				COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, TRUE, 1,
+											LYDBRTNNAME(lydbrtn));
+				dst_lv = (lv_val *)callg((callgfnptr)op_putindx, &plist);	/* Locate/create node */
+			}
+			SET_MVAL_FROM_YDB_BUFF_T(&dst_lv->v, value);	/* Set value into located/created node */
+			s2pool(&(dst_lv->v.str));			/* Rebuffer in stringpool for protection */
+			break;
+		case LYDB_VARREF_GLOBAL:
+			/* Set the given global variable with the given value. We do this by:
+			 *   1. Drive "op_gvname_fast" with the global name and all subscripts to setup the key we need to access
+			 *      the global node.
+			 *   2. Drive "op_gvput" to place value into target global node
+			 * Note no need to rebuffer the inputs here as they won't live in the stringpool once set.
+			 */
+			gvname.mvtype = MV_STR;
+			gvname.str.addr = varname->buf_addr + 1;	/* Point past '^' to var name */
+			gvname.str.len = varname->len_used - 1;
+			plist.arg[0] = (void *)(INTPTR_T)hash_code;
+			plist.arg[1] = &gvname;
+			/* Setup plist (which would point to plist_mvals[] array) for callg invocation of op_gvname_fast */
+			COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, FALSE, 2,
+											LYDBRTNNAME(lydbrtn));
+			callg((callgfnptr)op_gvname_fast, &plist);	/* Drive "op_gvname_fast" to create key */
+			SET_MVAL_FROM_YDB_BUFF_T(&set_value, value);	/* Put value to set into mval for "op_gvput" */
+			INIT_MVAL_BEFORE_USE_IN_M_CODE(&set_value);	/* Do additional initialization of result mval as it could
+									 * be used in database trigger M code (if one gets driven).
+									 */
+			op_gvput(&set_value);				/* Save the global value */
+			break;
+		case LYDB_VARREF_ISV:
+			/* Set the given ISV (subscripts not currently supported) with the given value.
+			 * Note need to rebuffer the input value as the addr/length are directly copied in many cases.
+			 */
+			SET_MVAL_FROM_YDB_BUFF_T(&set_value, value);	/* Setup mval with target value */
+			s2pool(&set_value.str);				/* Rebuffer in stringpool for protection */
+			RECORD_MSTR_FOR_GC(&set_value.str);
+			op_svput(set_svn_index, &set_value);
+			break;
+		default:
+			assertpro(FALSE);
+	}
+}
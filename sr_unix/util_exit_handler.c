@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -75,13 +75,8 @@ void util_exit_handler()
 					 * unneeded cache recovery. However, if this *IS* an error condition, we leave crit
 					 * alone and let secshr_db_clnup() deal with it appropriately.
 					 */
-					if ((0 == severity) && !csa->lock_crit_with_db && LOCK_CRIT_HELD(csa))
-					{
-						mlk_pvtctl	pctl;
-
-						MLK_PVTCTL_INIT(pctl, reg);
-						REL_LOCK_CRIT(pctl, FALSE);
-					}
+					if ((0 == severity) && !csa->lock_crit_with_db)
+						REL_HELD_LOCK_CRIT(reg);
 					if ((0 == severity) && csa->now_crit)
 						rel_crit(reg);
 				}
@@ -3,7 +3,7 @@
  * Copyright (c) 2016-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -402,6 +402,7 @@ int	wcs_wtfini(gd_region *reg, boolean_t do_is_proc_alive_check, cache_rec_ptr_t
 				dbg_wtfini_lcnt, epid);
 		}
 	}
+	AIO_SHIM_SUBMIT(reg);	/* submit writes reissued by "wcs_wt_restart" above (if "asyncio_uring") in one batch */
 	cnl->wtfini_in_prog = 0;
 	wtfini_in_prog--;
 	assert(0 <= wtfini_in_prog);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -73,6 +73,7 @@
 #include "sleep_cnt.h"
 #include "gtm_c_stack_trace.h"
 #include "relqop.h"
+#include "gds_blk_compress.h"
 
 
 #ifdef DEBUG
@@ -136,6 +137,8 @@ error_def(ERR_TEXT);
 int4	wcs_wtstart(gd_region *region, int4 writes, wtstart_cr_list_t *cr_list_ptr, cache_rec_ptr_t cr2flush)
 {
 	blk_hdr_ptr_t		bp, save_bp;
+	sm_uc_ptr_t		cmp_bp;
+	int			cmp_size;
 	boolean_t               need_jnl_sync, queue_empty, got_lock, bmp_status, do_asyncio, wtfini_called_once;
 	cache_que_head_ptr_t	ahead, whead;
 	cache_state_rec_ptr_t	csr, csrfirst;
@@ -723,8 +726,26 @@ int4	wcs_wtstart(gd_region *region, int4 writes, wtstart_cr_list_t *cr_list_ptr,
 #endif
 				offset = BLK_ZERO_OFF(csd->start_vbn) + (off_t)csr->blk * csd->blk_size;
 				if (!do_asyncio)
-				{
-					DB_LSEEKWRITE(csa, udi, udi->fn, udi->fd, offset, save_bp, size, save_errno);
+				{	/* With MUPIP SET -COMPRESSION, write the block compressed if that leaves OS pages of its
+					 * slot unused and give those back to the file system (see gds_blk_compress.h). Encrypted
+					 * and downgraded blocks are never compressed and neither are bitmaps, which are small.
+					 */
+					cmp_bp = NULL;
+					if (csd->blk_compress && (save_bp == bp) && ((blk_hdr_ptr_t)reformat_buffer != bp)
+							&& (LCL_MAP_LEVL != bp->levl)
+							&& gds_blk_cmp_saves(offset, SIZEOF(blk_cmp_hdr) + 1, (int)size))
+						cmp_bp = gds_blk_compress(bp, csd->blk_size, csd->blk_compress,
+								udi->fd_opened_with_o_direct ? DIO_ALIGNSIZE(udi) : 8, &cmp_size);
+					if ((NULL != cmp_bp) && gds_blk_cmp_saves(offset, cmp_size, (int)size))
+					{
+						DB_LSEEKWRITE(csa, udi, udi->fn, udi->fd, offset, cmp_bp, cmp_size, save_errno);
+						if (0 == save_errno)
+						{
+							gds_blk_punch(udi->fd, offset, cmp_size, csd->blk_size);
+							INCR_GVSTATS_COUNTER(csa, cnl, n_blk_cmp_write, 1);
+						}
+					} else
+						DB_LSEEKWRITE(csa, udi, udi->fn, udi->fd, offset, save_bp, size, save_errno);
 					csr->needs_first_write = FALSE;
 				} else
 				{
@@ -827,6 +848,8 @@ int4	wcs_wtstart(gd_region *region, int4 writes, wtstart_cr_list_t *cr_list_ptr,
 			WCS_OPS_TRACE(csa, process_id, wcs_ops_wtstart8, cr->blk, GDS_ANY_ABS2REL(csa,cr), cr->dirty, n, 0);
 	}
 	csa->wbuf_dqd--;
+	if (csd->asyncio)
+		AIO_SHIM_SUBMIT(region);	/* submit writes queued above (if "asyncio_uring") in one batch */
 writes_completed:
 	DEBUG_ONLY(
 		if (0 == n2)
@@ -0,0 +1,55 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_stdlib.h"
+
+#include "libyottadb_int.h"
+
+/* Routine to close a cursor opened by "ydb_cursor_open_s" and release its resources. The handle is not valid after this.
+ *
+ * Parameters:
+ *   cursor	- Handle returned by "ydb_cursor_open_s"
+ */
+int ydb_cursor_close_s(uint64_t cursor)
+{
+	boolean_t	error_encountered;
+	sapi_cursor	*cur, *prev;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_CURSOR_CLOSE, (int));	/* Note: macro could "return" from this function in case of errors */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	cur = sapi_cursor_find(cursor, LYDB_RTN_CURSOR_CLOSE, &prev);
+	if (NULL == prev)
+		TREF(sapi_cursor_list) = cur->next;
+	else
+		prev->next = cur->next;
+	free(cur->key);
+	if (NULL != cur->hist)
+		free(cur->hist);
+	free(cur);
+	LIBYOTTADB_DONE;
+	REVERT;
+	return YDB_OK;
+}
@@ -0,0 +1,45 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "libyottadb_int.h"
+
+GBLREF	boolean_t	caller_func_is_stapi;
+
+/* Routine to drive ydb_cursor_close_s() in a worker thread so YottaDB access is isolated. Note because this drives
+ * ydb_cursor_close_s(), we don't do any of the exclusive access checks here. The one exception to this is that we need to make
+ * sure the run time is alive.
+ *
+ * Parms and return - same as ydb_cursor_close_s() except for the addition of tptoken and errstr.
+ */
+int ydb_cursor_close_st(uint64_t tptoken, ydb_buffer_t *errstr, uint64_t cursor)
+{
+	libyottadb_routines	save_active_stapi_rtn;
+	ydb_buffer_t		*save_errstr;
+	boolean_t		get_lock;
+	int			retval;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	LIBYOTTADB_RUNTIME_CHECK((int), errstr);
+	VERIFY_THREADED_API((int), errstr);
+	threaded_api_ydb_engine_lock(tptoken, errstr, LYDB_RTN_CURSOR_CLOSE, &save_active_stapi_rtn, &save_errstr, &get_lock,
+					&retval);
+	if (YDB_OK == retval)
+	{
+		caller_func_is_stapi = TRUE;	/* used to inform below SimpleAPI call that caller is SimpleThreadAPI */
+		retval = ydb_cursor_close_s(cursor);
+		threaded_api_ydb_engine_unlock(tptoken, errstr, save_active_stapi_rtn, save_errstr, get_lock);
+	}
+	return retval;
+}
@@ -0,0 +1,237 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "op.h"
+#include "gvcst_protos.h"	/* for gvcst_queryget prototype */
+#include "libyottadb_int.h"
+#include "outofband.h"
+
+GBLREF	volatile int4	outofband;
+GBLREF	gd_region	*gv_cur_region;
+GBLREF	gv_key		*gv_currkey, *gv_altkey;
+GBLREF	gv_namehead	*gv_target;
+GBLREF	uint4		dollar_tlevel;
+
+/* Copy of the "gv_target" clue (and the search history it goes with) of the last node a cursor returned */
+typedef struct sapi_cursor_hist_struct
+{
+	gv_namehead	*gvt;		/* "gv_target" the clue was copied from */
+	sgmnt_addrs	*csa;		/* "gvt->gd_csa" when the clue was copied */
+	block_id	root;		/* "gvt->root" when the clue was copied */
+	trans_num	wcs_recover_tn;	/* "cnl->last_wcs_recover_tn" when the clue was copied */
+	uint4		onln_rlbk_cycle;	/* "cnl->onln_rlbk_cycle" when the clue was copied */
+	uint4		root_search_cycle;	/* "cnl->root_search_cycle" when the clue was copied */
+	srch_hist	hist;		/* copy of "gvt->hist" */
+	int		keys_len;	/* # of bytes in "keys" */
+	char		keys[];		/* copy of "gvt->clue", "gvt->first_rec" and "gvt->last_rec" (contiguous in a gv_target) */
+} sapi_cursor_hist;
+
+/* # of bytes the "clue", "first_rec" and "last_rec" keys of a gv_target take up (see "targ_alloc") */
+#define	GVT_CLUE_KEYS_LEN(GVT)	(3 * (SIZEOF(gv_key) + (GVT)->clue.top))
+
+STATICFNDCL void sapi_cursor_hist_restore(sapi_cursor *cur);
+STATICFNDCL void sapi_cursor_hist_save(sapi_cursor *cur);
+
+/* Routine to return the next batch of nodes of a cursor opened by "ydb_cursor_open_s".
+ *
+ * The cursor keeps the database key of the last node returned. Each node is fetched with one $QUERY/$GET pass
+ * ("gvcst_queryget") starting from that key so, unlike a "ydb_node_next_s" + "ydb_get_s" loop, the caller does not pass
+ * back (and the runtime does not rebuild a key from) the previous node's subscripts, and the value comes from the same
+ * leaf block search as the key. Consecutive nodes are mostly in the same leaf block, which "gvcst_search" finds through
+ * the "gv_target" clue without traversing the tree from the root. Each cursor keeps its own copy of that clue and
+ * search history from its last node and puts it back in "gv_target" at the start of the next call. So the caller's other
+ * references to the same global between calls do not make the cursor traverse the tree again. As with any clue,
+ * "gvcst_search" validates every block in that history (its transaction number and cache record cycle) before using it
+ * and does a full traversal if a block changed. This is done only outside TP and for globals that do not span regions.
+ *
+ * Parameters:
+ *   cursor	- Handle returned by "ydb_cursor_open_s"
+ *   ret_count	- on input : Number of entries in "ret_nodes"
+ *		  on output: Number of entries in "ret_nodes" filled in
+ *   ret_nodes	- Array of nodes. For each node returned, "subs_used"/"subsarray" (with "subs_used" the number of
+ *		  entries in "subsarray" on input) and "value" are filled in and "status" is set to YDB_OK.
+ *		  "varname" is not used.
+ *
+ * Returns YDB_OK if at least one node was returned and YDB_ERR_NODEEND if the cursor has no more nodes. If a node does
+ * not fit in its buffers (INVSTRLEN/INSUFFSUBS error), "*ret_count" has the number of nodes returned before it and the
+ * next call resumes with that node so the caller can retry it with bigger buffers. A cursor opened without
+ * YDB_CURSOR_SNAPSHOT is not repositioned by a TP restart.
+ */
+int ydb_cursor_next_s(uint64_t cursor, int *ret_count, ydb_node_t *ret_nodes)
+{
+	boolean_t	error_encountered, found;
+	gvnh_reg_t	*gvnh_reg;
+	int		max_count, status;
+	mval		gvname, val;
+	sapi_cursor	*cur;
+	ydb_node_t	*node;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_CURSOR_NEXT, (int));	/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_query_node_subs_cnt));	/* should have been cleared by "ydb_simpleapi_ch" */
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* Should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	/* Do some validation */
+	if (NULL == ret_count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_count"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT)));
+	if (0 >= *ret_count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("Non-positive *ret_count"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT)));
+	if (NULL == ret_nodes)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_nodes"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT)));
+	cur = sapi_cursor_find(cursor, LYDB_RTN_CURSOR_NEXT, NULL);
+	max_count = *ret_count;
+	*ret_count = 0;
+	gvnh_reg = NULL;
+	if (!cur->at_end)
+	{	/* Bind the global name. The key built here is replaced below with the cursor position. */
+		gvname.mvtype = MV_STR;
+		gvname.str.addr = cur->name;
+		gvname.str.len = cur->name_len;
+		op_gvname_fast(VARLSTCNT(2) (INTPTR_T)cur->hash_code, &gvname);
+		gvnh_reg = TREF(gd_targ_gvnh_reg);
+		if ((dba_bg != REG_ACC_METH(gv_cur_region)) && (dba_mm != REG_ACC_METH(gv_cur_region)))
+			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_GVNUNSUPPORTED, 4, cur->name_len, cur->name,
+				LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT)));
+		if ((NULL == gvnh_reg) && !dollar_tlevel)
+			sapi_cursor_hist_restore(cur);
+	}
+	for (node = ret_nodes; !cur->at_end && (*ret_count < max_count); node++)
+	{
+		assert(gv_currkey->top >= cur->key->end);
+		COPY_KEY(gv_currkey, cur->key);
+		/* If the global spans multiple regions, determine gv_cur_region/gv_target/gd_targ_* based on the key */
+		GV_BIND_SUBSNAME_FROM_GVNH_REG_IF_GVSPAN(gvnh_reg, (TREF(gd_targ_addr)), gv_currkey);
+		if (cur->started)
+			GVKEY_INCREMENT_QUERY(gv_currkey);	/* look for the node after the last one returned */
+		if (NULL == gvnh_reg)
+			found = ((0 != gv_target->root) ? gvcst_queryget(&val) : FALSE); /* global does not exist if root is 0 */
+		else
+			INVOKE_GVCST_SPR_XXX(gvnh_reg, found = gvcst_spr_queryget(&val));
+		if (!found || (gv_altkey->end < cur->prefix_len) || memcmp(gv_altkey->base, cur->key->base, cur->prefix_len))
+		{	/* No more nodes under the subtree the cursor was opened on */
+			cur->at_end = TRUE;
+			break;
+		}
+		/* Copy the value first. "sapi_save_targ_key_subscr_nodes" can garbage collect the stringpool "val" is in. */
+		SET_YDB_BUFF_T_FROM_MVAL(&node->value, &val, "NULL ret_nodes->value.buf_addr", LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT));
+		sapi_save_targ_key_subscr_nodes();
+		sapi_return_subscr_nodes(&node->subs_used, node->subsarray, (char *)LYDBRTNNAME(LYDB_RTN_CURSOR_NEXT));
+		TREF(sapi_query_node_subs_cnt) = 0;
+		node->status = YDB_OK;
+		/* Node fully returned. Move the cursor past it. */
+		COPY_KEY(cur->key, gv_altkey);
+		cur->started = TRUE;
+		(*ret_count)++;
+	}
+	if (*ret_count && (NULL == gvnh_reg) && !dollar_tlevel)
+		sapi_cursor_hist_save(cur);
+	status = (*ret_count) ? YDB_OK : YDB_ERR_NODEEND;
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* the counter should have never become non-zero in this function */
+	LIBYOTTADB_DONE;
+	REVERT;
+	return status;
+}
+
+/* Puts the clue and search history saved by "sapi_cursor_hist_save" back in "gv_target" if they are of this "gv_target".
+ * The runtime throws away clues on purpose after an online rollback (which can take the database transaction number back so
+ * "gvcst_search" cannot tell a stale history from a valid one), a "wcs_recover" or a root block move, and when it frees a
+ * "gv_target" (whose memory a new one can reuse). So the saved history is discarded if any of that happened since it was saved.
+ */
+STATICFNDEF void sapi_cursor_hist_restore(sapi_cursor *cur)
+{
+	node_local_ptr_t	cnl;
+	sapi_cursor_hist	*hist;
+	sgmnt_addrs		*csa;
+
+	hist = cur->hist;
+	if (NULL == hist)
+		return;
+	csa = gv_target->gd_csa;
+	cnl = (NULL != csa) ? csa->nl : NULL;
+	if ((hist->gvt != gv_target) || (hist->csa != csa) || (NULL == cnl) || (hist->root != gv_target->root)
+		|| (hist->onln_rlbk_cycle != cnl->onln_rlbk_cycle) || (hist->root_search_cycle != cnl->root_search_cycle)
+		|| (hist->wcs_recover_tn != cnl->last_wcs_recover_tn) || (hist->keys_len != GVT_CLUE_KEYS_LEN(gv_target)))
+	{
+		free(hist);
+		cur->hist = NULL;
+		return;
+	}
+	memcpy(&gv_target->clue, hist->keys, hist->keys_len);
+	memcpy(&gv_target->hist, &hist->hist, SIZEOF(srch_hist));
+	GVT_CLUE_INVALIDATE_PREV_KEY(gv_target);	/* "prev_key" is not saved (only $ZPREVIOUS uses it) */
+	DEBUG_GVT_CLUE_VALIDATE(gv_target);
+}
+
+/* Saves the "gv_target" clue and search history left behind by the search for the last node the cursor returned */
+STATICFNDEF void sapi_cursor_hist_save(sapi_cursor *cur)
+{
+	node_local_ptr_t	cnl;
+	sapi_cursor_hist	*hist;
+	sgmnt_addrs		*csa;
+	int			keys_len;
+
+	csa = gv_target->gd_csa;
+	if (!gv_target->clue.end || (NULL == csa) || (NULL == csa->nl))
+		return;
+	cnl = csa->nl;
+	assert(((char *)gv_target->first_rec == (char *)&gv_target->clue + SIZEOF(gv_key) + gv_target->clue.top)
+		&& ((char *)gv_target->last_rec == (char *)gv_target->first_rec + SIZEOF(gv_key) + gv_target->clue.top));
+	keys_len = GVT_CLUE_KEYS_LEN(gv_target);
+	hist = cur->hist;
+	if ((NULL != hist) && (hist->keys_len != keys_len))
+	{
+		free(hist);
+		hist = cur->hist = NULL;
+	}
+	if (NULL == hist)
+	{
+		hist = cur->hist = (sapi_cursor_hist *)malloc(SIZEOF(sapi_cursor_hist) + keys_len);
+		hist->keys_len = keys_len;
+	}
+	hist->gvt = gv_target;
+	hist->csa = csa;
+	hist->root = gv_target->root;
+	hist->onln_rlbk_cycle = cnl->onln_rlbk_cycle;
+	hist->root_search_cycle = cnl->root_search_cycle;
+	hist->wcs_recover_tn = cnl->last_wcs_recover_tn;
+	memcpy(&hist->hist, &gv_target->hist, SIZEOF(srch_hist));
+	memcpy(hist->keys, &gv_target->clue, keys_len);
+}
@@ -0,0 +1,130 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+
+#include "hashtab_mname.h"
+#include "callg.h"
+#include "op.h"
+#include "error.h"
+#include "nametabtyp.h"
+#include "namelook.h"
+#include "libyottadb_int.h"
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "gvt_inline.h"
+#include "stringpool.h"
+#include "outofband.h"
+
+GBLREF	volatile int4	outofband;
+GBLREF	gv_key		*gv_currkey;
+GBLREF	uint4		dollar_tlevel;
+GBLREF	uint4		dollar_trestart;
+GBLREF	trans_num	tstart_local_tn;
+
+/* Routine to open a cursor over a global variable node and all its descendants. The nodes are returned (in collation
+ * order, starting with the given node itself if it has a value) by "ydb_cursor_next_s" until the cursor is closed by
+ * "ydb_cursor_close_s".
+ *
+ * Parameters:
+ *   varname	- Gives name of global variable
+ *   subs_used	- Count of subscripts (if any else 0) of the node whose subtree is to be walked
+ *   subsarray	- an array of "subs_used" subscripts (not looked at if "subs_used" is 0)
+ *   flags	- 0 or YDB_CURSOR_SNAPSHOT. A snapshot cursor can only be opened and used inside a TP transaction. Its reads
+ *		  are part of the transaction and so are validated at commit time like any other read in the transaction.
+ *		  Using it in another transaction (or after a TP restart) issues a CURSORSNAPSHOT error.
+ *   ret_cursor	- Handle of the cursor is returned here
+ */
+int ydb_cursor_open_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, unsigned int flags,
+			uint64_t *ret_cursor)
+{
+	boolean_t	error_encountered;
+	gparam_list	plist;
+	int		hash_code, open_svn_index;
+	mval		gvname, plist_mvals[YDB_MAX_SUBS + 1];
+	sapi_cursor	*cur;
+	ydb_var_types	open_type;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_CURSOR_OPEN, (int));	/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* Should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	/* Do some validation */
+	VALIDATE_VARNAME(varname, subs_used, FALSE, LYDB_RTN_CURSOR_OPEN, -1, open_type, open_svn_index);
+	if (LYDB_VARREF_GLOBAL != open_type)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("Non-global varname"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_OPEN)));
+	if (NULL == ret_cursor)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_cursor"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_OPEN)));
+	if (flags & ~(unsigned int)YDB_CURSOR_SNAPSHOT)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("Invalid flags"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_OPEN)));
+	if ((flags & YDB_CURSOR_SNAPSHOT) && !dollar_tlevel)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_CURSORSNAPSHOT, 2, LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_CURSOR_OPEN)));
+	/* Drive "op_gvname_fast" with the global name and all subscripts to set up the start key. This also checks the
+	 * subscripts (e.g. KEY2BIG, GVSUBOFLOW) so "ydb_cursor_next_s" does not have to.
+	 */
+	SAPI_GVNAME_HASH(varname, open_type, hash_code);
+	gvname.mvtype = MV_STR;
+	gvname.str.addr = varname->buf_addr + 1;	/* Point past '^' to var name */
+	gvname.str.len = varname->len_used - 1;
+	plist.arg[0] = (void *)(INTPTR_T)hash_code;
+	plist.arg[1] = &gvname;
+	COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, FALSE, 2, LYDBRTNNAME(LYDB_RTN_CURSOR_OPEN));
+	callg((callgfnptr)op_gvname_fast, &plist);
+	cur = (sapi_cursor *)malloc(SIZEOF(sapi_cursor));
+	memset(cur, 0, SIZEOF(sapi_cursor));
+	assert(SIZEOF(cur->name) >= gvname.str.len);
+	memcpy(cur->name, gvname.str.addr, gvname.str.len);
+	cur->name_len = gvname.str.len;
+	cur->hash_code = hash_code;
+	GVKEY_INIT(cur->key, DBKEYSIZE(MAX_KEY_SZ));
+	COPY_KEY(cur->key, gv_currkey);
+	cur->prefix_len = gv_currkey->end;	/* all descendants share the key up to (not including) the final KEY_DELIMITER */
+	if (flags & YDB_CURSOR_SNAPSHOT)
+	{
+		cur->snapshot = TRUE;
+		cur->tstart_tn = tstart_local_tn;
+		cur->trestart = dollar_trestart;
+	}
+	cur->id = ++(TREF(sapi_cursor_last_id));
+	cur->next = TREF(sapi_cursor_list);
+	TREF(sapi_cursor_list) = cur;
+	*ret_cursor = cur->id;
+	LIBYOTTADB_DONE;
+	REVERT;
+	return YDB_OK;
+}
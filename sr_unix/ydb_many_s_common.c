@@ -0,0 +1,266 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+#include "gtm_ctype.h"
+
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "hashtab_mname.h"
+#include "error.h"
+#include "nametabtyp.h"
+#include "namelook.h"
+#include "libyottadb_int.h"
+#include "outofband.h"
+#include "min_max.h"
+
+GBLREF	gd_addr		*gd_header;
+GBLREF	volatile int4	outofband;
+
+/* One entry per node passed to "ydb_get_many_s"/"ydb_set_many_s" */
+typedef struct
+{
+	ydb_node_t	*node;
+	int		index;		/* index of "node" in the caller's array (used to keep the sort stable) */
+	ydb_var_types	type;
+	int		svn_index;	/* ISV opcode (if "type" is LYDB_VARREF_ISV) */
+	int		hash_code;	/* hash of the global name (if "type" is LYDB_VARREF_GLOBAL) */
+	boolean_t	same_gvn;	/* TRUE if this and the previous node are of the same global variable */
+} many_node;
+
+STATICFNDCL boolean_t many_gvn_one_region(many_node *mn);
+STATICFNDCL int many_node_cmp(const void *n1, const void *n2);
+STATICFNDCL int many_subs_cmp(const ydb_buffer_t *s1, const ydb_buffer_t *s2);
+
+/* Common routine for "ydb_get_many_s" and "ydb_set_many_s". Fetches/sets "count" nodes inside one engine entry so the
+ * "LIBYOTTADB_INIT"/condition handler setup, outofband check and the name hashing is done once per call instead of once
+ * per node. SETs are done strictly in the caller's order. GETs are too, except that a run of consecutive nodes of the
+ * same global variable is sorted by subscripts once its first node has bound the global to a region, and only if the
+ * global does not span regions. Consecutive references in such a run are then to neighbouring keys and reuse the
+ * "gv_target" of the previous reference (and the block history "gvcst_search" keeps in it) instead of searching from the
+ * root block. SETs are not sorted as a trigger or the application can depend on the order of the updates.
+ *
+ * Every node gets its own status code. An error in one node (e.g. GVUNDEF, INVSTRLEN) does not stop the processing of the
+ * other nodes. A TP restart does : the remaining nodes get YDB_TP_RESTART as their status and so does the call.
+ *
+ * Parameters:
+ *   lydbrtn	- LYDB_RTN_GET_MANY or LYDB_RTN_SET_MANY
+ *   count	- Number of entries in "nodes"
+ *   nodes	- Array of nodes to get/set
+ *
+ * Returns YDB_OK if all nodes were processed without errors. Otherwise, the status of the first node (in "nodes" order)
+ * that failed. Errors with the parameters themselves (e.g. a NULL "nodes") are returned without setting any status.
+ */
+int ydb_many_s_common(libyottadb_routines lydbrtn, int count, ydb_node_t *nodes)
+{
+	boolean_t	error_encountered, is_get;
+	int		i, nvalid, run_end, status;
+	many_node	*list, *mn, *prev;
+	ydb_node_t	*node;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	assert((LYDB_RTN_GET_MANY == lydbrtn) || (LYDB_RTN_SET_MANY == lydbrtn));
+	is_get = (LYDB_RTN_GET_MANY == lydbrtn);
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(lydbrtn, (int));		/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	if (0 > count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("Negative count"), LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
+	if (!count)
+	{
+		LIBYOTTADB_DONE;
+		REVERT;
+		return YDB_OK;
+	}
+	if (NULL == nodes)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL nodes"), LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
+	REVERT;
+	list = (many_node *)malloc(SIZEOF(many_node) * count);
+	/* Validate the names. Nodes that fail validation get their error as status and are not processed further. */
+	for (i = 0, nvalid = 0; i < count; i++)
+	{
+		node = &nodes[i];
+		mn = &list[nvalid];
+		ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+		if (error_encountered)
+		{
+			REVERT;
+			assert(ERR_TPRETRY != SIGNAL);
+			node->status = -(TREF(ydb_error_code));
+			TREF(libyottadb_active_rtn) = lydbrtn;	/* "ydb_simpleapi_ch" did LIBYOTTADB_DONE; redo that part of
+								 * LIBYOTTADB_INIT for the remaining nodes.
+								 */
+			continue;
+		}
+		VALIDATE_VARNAME(&node->varname, node->subs_used, !is_get, lydbrtn, -1, mn->type, mn->svn_index);
+		REVERT;
+		mn->node = node;
+		mn->index = i;
+		node->status = YDB_OK;
+		nvalid++;
+	}
+	/* Hash each global name once per run of consecutive nodes of that global */
+	for (mn = list, prev = NULL; mn < &list[nvalid]; prev = mn++)
+	{
+		mn->same_gvn = ((NULL != prev) && (LYDB_VARREF_GLOBAL == mn->type) && (LYDB_VARREF_GLOBAL == prev->type)
+				&& (prev->node->varname.len_used == mn->node->varname.len_used)
+				&& !memcmp(prev->node->varname.buf_addr, mn->node->varname.buf_addr, mn->node->varname.len_used));
+		if (mn->same_gvn)
+			mn->hash_code = prev->hash_code;
+		else
+			SAPI_GVNAME_HASH(&mn->node->varname, mn->type, mn->hash_code);
+	}
+	for (i = 0, run_end = 0; i < nvalid; i++)
+	{
+		mn = &list[i];
+		node = mn->node;
+		ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+		if (error_encountered)
+		{
+			REVERT;
+			assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
+			if (ERR_TPRETRY == SIGNAL)
+			{	/* The transaction has to be restarted so the rest of the nodes are moot. "ydb_simpleapi_ch"
+				 * did LIBYOTTADB_DONE already.
+				 */
+				for ( ; i < nvalid; i++)
+					list[i].node->status = YDB_TP_RESTART;
+				free(list);
+				return YDB_TP_RESTART;
+			}
+			node->status = -(TREF(ydb_error_code));
+			TREF(libyottadb_active_rtn) = lydbrtn;	/* see comment in the validation loop above */
+			continue;
+		}
+		if (is_get)
+			sapi_get_node(lydbrtn, mn->type, mn->svn_index, mn->hash_code,
+					&node->varname, node->subs_used, node->subsarray, &node->value);
+		else
+		{
+			sapi_set_node(lydbrtn, mn->type, mn->svn_index, mn->hash_code,
+					&node->varname, node->subs_used, node->subsarray, &node->value);
+			TREF(sapi_mstrs_for_gc_indx) = 0; /* mstrs added by RECORD_MSTR_FOR_GC no longer need to be protected */
+		}
+		REVERT;
+		if (!is_get || (i < run_end))
+			continue;
+		/* First node of a run of GETs processed fine. Now that the global is bound, sort the rest of the run if it all
+		 * maps to the region of this node.
+		 */
+		for (run_end = i + 1; (run_end < nvalid) && list[run_end].same_gvn; run_end++)
+			;
+		if (((i + 2) < run_end) && many_gvn_one_region(mn))
+			qsort(&list[i + 1], run_end - i - 1, SIZEOF(many_node), many_node_cmp);
+	}
+	free(list);
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));
+	LIBYOTTADB_DONE;
+	for (i = 0, status = YDB_OK; (i < count) && (YDB_OK == status); i++)
+		status = nodes[i].status;
+	return status;
+}
+
+/* Returns TRUE if the global variable of node "mn", just bound by processing that node, does not span regions in the
+ * current global directory, i.e. all its nodes map to one region.
+ */
+STATICFNDEF boolean_t many_gvn_one_region(many_node *mn)
+{
+	ht_ent_mname	*tabent;
+	mname_entry	gvent;
+
+	assert(LYDB_VARREF_GLOBAL == mn->type);
+	if (NULL == gd_header)
+		return FALSE;
+	gvent.var_name.addr = mn->node->varname.buf_addr + 1;	/* Point past '^' to var name */
+	gvent.var_name.len = mn->node->varname.len_used - 1;
+	gvent.hash_code = mn->hash_code;
+	gvent.marked = FALSE;
+	tabent = (ht_ent_mname *)lookup_hashtab_mname((hash_table_mname *)gd_header->tab_ptr, &gvent);
+	return ((NULL != tabent) && (NULL == ((gvnh_reg_t *)tabent->value)->gvspan));
+}
+
+/* qsort comparison routine ordering nodes of one global variable by subscripts. Ties are broken by the position in the
+ * caller's array so multiple sets of the same node are done in the order the caller specified them.
+ */
+STATICFNDEF int many_node_cmp(const void *n1, const void *n2)
+{
+	const many_node		*mn1, *mn2;
+	int			i, nsubs, ret;
+
+	mn1 = (const many_node *)n1;
+	mn2 = (const many_node *)n2;
+	assert(mn1->same_gvn && mn2->same_gvn);
+	nsubs = MIN(mn1->node->subs_used, mn2->node->subs_used);
+	for (i = 0; i < nsubs; i++)
+	{
+		if ((NULL == mn1->node->subsarray) || (NULL == mn2->node->subsarray))
+			break;		/* SUBSARRAYNULL error will be issued when the node is processed */
+		if ((ret = many_subs_cmp(&mn1->node->subsarray[i], &mn2->node->subsarray[i])))	/* note assignment */
+			return ret;
+	}
+	if (mn1->node->subs_used != mn2->node->subs_used)
+		return (mn1->node->subs_used < mn2->node->subs_used) ? -1 : 1;
+	return (mn1->index < mn2->index) ? -1 : 1;
+}
+
+/* Compares two subscripts approximating the default collation order of keys in the database : non-negative integers
+ * (without leading zeros) sort numerically and before all other subscripts which sort bytewise. The order only needs to
+ * bring neighbouring keys together and does not affect the result of any node.
+ */
+STATICFNDEF int many_subs_cmp(const ydb_buffer_t *s1, const ydb_buffer_t *s2)
+{
+	boolean_t	invalid1, invalid2, isnum1, isnum2;
+	char		*cp, *ctop;
+	int		ret;
+
+	invalid1 = IS_INVALID_YDB_BUFF_T(s1);
+	invalid2 = IS_INVALID_YDB_BUFF_T(s2);
+	if (invalid1 || invalid2)
+		return (invalid1 == invalid2) ? 0 : (invalid1 ? 1 : -1);	/* PARAMINVALID issued when node is processed */
+	isnum1 = ((0 < s1->len_used) && ((1 == s1->len_used) || ('0' != s1->buf_addr[0])));
+	for (cp = s1->buf_addr, ctop = cp + s1->len_used; isnum1 && (cp < ctop); cp++)
+		isnum1 = ISDIGIT_ASCII(*cp);
+	isnum2 = ((0 < s2->len_used) && ((1 == s2->len_used) || ('0' != s2->buf_addr[0])));
+	for (cp = s2->buf_addr, ctop = cp + s2->len_used; isnum2 && (cp < ctop); cp++)
+		isnum2 = ISDIGIT_ASCII(*cp);
+	if (isnum1 != isnum2)
+		return isnum1 ? -1 : 1;
+	if (isnum1 && (s1->len_used != s2->len_used))
+		return (s1->len_used < s2->len_used) ? -1 : 1;
+	if (!s1->len_used || !s2->len_used)
+		return (s1->len_used == s2->len_used) ? 0 : (!s1->len_used ? -1 : 1);	/* buf_addr can be NULL */
+	ret = memcmp(s1->buf_addr, s2->buf_addr, MIN(s1->len_used, s2->len_used));
+	if (!ret && (s1->len_used != s2->len_used))
+		ret = (s1->len_used < s2->len_used) ? -1 : 1;
+	return ret;
+}
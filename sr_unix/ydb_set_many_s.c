@@ -0,0 +1,33 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "libyottadb_int.h"
+
+/* Routine to set the values of many local, global and ISV nodes in one call. See "ydb_many_s_common" for details.
+ *
+ * Parameters:
+ *   count	- Number of entries in "nodes"
+ *   nodes	- Array of nodes to set. The status of each node is returned in its "status" field.
+ */
+int ydb_set_many_s(int count, ydb_node_t *nodes)
+{
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	return ydb_many_s_common(LYDB_RTN_SET_MANY, count, nodes);
+}
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2019 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2018 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -102,11 +102,11 @@ omi_lkextnam(
     reg        = mlk_region_lookup(&lck, cptr->ga);
     OMI_SI_READ(&si, data);
     MLK_PVTBLK_ALLOC(elen, subcnt, si.value + 1, r);
-    MLK_PVTCTL_INIT(r->pvtctl, reg);
     r->translev      = 1;
     r->subscript_cnt = subcnt;
     r->nref_length  = elen;
     memcpy(&r->value[0], lck.str.addr - 1, elen);
+    MLK_PVTCTL_INIT_PVTBLK(r, reg);
     MLK_PVTBLK_TAIL(r)[0] = si.value;
     memcpy(MLK_PVTBLK_TAIL(r) + 1, data, si.value);
     MLK_PVTBLK_SUBHASH_GEN(r);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2018 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -203,8 +203,8 @@ int rc_prc_lock(rc_q_hdr *qhdr)
 		mp->subscript_cnt = subcnt;
 		mp->nref_length = temp;
 		memcpy(mp->value, key_buff, mp->nref_length);
+		MLK_PVTCTL_INIT_PVTBLK(mp, gv_cur_region);
 		MLK_PVTBLK_SUBHASH_GEN(mp);
-		MLK_PVTCTL_INIT(mp->pvtctl, gv_cur_region);
 		MLK_PVTBLK_TAIL(mp)[0] = pid_len;
 		memcpy(MLK_PVTBLK_TAIL(mp) + 1, buff, pid_len);
 		if (!mlk_pvtblk_insert(mp))
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -30,11 +30,9 @@ cmi_status_t cmi_close(struct CLB *lnk)
 	qp = RELQUE2PTR(lnk->cqe.fl);
 	previous = QUEENT2CLB(qp, cqe);
 	remqt(&previous->cqe);
+	cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, 0, lnk->epoll_events);
 	CLOSEFILE(lnk->mun, status);
-	assertpro(FD_SETSIZE > lnk->mun);
-	FD_CLR(lnk->mun, &tsk->rs);
-	FD_CLR(lnk->mun, &tsk->ws);
-	FD_CLR(lnk->mun, &tsk->es);
+	lnk->epoll_events = 0;	/* the close removed it from the set even if the delete above failed */
 	lnk->mun = -1;
 	lnk->sta = CM_CLB_DISCONNECT;
 	if (tsk->trc)
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017-2018 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -125,15 +125,17 @@ cmi_status_t cmi_init(cmi_descriptor *tnd, unsigned char tnr,
 		SIGPROCMASK(SIG_SETMASK, &oset, NULL, rc);
 		return status;
 	}
-	assertpro(FD_SETSIZE > ntd_root->listen_fd);
-	FD_SET(ntd_root->listen_fd, &ntd_root->rs);
-	FD_SET(ntd_root->listen_fd, &ntd_root->es);
+	status = cmj_epoll_update(ntd_root, ntd_root->listen_fd, &ntd_root->listen_events, EPOLLIN | EPOLLPRI, 0);
+	if (CMI_ERROR(status))
+	{
+		CLOSEFILE_RESET(ntd_root->listen_fd, rc);	/* resets "ntd_root->listen_fd" to FD_INVALID */
+		SIGPROCMASK(SIG_SETMASK, &oset, NULL, rc);
+		return status;
+	}
 	ntd_root->err = err;
 	ntd_root->crq = crq;
 	ntd_root->acc = acc;
 	ntd_root->urg = urg;
-	if (ntd_root->listen_fd > ntd_root->max_fd)
-		ntd_root->max_fd = ntd_root->listen_fd;
 	cmj_housekeeping(); /* will establish listening pools */
 	SIGPROCMASK(SIG_SETMASK, &oset, NULL, rc);
 	return SS_NORMAL;
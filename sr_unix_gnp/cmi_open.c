@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -21,7 +21,7 @@
 #include "gtm_netdb.h"
 #include "gtm_inet.h"
 #include "gtm_string.h"
-#include "gtm_select.h"
+#include "gtm_poll.h"
 
 #include "cmidef.h"
 #include "gtmio.h"
@@ -47,7 +47,7 @@ cmi_status_t cmi_open(struct CLB *lnk)
 	int			new_fd, rc, save_errno;
 	int			sockerror;
 	GTM_SOCKLEN_TYPE	sockerrorlen;
-	fd_set			writefds;
+	struct pollfd		writefd;
 	int			save_error;
 
 	ASSERT_IS_LIBCMISOCKETTCP;
@@ -91,16 +91,15 @@ cmi_status_t cmi_open(struct CLB *lnk)
 #	endif
 			     ))
 	{	/* connection attempt will continue so wait for completion */
-		assertpro(FD_SETSIZE > new_fd);
 		do
 		{
 			if (EINTR == errno)
 				eintr_handling_check();
 			if ((EINTR == errno) && outofband && (jobinterrupt != outofband))
 				break;		/* abort unless job interrupt */
-			FD_ZERO(&writefds);
-			FD_SET(new_fd, &writefds);
-			rval = select(new_fd + 1, NULL, &writefds, NULL, NULL);
+			writefd.fd = new_fd;
+			writefd.events = POLLOUT;
+			rval = poll(&writefd, 1, -1);
 			HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
 			if (-1 == rval && EINTR == errno)
 			{
@@ -135,15 +134,17 @@ cmi_status_t cmi_open(struct CLB *lnk)
 	{
 		status = cmj_set_async(new_fd);
 		if (!CMI_ERROR(status))
+		{
+			lnk->epoll_events = 0;
+			status = cmj_epoll_update(ntd_root, new_fd, &lnk->epoll_events, EPOLLPRI, 0);
+		}
+		if (!CMI_ERROR(status))
 		{
 			insqh(&lnk->cqe, &ntd_root->cqh);
-			if (new_fd > ntd_root->max_fd)
-				ntd_root->max_fd = new_fd;
 			lnk->mun = new_fd;
 			memcpy((struct sockaddr *)(&lnk->peer_sas), ai_ptr->ai_addr, ai_ptr->ai_addrlen);
 			memcpy(&lnk->peer_ai, ai_ptr, SIZEOF(struct addrinfo));
 			lnk->peer_ai.ai_addr = (struct sockaddr *)(&lnk->peer_sas);
-			FD_SET(new_fd, &ntd_root->es);
 			lnk->sta = CM_CLB_IDLE;
 		} else
 			CLOSEFILE_RESET(new_fd, rc);	/* resets "new_fd" to FD_INVALID */
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -25,15 +25,14 @@ cmi_status_t cmj_clb_set_async(struct CLB *lnk)
 
 	ASSERT_IS_LIBCMISOCKETTCP;
 	CMI_DPRINT(("in cmj_clb_set_async sta = %d\n", lnk->sta));
-	assertpro(FD_SETSIZE > lnk->mun);
 	switch (lnk->sta)
 	{
 	case CM_CLB_READ:
-		FD_SET(lnk->mun, &tsk->rs);
+		status = cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, EPOLLIN, 0);
 		break;
 	case CM_CLB_WRITE:
 	case CM_CLB_WRITE_URG:
-		FD_SET(lnk->mun, &tsk->ws);
+		status = cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, EPOLLOUT, 0);
 		break;
 	default:
 		assert(FALSE);
@@ -51,11 +50,11 @@ cmi_status_t cmj_clb_reset_async(struct CLB *lnk)
 	switch (lnk->sta)
 	{
 	case CM_CLB_READ:
-		FD_CLR(lnk->mun, &tsk->rs);
+		status = cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, 0, EPOLLIN);
 		break;
 	case CM_CLB_WRITE:
 	case CM_CLB_WRITE_URG:
-		FD_CLR(lnk->mun, &tsk->ws);
+		status = cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, 0, EPOLLOUT);
 		break;
 	default:
 		assert(FALSE);
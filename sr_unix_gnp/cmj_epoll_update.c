@@ -0,0 +1,43 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+#include "cmidef.h"
+#include <errno.h>
+
+/* Adds the events in "add" to, and then removes the events in "remove" from, the events "fd" is registered for in the
+ * epoll set of "tsk". "*events" holds the events "fd" is currently registered for and is updated on success. The fd is
+ * added to the set with its first event and deleted from it with its last, so a closed link leaves no stale entry.
+ */
+cmi_status_t cmj_epoll_update(struct NTD *tsk, int fd, uint4 *events, uint4 add, uint4 remove)
+{
+	struct epoll_event	event;
+	uint4			new_events;
+	int			op;
+
+	ASSERT_IS_LIBCMISOCKETTCP;
+	new_events = (*events | add) & ~remove;
+	if (new_events == *events)
+		return SS_NORMAL;
+	if (!*events)
+		op = EPOLL_CTL_ADD;
+	else if (!new_events)
+		op = EPOLL_CTL_DEL;
+	else
+		op = EPOLL_CTL_MOD;
+	event.events = new_events;
+	event.data.fd = fd;
+	if ((-1 == epoll_ctl(tsk->epoll_fd, op, fd, &event)) && ((EPOLL_CTL_DEL != op) || (EBADF != errno)))
+		return errno;
+	*events = new_events;
+	return SS_NORMAL;
+}
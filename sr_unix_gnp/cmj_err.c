@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -27,9 +27,6 @@ void cmj_err(struct CLB *lnk, cmi_reason_t reason, cmi_status_t status)
 	lnk->deferred_event = TRUE;
 	lnk->deferred_reason = reason;
 	lnk->deferred_status = status;
-	assertpro(FD_SETSIZE > lnk->mun);
-	FD_CLR(lnk->mun, &tsk->rs);
-	FD_CLR(lnk->mun, &tsk->ws);
-	FD_CLR(lnk->mun, &tsk->es);
+	cmj_epoll_update(tsk, lnk->mun, &lnk->epoll_events, 0, lnk->epoll_events);
 	lnk->sta = CM_CLB_DISCONNECT;
 }
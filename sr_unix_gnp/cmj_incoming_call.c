@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -61,8 +61,14 @@ void cmj_incoming_call(struct NTD *tsk)
 			CLOSEFILE_RESET(rval, rc);	/* resets "rval" to FD_INVALID */
 			return;
 		}
-		if (rval > tsk->max_fd)
-			tsk->max_fd = rval;
+		lnk->epoll_events = 0;
+		status = cmj_epoll_update(tsk, rval, &lnk->epoll_events, EPOLLPRI, 0);
+		if (CMI_ERROR(status))
+		{
+			cmi_free_clb(lnk);
+			CLOSEFILE_RESET(rval, rc);	/* resets "rval" to FD_INVALID */
+			return;
+		}
 		lnk->mun = rval;
 		lnk->sta = CM_CLB_IDLE;
 		memcpy(&lnk->peer_sas, &sas, sz);
@@ -70,8 +76,6 @@ void cmj_incoming_call(struct NTD *tsk)
 		lnk->peer_ai.ai_addrlen = sz;
 		insqh(&lnk->cqe, &tsk->cqh);
 		lnk->ntd = tsk;
-		assertpro(FD_SETSIZE > rval);
-		FD_SET(rval, &tsk->es);
 		/* setup for callback processing */
 		lnk->deferred_event = TRUE;
 		lnk->deferred_reason = CMI_REASON_CONNECT;
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2009 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -41,9 +41,8 @@ cmi_status_t cmj_netinit(void)
 	tsk = ntd_root;
 	memset(tsk, 0, SIZEOF(*tsk));
 	tsk->listen_fd = FD_INVALID;
-	FD_ZERO(&tsk->rs);
-	FD_ZERO(&tsk->ws);
-	FD_ZERO(&tsk->es);
+	if (FD_INVALID == (tsk->epoll_fd = epoll_create1(EPOLL_CLOEXEC)))
+		return errno;
 	/* To support CMI_MUTEX_ macros */
 	sigemptyset(&tsk->mutex_set);
 	sigaddset(&tsk->mutex_set, SIGIO);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -14,89 +14,90 @@
  ****************************************************************/
 #include "mdef.h"
 #include "cmidef.h"
-#include "gtm_time.h"
-#include <sys/time.h>
 #include <errno.h>
 #include "eintr_wrappers.h"
 
+#define	CMJ_EPOLL_EVENTS	64	/* events looked at per epoll_wait(); any others are returned by the next one */
+
+/* An error or hangup is reported whatever the events asked for; pass it on as readiness for the I/O the link waits for,
+ * which is how select() reported it.
+ */
+#define	CMJ_EPOLL_READY(EVENTS, WANTED, ASKED)	\
+	(((EVENTS) & (WANTED)) || (((EVENTS) & (EPOLLERR | EPOLLHUP)) && ((ASKED) & (WANTED))))
+
 GBLREF struct NTD *ntd_root;
 
 void cmj_select(int signo)
 {
-	int count;
-	int rsfd;
-	int wsfd;
-	int esfd;
-	struct timeval t;
-	int n = ntd_root->max_fd + 1;
+	int count, i, fd, dispatched;
+	uint4 ev;
+	boolean_t first;
 	struct CLB *lnk;
+	struct epoll_event events[CMJ_EPOLL_EVENTS];
 
 	ASSERT_IS_LIBCMISOCKETTCP;
-	fd_set myrs = ntd_root->rs;
-	fd_set myws = ntd_root->ws;
-	fd_set myes = ntd_root->es;
-
-	t.tv_usec = 0;
-	t.tv_sec = 0;
-	do
+	for (first = TRUE; ; first = FALSE)
 	{
-		count = select(n, &myrs, &myws, &myes, &t);
-		HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
-		if ((0 <= count) || ((EINTR != errno) && (EAGAIN != errno)))
+		do
+		{
+			count = epoll_wait(ntd_root->epoll_fd, events, CMJ_EPOLL_EVENTS, 0);
+			HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
+			if ((0 <= count) || ((EINTR != errno) && (EAGAIN != errno)))
+				break;
+			if (EINTR == errno)
+				eintr_handling_check();
+		} while (TRUE);
+		if (0 >= count)
 			break;
-		if (EINTR == errno)
-			eintr_handling_check();
-	} while (TRUE);
-
-	while (0 < count) {
-		/* decode */
-		esfd = cmj_firstone(&myes, n);
-		while (0 < esfd)
+		/* As with the select() sets this replaced, all exceptions are handled first, then reads, then writes.
+		 * Links are looked up by fd each time, as an earlier callback may have closed one.
+		 */
+		dispatched = 0;
+		/* Don't look at exceptions again after the first pass since urgent exception
+		 * is not cleared until the first byte of non-urgent data
+		 */
+		for (i = 0; first && (i < count); i++)
 		{
-			lnk = cmj_unit2clb(ntd_root, esfd);
-			if (lnk)
+			if (!(events[i].events & EPOLLPRI))
+				continue;
+			fd = events[i].data.fd;
+			lnk = (fd == ntd_root->listen_fd) ? NULL : cmj_unit2clb(ntd_root, fd);
+			if (lnk && (lnk->epoll_events & EPOLLPRI))
 				cmj_exception_interrupt(lnk, signo);
-			esfd = cmj_firstone(&myes, n);
+			dispatched++;
 		}
-
-		rsfd = cmj_firstone(&myrs, n);
-		while (0 < rsfd)
+		for (i = 0; i < count; i++)
 		{
-			if (rsfd == ntd_root->listen_fd)
-				cmj_incoming_call(ntd_root);
-			else
+			fd = events[i].data.fd;
+			ev = events[i].events;
+			if (fd == ntd_root->listen_fd)
 			{
-				lnk = cmj_unit2clb(ntd_root, rsfd);
-				if (lnk)
+				if (CMJ_EPOLL_READY(ev, EPOLLIN, ntd_root->listen_events))
+				{
+					cmj_incoming_call(ntd_root);
+					dispatched++;
+				}
+			} else if (NULL != (lnk = cmj_unit2clb(ntd_root, fd)))
+			{
+				if (CMJ_EPOLL_READY(ev, EPOLLIN, lnk->epoll_events))
+				{
 					cmj_read_interrupt(lnk, signo);
+					dispatched++;
+				}
 			}
-			rsfd = cmj_firstone(&myrs, n);
 		}
-
-		wsfd = cmj_firstone(&myws, n);
-		while (0 < wsfd)
+		for (i = 0; i < count; i++)
 		{
-			lnk = cmj_unit2clb(ntd_root, wsfd);
-			if (lnk)
+			fd = events[i].data.fd;
+			ev = events[i].events;
+			if ((fd != ntd_root->listen_fd) && (NULL != (lnk = cmj_unit2clb(ntd_root, fd)))
+					&& CMJ_EPOLL_READY(ev, EPOLLOUT, lnk->epoll_events))
+			{
 				cmj_write_interrupt(lnk, signo);
-			wsfd = cmj_firstone(&myws, n);
+				dispatched++;
+			}
 		}
-		myrs = ntd_root->rs;
-		myws = ntd_root->ws;
-		t.tv_usec = 0;
-		t.tv_sec = 0;
-		/*
-		 * don't look at exceptions again since urgent exception
-		 * is not cleared until the first byte of non-urgent data
-		 */
-		do
-		{
-			count = select(n, &myrs, &myws, NULL, &t);
-			HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
-			if ((0 <= count) || ((EINTR != errno) && (EAGAIN != errno)))
-				break;
-			if (EINTR == errno)
-				eintr_handling_check();
-		} while (TRUE);
+		if (!dispatched)
+			break;
 	}
 }